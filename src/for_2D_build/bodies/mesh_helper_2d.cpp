@@ -4,6 +4,49 @@
 namespace SPH
 {
 //=================================================================================================//
+size_t MeshFileHelpers::parseHexIntegers(const std::string &text_line, size_t *values, size_t max_values)
+{
+    const char *position = text_line.c_str();
+    size_t number_of_values = 0;
+    while (number_of_values != max_values)
+    {
+        char *end = nullptr;
+        size_t value = std::strtoull(position, &end, 16);
+        if (end == position)
+            break;
+        values[number_of_values++] = value;
+        position = end;
+    }
+    return number_of_values;
+}
+//=================================================================================================//
+size_t MeshFileHelpers::parseReals(const std::string &text_line, Real *values, size_t max_values)
+{
+    const char *position = text_line.c_str();
+    size_t number_of_values = 0;
+    while (number_of_values != max_values)
+    {
+        char *end = nullptr;
+        Real value = std::strtod(position, &end);
+        if (end == position)
+            break;
+        values[number_of_values++] = value;
+        position = end;
+    }
+    return number_of_values;
+}
+//=================================================================================================//
+void MeshFileHelpers::faceNodesAndCells(const std::string &text_line, Vecd &nodes, Vec2d &cells)
+{
+    size_t values[Dimensions + 2] = {0};
+    parseHexIntegers(text_line, values, Dimensions + 2);
+    for (int k = 0; k != Dimensions; ++k)
+    {
+        nodes[k] = Real(values[k]) - 1;
+    }
+    cells = Vec2d(Real(values[Dimensions]), Real(values[Dimensions + 1]));
+}
+//=================================================================================================//
 void MeshFileHelpers::meshDimension(std::ifstream &mesh_file, size_t &dimension, std::string &text_line)
 {
     while (getline(mesh_file, text_line))
@@ -48,18 +91,8 @@ void MeshFileHelpers::nodeCoordinates(std::ifstream &mesh_file, StdLargeVec<Vecd
         {
             if (text_line.find(" ", 0) != std::string::npos)
             {
-                size_t divide_position = text_line.find_first_of(" ");
-                std::string x_part = text_line;
-                std::string y_part = text_line;
-                std::string x_coordinate_string = x_part.erase(divide_position);
-                std::string y_coordinate_string = y_part.erase(0, divide_position);
-
                 Vec2d coordinate = Vec2d::Zero();
-                std::istringstream stream_x, stream_y;
-                stream_x.str(x_coordinate_string);
-                stream_y.str(y_coordinate_string);
-                stream_x >> coordinate[0];
-                stream_y >> coordinate[1];
+                parseReals(text_line, coordinate.data(), 2);
                 node_coordinates_.push_back(coordinate);
             }
         }
@@ -150,47 +183,6 @@ size_t MeshFileHelpers::findBoundaryType(std::string &text_line, size_t boundary
     return boundary_type;
 }
 //=================================================================================================//
-Vecd MeshFileHelpers::nodeIndex(std::string &text_line)
-{
-    /*--- find the node1 between two cells ---*/
-    std::string node1_string_copy = text_line;
-    size_t first_divide_position = text_line.find_first_of(" ", 0);
-    std::string node1_index_string = node1_string_copy.erase(first_divide_position);
-    size_t node1_index_decimal = stoi(node1_index_string, nullptr, 16) - 1;
-
-    /*--- find the node2 between two cells---*/
-    std::string node2_string = text_line;
-    node2_string = node2_string.erase(0, first_divide_position + 1);
-    size_t second_divide_position = node2_string.find_first_of(" ", 0);
-    node2_string.erase(second_divide_position);
-    size_t node2_index_decimal = stoi(node2_string, nullptr, 16) - 1;
-    Vecd nodes = Vecd(node1_index_decimal, node2_index_decimal);
-    return nodes;
-}
-//=================================================================================================//
-Vec2d MeshFileHelpers::cellIndex(std::string &text_line)
-{
-
-    /*--- find the cell1---*/
-    std::string cell1_string = text_line;
-    size_t first_divide_position = text_line.find_first_of(" ", 0);
-    cell1_string = cell1_string.erase(0, first_divide_position + 1);
-    size_t second_divide_position = cell1_string.find_first_of(" ", 0);
-    cell1_string = cell1_string.erase(0, second_divide_position + 1);
-    size_t third_divide_position = cell1_string.find_first_of(" ", 0);
-    cell1_string.erase(third_divide_position);
-    size_t cell1_index_decimal = std::stoi(cell1_string, nullptr, 16);
-
-    /*--- find the cell2---*/
-    std::string cell2_string = text_line;
-    cell2_string = cell2_string.erase(0, first_divide_position + 1);
-    cell2_string = cell2_string.erase(0, second_divide_position + 1);
-    cell2_string.erase(0, third_divide_position + 1);
-    size_t cell2_index_decimal = stoi(cell2_string, nullptr, 16);
-    Vecd cells = Vecd(cell1_index_decimal, cell2_index_decimal);
-    return cells;
-}
-//=================================================================================================//
 void MeshFileHelpers::updateElementsNodesConnection(StdLargeVec<StdVec<size_t>> &elements_nodes_connection_,
                                                     Vecd nodes, Vec2d cells,
                                                     bool &check_neighbor_cell1, bool &check_neighbor_cell2)
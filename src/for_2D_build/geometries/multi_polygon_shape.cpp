@@ -279,6 +279,17 @@ Vecd MultiPolygonShape::findClosestPoint(const Vecd &probe_point)
     return multi_polygon_.findClosestPoint(probe_point);
 }
 //=================================================================================================//
+bool MultiPolygonShape::hashGeometrySource(FNVHash &hash)
+{
+    hash.add("MultiPolygonShape");
+    for_each_point(multi_polygon_.getBoostMultiPoly(),
+                   [&](const model::d2::point_xy<Real> &point)
+                   {
+                       hash.add(Vecd(point.x(), point.y()));
+                   });
+    return true;
+}
+//=================================================================================================//
 BoundingBox MultiPolygonShape::findBounds()
 {
     return multi_polygon_.findBounds();
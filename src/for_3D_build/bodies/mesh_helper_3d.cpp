@@ -5,6 +5,49 @@
 namespace SPH
 {
 
+size_t MeshFileHelpers::parseHexIntegers(const std::string &text_line, size_t *values, size_t max_values)
+{
+    const char *position = text_line.c_str();
+    size_t number_of_values = 0;
+    while (number_of_values != max_values)
+    {
+        char *end = nullptr;
+        size_t value = std::strtoull(position, &end, 16);
+        if (end == position)
+            break;
+        values[number_of_values++] = value;
+        position = end;
+    }
+    return number_of_values;
+}
+//=================================================================================================//
+size_t MeshFileHelpers::parseReals(const std::string &text_line, Real *values, size_t max_values)
+{
+    const char *position = text_line.c_str();
+    size_t number_of_values = 0;
+    while (number_of_values != max_values)
+    {
+        char *end = nullptr;
+        Real value = std::strtod(position, &end);
+        if (end == position)
+            break;
+        values[number_of_values++] = value;
+        position = end;
+    }
+    return number_of_values;
+}
+//=================================================================================================//
+void MeshFileHelpers::faceNodesAndCells(const std::string &text_line, Vecd &nodes, Vec2d &cells)
+{
+    size_t values[Dimensions + 2] = {0};
+    parseHexIntegers(text_line, values, Dimensions + 2);
+    for (int k = 0; k != Dimensions; ++k)
+    {
+        nodes[k] = Real(values[k]) - 1;
+    }
+    cells = Vec2d(Real(values[Dimensions]), Real(values[Dimensions + 1]));
+}
+//=================================================================================================//
 void MeshFileHelpers::meshDimension(std::ifstream &mesh_file, size_t &dimension, std::string &text_line)
 {
     while (getline(mesh_file, text_line))
@@ -51,24 +94,8 @@ void MeshFileHelpers::nodeCoordinates(std::ifstream &mesh_file, StdLargeVec<Vecd
             {
                 if (dimension == 3)
                 {
-                    size_t first_devide_position = text_line.find_first_of(" ");
-                    size_t last_devide_position = text_line.find_last_of(" ");
-                    std::string x_part = text_line;
-                    std::string y_part = text_line;
-                    std::string z_part = text_line;
-                    std::string x_coordinate_string = x_part.erase(first_devide_position);
-                    std::string y_coordinate_string = y_part.erase(last_devide_position);
-                    y_coordinate_string = y_coordinate_string.erase(0, first_devide_position);
-                    std::string z_coordinate_string = z_part.erase(0, last_devide_position);
-                    std::istringstream streamx, streamy, streamz;
                     Vecd Coords = Vecd::Zero();
-                    streamx.str(x_coordinate_string);
-                    streamy.str(y_coordinate_string);
-                    streamz.str(z_coordinate_string);
-                    streamx >> Coords[0];
-                    streamy >> Coords[1];
-                    streamz >> Coords[2];
-
+                    parseReals(text_line, Coords.data(), 3);
                     node_coordinates_.push_back(Coords);
                 }
             }
@@ -160,62 +187,6 @@ size_t MeshFileHelpers::findBoundaryType(std::string &text_line, size_t boundary
     return boundary_type;
 }
 
-Vecd MeshFileHelpers::nodeIndex(std::string &text_line)
-
-{
-    /*--- find the node1 between two cells ---*/
-    std::string node1_string_copy = text_line;
-    size_t first_devide_position = text_line.find_first_of(" ", 0);
-    std::string node1_index_string = node1_string_copy.erase(first_devide_position);
-    size_t node1_index_decimal = stoi(node1_index_string, nullptr, 16) - 1;
-
-    /*--- find the node2 between two cells---*/
-    std::string node2_string = text_line;
-    std::string node3_string = text_line;
-    node2_string = node2_string.erase(0, first_devide_position + 1);
-    node3_string = node2_string;
-    size_t second_devide_position = node2_string.find_first_of(" ", 0);
-    node2_string.erase(second_devide_position);
-    size_t node2_index_decimal = stoi(node2_string, nullptr, 16) - 1;
-
-    /*--- find the node3 between two cells---*/
-    node3_string = node3_string.erase(0, second_devide_position + 1);
-    size_t third_devide_position = node3_string.find_first_of(" ", 0);
-    node3_string.erase(third_devide_position);
-    size_t node3_index_decimal = stoi(node3_string, nullptr, 16) - 1;
-
-    Vecd nodes = Vecd(node1_index_decimal, node2_index_decimal, node3_index_decimal);
-    return nodes;
-}
-
-Vec2d MeshFileHelpers::cellIndex(std::string &text_line)
-{
-
-    /*--- find the cell1---*/
-    std::string cell1_string = text_line;
-    std::string cell2_string = text_line;
-    std::string cell3_string = text_line;
-    size_t first_devide_position = text_line.find_first_of(" ", 0);
-    cell1_string = cell1_string.erase(0, first_devide_position + 1);
-    size_t second_devide_position = cell1_string.find_first_of(" ", 0);
-    cell2_string = cell1_string.erase(0, second_devide_position + 1);
-    size_t third_devide_position = cell2_string.find_first_of(" ", 0);
-    cell3_string = cell2_string.erase(0, third_devide_position + 1);
-    size_t fourth_devide_position = cell3_string.find_first_of(" ", 0);
-    cell3_string.erase(fourth_devide_position);
-    size_t cell1_index_decimal = stoi(cell3_string, nullptr, 16);
-
-    /*--- find the cell2---*/
-    std::string cell4_string = text_line;
-    cell4_string = cell4_string.erase(0, first_devide_position + 1);
-    cell4_string = cell4_string.erase(0, second_devide_position + 1);
-    cell4_string = cell4_string.erase(0, third_devide_position + 1);
-    cell4_string.erase(0, fourth_devide_position + 1);
-    size_t cell2_index_decimal = stoi(cell4_string, nullptr, 16);
-    Vec2d cells = Vec2d(cell1_index_decimal, cell2_index_decimal);
-    return cells;
-}
-
 void MeshFileHelpers::updateElementsNodesConnection(StdLargeVec<StdVec<size_t>> &elements_nodes_connection_, Vecd nodes, Vec2d cells,
                                                     bool &check_neighbor_cell1, bool &check_neighbor_cell2)
 {
@@ -457,23 +428,8 @@ void MeshFileHelpers::nodeCoordinatesFluent(std::ifstream &mesh_file, StdLargeVe
                 {
                     if (dimension == 3)
                     {
-                        size_t first_devide_position = text_line.find_first_of(" ");
-                        size_t last_devide_position = text_line.find_last_of(" ");
-                        std::string x_part = text_line;
-                        std::string y_part = text_line;
-                        std::string z_part = text_line;
-                        std::string x_coordinate_string = x_part.erase(first_devide_position);
-                        std::string y_coordinate_string = y_part.erase(last_devide_position);
-                        y_coordinate_string = y_coordinate_string.erase(0, first_devide_position);
-                        std::string z_coordinate_string = z_part.erase(0, last_devide_position);
                         Vecd Coords = Vecd::Zero();
-                        std::istringstream streamx, streamy, streamz;
-                        streamx.str(x_coordinate_string);
-                        streamy.str(y_coordinate_string);
-                        streamz.str(z_coordinate_string);
-                        streamx >> Coords[0];
-                        streamy >> Coords[1];
-                        streamz >> Coords[2];
+                        parseReals(text_line, Coords.data(), 3);
                         node_coordinates_.push_back(Coords);
                     }
                 }
@@ -5,13 +5,6 @@
 namespace SPH
 {
 //=================================================================================================//
-ANSYSMesh::ANSYSMesh(const std::string &full_path)
-{
-    getDataFromMeshFile(full_path);
-    getElementCenterCoordinates();
-    getMinimumDistanceBetweenNodes();
-}
-//=================================================================================================//
 void ANSYSMesh::getDataFromMeshFile(const std::string &full_path)
 {
     Real ICEM = 0;
@@ -63,8 +56,9 @@ void ANSYSMesh::getDataFromMeshFile(const std::string &full_path)
                 {
                     if (text_line.find(")", 0) == std::string::npos)
                     {
-                        Vecd nodes = MeshFileHelpers::nodeIndex(text_line);
-                        Vec2d cells = MeshFileHelpers::cellIndex(text_line);
+                        Vecd nodes = Vecd::Zero();
+                        Vec2d cells = Vec2d::Zero();
+                        MeshFileHelpers::faceNodesAndCells(text_line, nodes, cells);
 
                         /*--- build up all topology---*/
                         bool check_neighbor_cell1 = 1;
@@ -127,8 +121,9 @@ void ANSYSMesh::getDataFromMeshFile(const std::string &full_path)
 
                     if (text_line.find(")", 0) == std::string::npos)
                     {
-                        Vecd nodes = MeshFileHelpers::nodeIndex(text_line);
-                        Vec2d cells = MeshFileHelpers::cellIndex(text_line);
+                        Vecd nodes = Vecd::Zero();
+                        Vec2d cells = Vec2d::Zero();
+                        MeshFileHelpers::faceNodesAndCells(text_line, nodes, cells);
                         /*--- build up all topology---*/
                         bool check_neighbor_cell1 = 1;
                         bool check_neighbor_cell2 = 0;
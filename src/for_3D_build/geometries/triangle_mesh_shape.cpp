@@ -63,6 +63,21 @@ Vecd TriangleMeshShape::findClosestPoint(const Vecd &probe_point)
     return Vecd(closest_pnt[0], closest_pnt[1], closest_pnt[2]);
 }
 //=================================================================================================//
+bool TriangleMeshShape::hashGeometrySource(FNVHash &hash)
+{
+    hash.add("TriangleMeshShape");
+    for (int i = 0; i != triangle_mesh_->getNumVertices(); ++i)
+    {
+        hash.add(SimTKToEigen(triangle_mesh_->getVertexPosition(i)));
+    }
+    for (int i = 0; i != triangle_mesh_->getNumFaces(); ++i)
+    {
+        for (int k = 0; k != 3; ++k)
+            hash.add(triangle_mesh_->getFaceVertex(i, k));
+    }
+    return true;
+}
+//=================================================================================================//
 BoundingBox TriangleMeshShape::findBounds()
 {
     int number_of_vertices = triangle_mesh_->getNumVertices();
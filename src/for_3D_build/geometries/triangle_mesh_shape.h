@@ -59,6 +59,7 @@ class TriangleMeshShape : public Shape
      * when probe distance is far from the surface. */
     virtual bool checkContain(const Vec3d &probe_point, bool BOUNDARY_INCLUDED = true) override;
     virtual Vec3d findClosestPoint(const Vec3d &probe_point) override;
+    virtual bool hashGeometrySource(FNVHash &hash) override;
     TriangleMesh *getTriangleMesh();
 
   protected:
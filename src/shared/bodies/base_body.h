@@ -148,9 +148,14 @@ class SPHBody
     template <typename... Args>
     LevelSetShape *defineBodyLevelSetShape(Args &&...args)
     {
+        SharedPtr<Shape> initial_shape_ptr = shape_ptr_keeper_.getSharedPtr();
+        if (initial_shape_ptr.get() != initial_shape_)
+        {
+            // the initial shape is not owned by the body but kept alive by the caller
+            initial_shape_ptr = SharedPtr<Shape>(SharedPtr<Shape>(), initial_shape_);
+        }
         LevelSetShape *level_set_shape =
-            shape_ptr_keeper_.resetPtr<LevelSetShape>(*this, *initial_shape_, std::forward<Args>(args)...);
-
+            shape_ptr_keeper_.resetPtr<LevelSetShape>(*this, initial_shape_ptr, std::forward<Args>(args)...);
         initial_shape_ = level_set_shape;
         return level_set_shape;
     };
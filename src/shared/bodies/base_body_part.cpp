@@ -167,7 +167,7 @@ NearShapeSurface::NearShapeSurface(RealBody &real_body, LevelSetShape &level_set
 //=================================================================================================//
 NearShapeSurface::NearShapeSurface(RealBody &real_body, SharedPtr<Shape> shape_ptr)
     : BodyPartByCell(real_body, shape_ptr->getName()),
-      level_set_shape_(level_set_shape_keeper_.createRef<LevelSetShape>(real_body, *shape_ptr.get(), true))
+      level_set_shape_(level_set_shape_keeper_.createRef<LevelSetShape>(real_body, shape_ptr, true))
 {
     TaggingCellMethod tagging_cell_method = std::bind(&NearShapeSurface::checkNearSurface, this, _1, _2);
     tagCells(tagging_cell_method);
@@ -30,6 +30,7 @@
 
 #include "unstructured_mesh.h"
 
+#include <cstdlib>
 #include <filesystem>
 #include <fstream>
 #include <iomanip>
@@ -48,11 +49,16 @@ class MeshFileHelpers
     static void numberOfNodes(std::ifstream &mesh_file, size_t &number_of_points, std::string &text_line);
     static void nodeCoordinates(std::ifstream &mesh_file, StdLargeVec<Vecd> &node_coordinates_, std::string &text_line, size_t &dimension);
     static void numberOfElements(std::ifstream &mesh_file, size_t &number_of_elements, std::string &text_line);
+    /** Scan the hexadecimal integers of a line in one pass without copying substrings.
+     * Returns the number of integers found, which is at most max_values. */
+    static size_t parseHexIntegers(const std::string &text_line, size_t *values, size_t max_values);
+    /** Scan the real numbers of a line in one pass. Returns the number of values found. */
+    static size_t parseReals(const std::string &text_line, Real *values, size_t max_values);
+    /** The nodes (index starting from zero) and the two cells of a face line "n1 .. nd c1 c2". */
+    static void faceNodesAndCells(const std::string &text_line, Vecd &nodes, Vec2d &cells);
     static void dataStruct(StdVec<StdVec<StdVec<size_t>>> &mesh_topology_, StdLargeVec<StdVec<size_t>> &elements_nodes_connection_,
                            size_t number_of_elements, size_t mesh_type, size_t dimension);
     static size_t findBoundaryType(std::string &text_line, size_t boundary_type);
-    static Vecd nodeIndex(std::string &text_line);
-    static Vec2d cellIndex(std::string &text_line);
     static void updateElementsNodesConnection(StdLargeVec<StdVec<size_t>> &elements_nodes_connection_, Vecd nodes, Vec2d cells,
                                               bool &check_neighbor_cell1, bool &check_neighbor_cell2);
     static void updateCellLists(StdVec<StdVec<StdVec<size_t>>> &mesh_topology_, StdLargeVec<StdVec<size_t>> &elements_nodes_connection_, Vecd nodes,
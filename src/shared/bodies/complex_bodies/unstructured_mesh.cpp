@@ -2,10 +2,314 @@
 #include "unstructured_mesh.h"
 
 #include "base_particle_dynamics.h"
+#include "binary_column_file.h"
+
+#include <filesystem>
+#include <numeric>
+namespace fs = std::filesystem;
 
 namespace SPH
 {
 //=================================================================================================//
+ANSYSMesh::ANSYSMesh(const std::string &full_path) : ANSYSMesh(full_path, false) {}
+//=================================================================================================//
+ANSYSMesh::ANSYSMesh(const std::string &full_path, bool use_binary_cache)
+{
+    if (use_binary_cache && readBinaryCache(full_path))
+    {
+        return;
+    }
+
+    getDataFromMeshFile(full_path);
+    getElementCenterCoordinates();
+    getMinimumDistanceBetweenNodes();
+
+    if (use_binary_cache)
+    {
+        writeBinaryCache(full_path);
+    }
+}
+//=================================================================================================//
+std::string ANSYSMesh::generateCacheKey(const std::string &full_path)
+{
+    std::error_code error_code;
+    uintmax_t file_size = fs::file_size(full_path, error_code);
+    if (error_code)
+    {
+        return std::string(); // no key without the mesh file
+    }
+    fs::file_time_type write_time = fs::last_write_time(full_path, error_code);
+    if (error_code)
+    {
+        return std::string();
+    }
+
+    std::stringstream key;
+    key << "ANSYSMesh;size:" << file_size
+        << ";time:" << write_time.time_since_epoch().count()
+        << ";dimensions:" << Dimensions << ";real:" << sizeof(Real);
+    return key.str();
+}
+//=================================================================================================//
+bool ANSYSMesh::readBinaryCache(const std::string &full_path)
+{
+    std::string cache_key = generateCacheKey(full_path);
+    BinaryColumnFile binary_file;
+    // a missing, stale or damaged cache is a cache miss and the mesh file is parsed
+    if (cache_key.empty() || !fs::exists(CacheFilePath(full_path)) ||
+        !binary_file.tryLoadFile(CacheFilePath(full_path)))
+    {
+        return false;
+    }
+
+    BinaryColumnFile::Column *key = binary_file.findColumn("Key");
+    if (key == nullptr || std::string(key->data_, key->number_of_values_) != cache_key)
+    {
+        return false;
+    }
+
+    auto column_size = [&](const std::string &name) -> size_t
+    {
+        BinaryColumnFile::Column *column = binary_file.findColumn(name);
+        return column == nullptr ? 0 : column->number_of_values_;
+    };
+
+    size_t number_of_nodes = column_size("NodeCoordinates");
+    size_t number_of_elements = column_size("ElementVolumes");
+    size_t number_of_boundary_types = column_size("BoundaryTypes");
+    const Vecd *nodes = binary_file.findColumnData<Vecd>("NodeCoordinates", number_of_nodes);
+    const Vecd *centroids = binary_file.findColumnData<Vecd>("ElementCentroids", number_of_elements);
+    const Real *volumes = binary_file.findColumnData<Real>("ElementVolumes", number_of_elements);
+    const size_t *boundary_types = binary_file.findColumnData<size_t>("BoundaryTypes", number_of_boundary_types);
+    const Real *min_mesh_edge = binary_file.findColumnData<Real>("MinMeshEdge", 1);
+    const size_t *element_nodes_offsets =
+        binary_file.findColumnData<size_t>("ElementNodesOffsets", number_of_elements + 1);
+    const size_t *face_offsets = binary_file.findColumnData<size_t>("TopologyFaceOffsets", number_of_elements + 1);
+    if (nodes == nullptr || centroids == nullptr || volumes == nullptr || boundary_types == nullptr ||
+        min_mesh_edge == nullptr || element_nodes_offsets == nullptr || face_offsets == nullptr)
+    {
+        return false;
+    }
+
+    const size_t *element_nodes =
+        binary_file.findColumnData<size_t>("ElementNodes", element_nodes_offsets[number_of_elements]);
+    size_t number_of_faces = face_offsets[number_of_elements];
+    const size_t *value_offsets = binary_file.findColumnData<size_t>("TopologyValueOffsets", number_of_faces + 1);
+    if (element_nodes == nullptr || value_offsets == nullptr)
+    {
+        return false;
+    }
+    const size_t *values = binary_file.findColumnData<size_t>("TopologyValues", value_offsets[number_of_faces]);
+    if (values == nullptr)
+    {
+        return false;
+    }
+
+    node_coordinates_.assign(nodes, nodes + number_of_nodes);
+    elements_centroids_.assign(centroids, centroids + number_of_elements);
+    elements_volumes_.assign(volumes, volumes + number_of_elements);
+    elements_nodes_connection_.resize(number_of_elements);
+    for (size_t i = 0; i != number_of_elements; ++i)
+    {
+        elements_nodes_connection_[i].assign(element_nodes + element_nodes_offsets[i],
+                                             element_nodes + element_nodes_offsets[i + 1]);
+    }
+    mesh_topology_.resize(number_of_elements);
+    for (size_t i = 0; i != number_of_elements; ++i)
+    {
+        mesh_topology_[i].resize(face_offsets[i + 1] - face_offsets[i]);
+        for (size_t k = 0; k != mesh_topology_[i].size(); ++k)
+        {
+            size_t face = face_offsets[i] + k;
+            mesh_topology_[i][k].assign(values + value_offsets[face], values + value_offsets[face + 1]);
+        }
+    }
+    types_of_boundary_condition_.assign(boundary_types, boundary_types + number_of_boundary_types);
+    min_distance_between_nodes_ = *min_mesh_edge;
+    return true;
+}
+//=================================================================================================//
+void ANSYSMesh::writeBinaryCache(const std::string &full_path)
+{
+    size_t number_of_elements = elements_nodes_connection_.size();
+    StdVec<size_t> element_nodes_offsets(1, 0), element_nodes;
+    for (size_t i = 0; i != number_of_elements; ++i)
+    {
+        element_nodes.insert(element_nodes.end(), elements_nodes_connection_[i].begin(),
+                             elements_nodes_connection_[i].end());
+        element_nodes_offsets.push_back(element_nodes.size());
+    }
+
+    StdVec<size_t> face_offsets(1, 0), value_offsets(1, 0), values;
+    for (size_t i = 0; i != number_of_elements; ++i)
+    {
+        for (auto &face : mesh_topology_[i])
+        {
+            values.insert(values.end(), face.begin(), face.end());
+            value_offsets.push_back(values.size());
+        }
+        face_offsets.push_back(value_offsets.size() - 1);
+    }
+
+    std::string key = generateCacheKey(full_path);
+    if (key.empty())
+    {
+        return;
+    }
+    Real min_mesh_edge = min_distance_between_nodes_;
+    BinaryColumnFile binary_file;
+    binary_file.addColumn("Key", key.data(), key.size());
+    binary_file.addColumn("NodeCoordinates", node_coordinates_.data(), node_coordinates_.size());
+    binary_file.addColumn("ElementCentroids", elements_centroids_.data(), elements_centroids_.size());
+    binary_file.addColumn("ElementVolumes", elements_volumes_.data(), elements_volumes_.size());
+    binary_file.addColumn("ElementNodesOffsets", element_nodes_offsets.data(), element_nodes_offsets.size());
+    binary_file.addColumn("ElementNodes", element_nodes.data(), element_nodes.size());
+    binary_file.addColumn("TopologyFaceOffsets", face_offsets.data(), face_offsets.size());
+    binary_file.addColumn("TopologyValueOffsets", value_offsets.data(), value_offsets.size());
+    binary_file.addColumn("TopologyValues", values.data(), values.size());
+    binary_file.addColumn("BoundaryTypes", types_of_boundary_condition_.data(), types_of_boundary_condition_.size());
+    binary_file.addColumn("MinMeshEdge", &min_mesh_edge, 1);
+    if (!binary_file.tryWriteToFile(CacheFilePath(full_path)))
+    {
+        std::cout << "\n Warning: the binary cache of the mesh is not written, as "
+                  << binary_file.ErrorMessage() << std::endl;
+    }
+}
+//=================================================================================================//
+void ANSYSMesh::reorderElements(const ReverseCuthillMcKeeOrder &)
+{
+    size_t number_of_elements = mesh_topology_.size();
+    // neighbor index is one-based in the topology, zero for boundary faces
+    auto is_element = [&](size_t neighbor)
+    { return neighbor != 0 && neighbor <= number_of_elements; };
+
+    StdVec<size_t> degrees(number_of_elements, 0);
+    for (size_t i = 0; i != number_of_elements; ++i)
+    {
+        for (auto &face : mesh_topology_[i])
+        {
+            degrees[i] += is_element(face[0]) ? 1 : 0;
+        }
+    }
+    auto by_degree = [&](size_t a, size_t b)
+    { return degrees[a] < degrees[b]; };
+
+    // each connected component is started from one of its elements with the fewest neighbors
+    StdVec<size_t> seeds(number_of_elements);
+    std::iota(seeds.begin(), seeds.end(), 0);
+    std::stable_sort(seeds.begin(), seeds.end(), by_degree);
+
+    StdVec<bool> is_visited(number_of_elements, false);
+    StdLargeVec<size_t> new_to_old;
+    new_to_old.reserve(number_of_elements);
+    StdVec<size_t> neighbors;
+    for (size_t seed : seeds)
+    {
+        if (is_visited[seed])
+            continue;
+
+        is_visited[seed] = true;
+        new_to_old.push_back(seed);
+        for (size_t head = new_to_old.size() - 1; head != new_to_old.size(); ++head)
+        {
+            neighbors.clear();
+            for (auto &face : mesh_topology_[new_to_old[head]])
+            {
+                if (is_element(face[0]) && !is_visited[face[0] - 1])
+                {
+                    is_visited[face[0] - 1] = true;
+                    neighbors.push_back(face[0] - 1);
+                }
+            }
+            std::stable_sort(neighbors.begin(), neighbors.end(), by_degree);
+            new_to_old.insert(new_to_old.end(), neighbors.begin(), neighbors.end());
+        }
+    }
+    std::reverse(new_to_old.begin(), new_to_old.end());
+    applyElementPermutation(new_to_old);
+}
+//=================================================================================================//
+template <class SequenceOrderType>
+void ANSYSMesh::reorderElementsBySequence(const SequenceOrderType &sequence_order)
+{
+    size_t number_of_elements = elements_centroids_.size();
+    Vecd lower_bound = MaxReal * Vecd::Ones();
+    Vecd upper_bound = MinReal * Vecd::Ones();
+    for (size_t i = 0; i != number_of_elements; ++i)
+    {
+        lower_bound = lower_bound.cwiseMin(elements_centroids_[i]);
+        upper_bound = upper_bound.cwiseMax(elements_centroids_[i]);
+    }
+
+    // a background mesh as fine as the sequence keys allow, so that almost each element is in a cell of its own
+    int resolution = Mesh::SequenceCellsPerAxis();
+    Real grid_spacing = SMAX((upper_bound - lower_bound).maxCoeff() / Real(resolution - 2), Eps);
+    Mesh background_mesh(lower_bound, grid_spacing, resolution * Arrayi::Ones());
+
+    StdLargeVec<size_t> sequence(number_of_elements);
+    for (size_t i = 0; i != number_of_elements; ++i)
+    {
+        sequence[i] = background_mesh.transferMeshIndexToSequence(
+            sequence_order, background_mesh.CellIndexFromPosition(elements_centroids_[i]));
+    }
+
+    StdLargeVec<size_t> new_to_old(number_of_elements);
+    std::iota(new_to_old.begin(), new_to_old.end(), 0);
+    std::stable_sort(new_to_old.begin(), new_to_old.end(),
+                     [&](size_t a, size_t b)
+                     { return sequence[a] < sequence[b]; });
+    applyElementPermutation(new_to_old);
+}
+//=================================================================================================//
+void ANSYSMesh::reorderElements(const MortonOrder &morton_order)
+{
+    reorderElementsBySequence(morton_order);
+}
+//=================================================================================================//
+void ANSYSMesh::reorderElements(const HilbertOrder &hilbert_order)
+{
+    reorderElementsBySequence(hilbert_order);
+}
+//=================================================================================================//
+void ANSYSMesh::applyElementPermutation(const StdLargeVec<size_t> &new_to_old)
+{
+    size_t number_of_elements = new_to_old.size();
+    StdLargeVec<size_t> old_to_new(number_of_elements);
+    for (size_t k = 0; k != number_of_elements; ++k)
+    {
+        old_to_new[new_to_old[k]] = k;
+    }
+
+    StdLargeVec<Vecd> centroids(number_of_elements);
+    StdLargeVec<Real> volumes(number_of_elements);
+    StdLargeVec<StdVec<size_t>> nodes_connection(number_of_elements);
+    StdVec<StdVec<StdVec<size_t>>> topology(number_of_elements);
+    for (size_t k = 0; k != number_of_elements; ++k)
+    {
+        size_t old_index = new_to_old[k];
+        centroids[k] = elements_centroids_[old_index];
+        volumes[k] = elements_volumes_[old_index];
+        nodes_connection[k] = std::move(elements_nodes_connection_[old_index]);
+        topology[k] = std::move(mesh_topology_[old_index]);
+
+        for (auto &face : topology[k])
+        {
+            if (face[0] != 0 && face[0] <= number_of_elements)
+            {
+                face[0] = old_to_new[face[0] - 1] + 1;
+            }
+        }
+        std::sort(topology[k].begin(), topology[k].end(),
+                  [](const StdVec<size_t> &a, const StdVec<size_t> &b)
+                  { return a[0] < b[0]; });
+    }
+
+    elements_centroids_.swap(centroids);
+    elements_volumes_.swap(volumes);
+    elements_nodes_connection_.swap(nodes_connection);
+    mesh_topology_.swap(topology);
+}
+//=================================================================================================//
 BaseInnerRelationInFVM::BaseInnerRelationInFVM(RealBody &real_body, ANSYSMesh &ansys_mesh)
     : BaseInnerRelation(real_body), real_body_(&real_body),
       node_coordinates_(ansys_mesh.node_coordinates_),
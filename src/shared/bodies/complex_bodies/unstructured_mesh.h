@@ -32,16 +32,31 @@
 
 namespace SPH
 {
+/** Tag of the reverse Cuthill-McKee ordering of mesh elements by their face neighbors. */
+class ReverseCuthillMcKeeOrder
+{
+};
+
 /**
  * @class ANSYSMesh
  * @brief ANASYS mesh.file parser class
+ * @details With binary cache, the parsed mesh is saved to a binary file next to the mesh file,
+ * and is loaded instead of parsing the mesh file again as long as the latter is unchanged.
  */
 class ANSYSMesh
 {
   public:
     ANSYSMesh(const std::string &full_path);
+    ANSYSMesh(const std::string &full_path, bool use_binary_cache);
     virtual ~ANSYSMesh(){};
 
+    /** Renumber the elements, and sort the faces of each element by the neighbor index,
+     * for the memory locality of the loops over faces.
+     * It should be called before generating particles from the mesh. */
+    void reorderElements(const ReverseCuthillMcKeeOrder &);
+    void reorderElements(const MortonOrder &);
+    void reorderElements(const HilbertOrder &);
+
     StdVec<size_t> types_of_boundary_condition_;
     StdLargeVec<Vecd> node_coordinates_;
     StdLargeVec<Vecd> elements_centroids_;
@@ -56,6 +71,18 @@ class ANSYSMesh
     void getDataFromMeshFile(const std::string &full_path);
     void getElementCenterCoordinates();
     void getMinimumDistanceBetweenNodes();
+
+    std::string CacheFilePath(const std::string &full_path) { return full_path + ".bin"; };
+    /** the key identifies the mesh file by its size and modification time, empty if the file is missing */
+    std::string generateCacheKey(const std::string &full_path);
+    /** returns false for a missing, stale or damaged cache so that the mesh file is parsed instead */
+    bool readBinaryCache(const std::string &full_path);
+    /** a cache which can not be written is skipped with a warning */
+    void writeBinaryCache(const std::string &full_path);
+    template <class SequenceOrderType>
+    void reorderElementsBySequence(const SequenceOrderType &sequence_order);
+    /** new_to_old gives the original index of each element in the new order */
+    void applyElementPermutation(const StdLargeVec<size_t> &new_to_old);
 };
 
 /**
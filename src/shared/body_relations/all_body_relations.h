@@ -31,7 +31,7 @@
 
 #include "base_body_relation.h"
 #include "complex_body_relation.h"
-#include "contact_body_relation.h"
-#include "inner_body_relation.h"
+#include "contact_body_relation.hpp"
+#include "inner_body_relation.hpp"
 
 #endif // ALL_BODY_RELATIONS_H
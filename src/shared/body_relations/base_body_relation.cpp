@@ -21,12 +21,27 @@ SPHRelation::SPHRelation(SPHBody &sph_body)
       base_particles_(sph_body.getBaseParticles()) {}
 //=================================================================================================//
 BaseInnerRelation::BaseInnerRelation(RealBody &real_body)
-    : SPHRelation(real_body), real_body_(&real_body)
+    : SPHRelation(real_body), real_body_(&real_body),
+      is_compact_configuration_(false)
 {
     subscribeToBody();
     inner_configuration_.resize(base_particles_.ParticlesBound(), Neighborhood());
 }
 //=================================================================================================//
+void BaseInnerRelation::useCompactConfiguration()
+{
+    std::cout << "\n Error: the inner relation of " << sph_body_.getName()
+              << " does not build the compact configuration!" << std::endl;
+    std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+    exit(1);
+}
+//=================================================================================================//
+void BaseInnerRelation::enableCompactConfiguration()
+{
+    is_compact_configuration_ = true;
+    compact_inner_configuration_.resize(base_particles_.ParticlesBound());
+}
+//=================================================================================================//
 void BaseInnerRelation::resetNeighborhoodCurrentSize()
 {
     parallel_for(
@@ -42,10 +57,12 @@ void BaseInnerRelation::resetNeighborhoodCurrentSize()
 }
 //=================================================================================================//
 BaseContactRelation::BaseContactRelation(SPHBody &sph_body, RealBodyVector contact_sph_bodies)
-    : SPHRelation(sph_body), contact_bodies_(contact_sph_bodies)
+    : SPHRelation(sph_body), is_compact_configuration_(false),
+      contact_bodies_(contact_sph_bodies)
 {
     subscribeToBody();
     contact_configuration_.resize(contact_bodies_.size());
+    compact_contact_configuration_.resize(contact_bodies_.size());
     for (size_t k = 0; k != contact_bodies_.size(); ++k)
     {
         const std::string name = contact_bodies_[k]->getName();
@@ -55,6 +72,23 @@ BaseContactRelation::BaseContactRelation(SPHBody &sph_body, RealBodyVector conta
     }
 }
 //=================================================================================================//
+void BaseContactRelation::useCompactConfiguration()
+{
+    std::cout << "\n Error: the contact relation of " << sph_body_.getName()
+              << " does not build the compact configurations!" << std::endl;
+    std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+    exit(1);
+}
+//=================================================================================================//
+void BaseContactRelation::enableCompactConfiguration()
+{
+    is_compact_configuration_ = true;
+    for (size_t k = 0; k != contact_bodies_.size(); ++k)
+    {
+        compact_contact_configuration_[k].resize(base_particles_.ParticlesBound());
+    }
+}
+//=================================================================================================//
 void BaseContactRelation::resetNeighborhoodCurrentSize()
 {
     for (size_t k = 0; k != contact_bodies_.size(); ++k)
@@ -127,13 +127,20 @@ class BaseInnerRelation : public SPHRelation
 {
   public:
     RealBody *real_body_;
-    ParticleConfiguration inner_configuration_; /**< inner configuration for the neighbor relations. */
+    ParticleConfiguration inner_configuration_;                /**< inner configuration for the neighbor relations. */
+    CompactParticleConfiguration compact_inner_configuration_; /**< inner configuration in compact (CSR) storage. */
     explicit BaseInnerRelation(RealBody &real_body);
     virtual ~BaseInnerRelation() {};
     BaseInnerRelation &getRelation() { return *this; };
+    /** Build the compact configuration, whose views are handed out in inner_configuration_.
+     * Only the relations building the compact configuration accept it. */
+    virtual void useCompactConfiguration();
+    bool isCompactConfiguration() { return is_compact_configuration_; };
 
   protected:
+    bool is_compact_configuration_;
     virtual void resetNeighborhoodCurrentSize();
+    void enableCompactConfiguration();
 };
 
 /**
@@ -143,13 +150,16 @@ class BaseInnerRelation : public SPHRelation
 class BaseContactRelation : public SPHRelation
 {
   protected:
+    bool is_compact_configuration_;
     virtual void resetNeighborhoodCurrentSize();
+    void enableCompactConfiguration();
 
   public:
     RealBodyVector contact_bodies_;
     StdVec<BaseParticles *> contact_particles_;
     StdVec<SPHAdaptation *> contact_adaptations_;
-    StdVec<ParticleConfiguration> contact_configuration_; /**< Configurations for particle interaction between bodies. */
+    StdVec<ParticleConfiguration> contact_configuration_;                /**< Configurations for particle interaction between bodies. */
+    StdVec<CompactParticleConfiguration> compact_contact_configuration_; /**< Contact configurations in compact (CSR) storage. */
 
     BaseContactRelation(SPHBody &sph_body, RealBodyVector contact_bodies);
     BaseContactRelation(SPHBody &sph_body, BodyPartVector contact_body_parts)
@@ -159,6 +169,10 @@ class BaseContactRelation : public SPHRelation
     RealBodyVector getContactBodies() { return contact_bodies_; };
     StdVec<BaseParticles *> getContactParticles() { return contact_particles_; };
     StdVec<SPHAdaptation *> getContactAdaptations() { return contact_adaptations_; };
+    /** Build the compact configurations, whose views are handed out in contact_configuration_.
+     * Only the relations building the compact configurations accept it. */
+    virtual void useCompactConfiguration();
+    bool isCompactConfiguration() { return is_compact_configuration_; };
 };
 } // namespace SPH
 #endif // BASE_BODY_RELATION_H
\ No newline at end of file
@@ -1,4 +1,4 @@
-#include "contact_body_relation.h"
+#include "contact_body_relation.hpp"
 #include "all_particles.h"
 #include "base_particle_dynamics.h"
 #include "cell_linked_list.hpp"
@@ -8,28 +8,7 @@
 namespace SPH
 {
 //=================================================================================================//
-ContactRelation::ContactRelation(SPHBody &sph_body, RealBodyVector contact_bodies)
-    : ContactRelationCrossResolution(sph_body, contact_bodies)
-{
-    for (size_t k = 0; k != contact_bodies_.size(); ++k)
-    {
-        get_contact_neighbors_.push_back(
-            neighbor_builder_contact_ptrs_keeper_.createPtr<NeighborBuilderContact>(
-                sph_body_, *contact_bodies_[k]));
-    }
-}
-//=================================================================================================//
-void ContactRelation::updateConfiguration()
-{
-    resetNeighborhoodCurrentSize();
-    for (size_t k = 0; k != contact_bodies_.size(); ++k)
-    {
-        Mesh &mesh = target_cell_linked_lists_[k]->getMesh();
-        target_cell_linked_lists_[k]->searchNeighborsByMesh(
-            mesh, 0, sph_body_, contact_configuration_[k],
-            *get_search_depths_[k], *get_contact_neighbors_[k]);
-    }
-}
+template class ContactRelationWithBuilder<NeighborBuilderContact>;
 //=================================================================================================//
 ShellSurfaceContactRelation::ShellSurfaceContactRelation(SPHBody &sph_body, RealBodyVector contact_bodies)
     : ContactRelationCrossResolution(sph_body, contact_bodies),
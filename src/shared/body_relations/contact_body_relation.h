@@ -69,21 +69,50 @@ class ContactRelationCrossResolution : public BaseContactRelation
 };
 
 /**
- * @class ContactRelation
+ * @class ContactRelationWithBuilder
  * @brief The relation between a SPH body and its contact SPH bodies
+ * built by the given neighbor builder.
  */
-class ContactRelation : public ContactRelationCrossResolution
+template <class NeighborBuilderType>
+class ContactRelationWithBuilder : public ContactRelationCrossResolution
 {
   protected:
-    UniquePtrsKeeper<NeighborBuilderContact> neighbor_builder_contact_ptrs_keeper_;
+    UniquePtrsKeeper<NeighborBuilderType> neighbor_builder_contact_ptrs_keeper_;
 
   public:
-    ContactRelation(SPHBody &sph_body, RealBodyVector contact_bodies);
-    virtual ~ContactRelation(){};
+    ContactRelationWithBuilder(SPHBody &sph_body, RealBodyVector contact_bodies);
+    virtual ~ContactRelationWithBuilder(){};
+    virtual void useCompactConfiguration() override { enableCompactConfiguration(); };
     virtual void updateConfiguration() override;
 
   protected:
-    StdVec<NeighborBuilderContact *> get_contact_neighbors_;
+    StdVec<NeighborBuilderType *> get_contact_neighbors_;
+};
+
+/**
+ * @class ContactRelation
+ * @brief The relation between a SPH body and its contact SPH bodies
+ */
+class ContactRelation : public ContactRelationWithBuilder<NeighborBuilderContact>
+{
+  public:
+    ContactRelation(SPHBody &sph_body, RealBodyVector contact_bodies)
+        : ContactRelationWithBuilder<NeighborBuilderContact>(sph_body, contact_bodies){};
+    virtual ~ContactRelation(){};
+};
+
+/**
+ * @class ContactRelationWithKernel
+ * @brief The contact relation built with a kernel of concrete type, e.g. KernelWendlandC2CK,
+ * which should be the one constructed from the chosen kernel of each contact pair.
+ */
+template <class KernelType>
+class ContactRelationWithKernel : public ContactRelationWithBuilder<NeighborBuilderContactKernel<KernelType>>
+{
+  public:
+    ContactRelationWithKernel(SPHBody &sph_body, RealBodyVector contact_bodies)
+        : ContactRelationWithBuilder<NeighborBuilderContactKernel<KernelType>>(sph_body, contact_bodies){};
+    virtual ~ContactRelationWithKernel(){};
 };
 
 /**
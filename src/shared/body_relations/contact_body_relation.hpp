@@ -0,0 +1,81 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	contact_body_relation.hpp
+ * @brief 	Here, Functions defined in contact_body_relation.h are detailed.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef CONTACT_BODY_RELATION_HPP
+#define CONTACT_BODY_RELATION_HPP
+
+#include "contact_body_relation.h"
+
+#include "cell_linked_list.hpp"
+#include "neighborhood.hpp"
+
+namespace SPH
+{
+//=================================================================================================//
+template <class NeighborBuilderType>
+ContactRelationWithBuilder<NeighborBuilderType>::
+    ContactRelationWithBuilder(SPHBody &sph_body, RealBodyVector contact_bodies)
+    : ContactRelationCrossResolution(sph_body, contact_bodies)
+{
+    for (size_t k = 0; k != this->contact_bodies_.size(); ++k)
+    {
+        get_contact_neighbors_.push_back(
+            neighbor_builder_contact_ptrs_keeper_.template createPtr<NeighborBuilderType>(
+                this->sph_body_, *this->contact_bodies_[k]));
+    }
+}
+//=================================================================================================//
+template <class NeighborBuilderType>
+void ContactRelationWithBuilder<NeighborBuilderType>::updateConfiguration()
+{
+    if (this->is_compact_configuration_)
+    {
+        for (size_t k = 0; k != this->contact_bodies_.size(); ++k)
+        {
+            Mesh &mesh = this->target_cell_linked_lists_[k]->getMesh();
+            this->target_cell_linked_lists_[k]->searchNeighborsByMesh(
+                mesh, 0, this->base_particles_, this->compact_contact_configuration_[k],
+                *this->get_search_depths_[k], *get_contact_neighbors_[k]);
+            this->compact_contact_configuration_[k].viewNeighborhoods(this->contact_configuration_[k],
+                                                                      this->base_particles_.TotalRealParticles());
+        }
+        return;
+    }
+
+    this->resetNeighborhoodCurrentSize();
+    for (size_t k = 0; k != this->contact_bodies_.size(); ++k)
+    {
+        Mesh &mesh = this->target_cell_linked_lists_[k]->getMesh();
+        this->target_cell_linked_lists_[k]->searchNeighborsByMesh(
+            mesh, 0, this->sph_body_, this->contact_configuration_[k],
+            *this->get_search_depths_[k], *get_contact_neighbors_[k]);
+    }
+}
+//=================================================================================================//
+} // namespace SPH
+#endif // CONTACT_BODY_RELATION_HPP
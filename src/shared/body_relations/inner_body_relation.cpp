@@ -1,4 +1,4 @@
-#include "inner_body_relation.h"
+#include "inner_body_relation.hpp"
 #include "base_particle_dynamics.h"
 #include "base_particles.hpp"
 #include "cell_linked_list.hpp"
@@ -7,17 +7,7 @@
 namespace SPH
 {
 //=================================================================================================//
-InnerRelation::InnerRelation(RealBody &real_body)
-    : BaseInnerRelation(real_body), get_inner_neighbor_(real_body),
-      cell_linked_list_(DynamicCast<CellLinkedList>(this, real_body.getCellLinkedList())) {}
-//=================================================================================================//
-void InnerRelation::updateConfiguration()
-{
-    resetNeighborhoodCurrentSize();
-    Mesh &mesh = cell_linked_list_.getMesh();
-    cell_linked_list_.searchNeighborsByMesh(mesh, 0, sph_body_, inner_configuration_,
-                                            get_single_search_depth_, get_inner_neighbor_);
-}
+template class InnerRelationWithBuilder<NeighborBuilderInner>;
 //=================================================================================================//
 AdaptiveInnerRelation::
     AdaptiveInnerRelation(RealBody &real_body)
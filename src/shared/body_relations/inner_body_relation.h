@@ -34,24 +34,53 @@
 namespace SPH
 {
 /**
- * @class InnerRelation
- * @brief The first concrete relation within a SPH body
+ * @class InnerRelationWithBuilder
+ * @brief The inner relation within a SPH body built by the given neighbor builder.
  */
-class InnerRelation : public BaseInnerRelation
+template <class NeighborBuilderType>
+class InnerRelationWithBuilder : public BaseInnerRelation
 {
   protected:
     SearchDepthSingleResolution get_single_search_depth_;
-    NeighborBuilderInner get_inner_neighbor_;
+    NeighborBuilderType get_inner_neighbor_;
     CellLinkedList &cell_linked_list_;
 
   public:
-    explicit InnerRelation(RealBody &real_body);
-    virtual ~InnerRelation(){};
+    explicit InnerRelationWithBuilder(RealBody &real_body);
+    virtual ~InnerRelationWithBuilder(){};
 
     CellLinkedList &getCellLinkedList() { return cell_linked_list_; };
+    virtual void useCompactConfiguration() override { enableCompactConfiguration(); };
     virtual void updateConfiguration() override;
 };
 
+/**
+ * @class InnerRelation
+ * @brief The first concrete relation within a SPH body
+ */
+class InnerRelation : public InnerRelationWithBuilder<NeighborBuilderInner>
+{
+  public:
+    explicit InnerRelation(RealBody &real_body)
+        : InnerRelationWithBuilder<NeighborBuilderInner>(real_body){};
+    virtual ~InnerRelation(){};
+};
+
+/**
+ * @class InnerRelationWithKernel
+ * @brief The inner relation built with a kernel of concrete type, e.g. KernelWendlandC2CK,
+ * which should be the one constructed from the kernel of the body.
+ * The kernel functions are inlined in the neighbor search.
+ */
+template <class KernelType>
+class InnerRelationWithKernel : public InnerRelationWithBuilder<NeighborBuilderInnerKernel<KernelType>>
+{
+  public:
+    explicit InnerRelationWithKernel(RealBody &real_body)
+        : InnerRelationWithBuilder<NeighborBuilderInnerKernel<KernelType>>(real_body){};
+    virtual ~InnerRelationWithKernel(){};
+};
+
 /**
  * @class AdaptiveInnerRelation
  * @brief The relation within a SPH body with smoothing length adaptation
@@ -109,6 +138,8 @@ class TreeInnerRelation : public InnerRelation
     explicit TreeInnerRelation(RealBody &real_body);
     virtual ~TreeInnerRelation(){};
 
+    /** the tree configuration is not built in compact storage */
+    virtual void useCompactConfiguration() override { BaseInnerRelation::useCompactConfiguration(); };
     virtual void updateConfiguration() override;
 };
 
@@ -0,0 +1,64 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	inner_body_relation.hpp
+ * @brief 	Here, Functions defined in inner_body_relation.h are detailed.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef INNER_BODY_RELATION_HPP
+#define INNER_BODY_RELATION_HPP
+
+#include "inner_body_relation.h"
+
+#include "cell_linked_list.hpp"
+#include "neighborhood.hpp"
+
+namespace SPH
+{
+//=================================================================================================//
+template <class NeighborBuilderType>
+InnerRelationWithBuilder<NeighborBuilderType>::InnerRelationWithBuilder(RealBody &real_body)
+    : BaseInnerRelation(real_body), get_inner_neighbor_(real_body),
+      cell_linked_list_(DynamicCast<CellLinkedList>(this, real_body.getCellLinkedList())) {}
+//=================================================================================================//
+template <class NeighborBuilderType>
+void InnerRelationWithBuilder<NeighborBuilderType>::updateConfiguration()
+{
+    Mesh &mesh = cell_linked_list_.getMesh();
+    if (this->is_compact_configuration_)
+    {
+        cell_linked_list_.searchNeighborsByMesh(mesh, 0, this->base_particles_, this->compact_inner_configuration_,
+                                                get_single_search_depth_, get_inner_neighbor_);
+        this->compact_inner_configuration_.viewNeighborhoods(this->inner_configuration_,
+                                                             this->base_particles_.TotalRealParticles());
+        return;
+    }
+
+    this->resetNeighborhoodCurrentSize();
+    cell_linked_list_.searchNeighborsByMesh(mesh, 0, this->sph_body_, this->inner_configuration_,
+                                            get_single_search_depth_, get_inner_neighbor_);
+}
+//=================================================================================================//
+} // namespace SPH
+#endif // INNER_BODY_RELATION_HPP
@@ -0,0 +1,70 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file    fnv_hash.h
+ * @brief   64-bit FNV-1a hash of byte sequences.
+ * @details Unlike std::hash, the hash value is specified by the algorithm,
+ *          so that it gives the same cache file names on all platforms.
+ * @author	Xiangyu Hu
+ */
+#pragma once
+
+#include <cstdint>
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+namespace SPH
+{
+class FNVHash
+{
+  public:
+    FNVHash() : value_(14695981039346656037ull){};
+    ~FNVHash(){};
+
+    void addBytes(const void *data, size_t size)
+    {
+        const unsigned char *bytes = static_cast<const unsigned char *>(data);
+        for (size_t i = 0; i != size; ++i)
+        {
+            value_ = (value_ ^ bytes[i]) * 1099511628211ull;
+        }
+    };
+    /** only for data types without padding bytes, such as scalars, vectors and matrices */
+    template <typename DataType>
+    void add(const DataType &value) { addBytes(&value, sizeof(DataType)); };
+    void add(const std::string &value) { addBytes(value.data(), value.size()); };
+    void add(const char *value) { add(std::string(value)); };
+
+    uint64_t Value() { return value_; };
+    std::string HexValue()
+    {
+        std::stringstream hex_value;
+        hex_value << std::hex << std::setw(16) << std::setfill('0') << value_;
+        return hex_value.str();
+    };
+
+  protected:
+    uint64_t value_;
+};
+} // namespace SPH
@@ -116,6 +116,12 @@ class UniquePtrKeeper
         return ptr_member_.get();
     };
 
+    /** output the ownership, the keeper is empty afterwards */
+    UniquePtr<BaseType> releasePtr()
+    {
+        return std::move(ptr_member_);
+    };
+
   private:
     UniquePtr<BaseType> ptr_member_;
 };
@@ -202,6 +208,12 @@ class SharedPtrKeeper
         return *ptr_member_.get();
     };
 
+    /** output a shared ownership */
+    SharedPtr<BaseType> getSharedPtr()
+    {
+        return ptr_member_;
+    };
+
   private:
     SharedPtr<BaseType> ptr_member_;
 };
@@ -200,6 +200,7 @@ class MeshVariable : public Entity
     PackageData *Data() { return data_field_; };
     void allocateAllMeshVariableData(const size_t size)
     {
+        delete[] data_field_;
         data_field_ = new PackageData[size];
     }
 
@@ -1,5 +1,7 @@
 #include "base_geometry.h"
 
+#include <algorithm>
+
 namespace SPH
 {
 //=================================================================================================//
@@ -79,6 +81,11 @@ BoundingBox BinaryShapes::findBounds()
 //=================================================================================================//
 bool BinaryShapes::checkContain(const Vecd &pnt, bool BOUNDARY_INCLUDED)
 {
+    if (sub_shape_tree_.isBuilt())
+    {
+        return checkContainBySubShapeTree(pnt);
+    }
+
     bool exist = false;
     bool inside = false;
 
@@ -111,6 +118,34 @@ bool BinaryShapes::checkContain(const Vecd &pnt, bool BOUNDARY_INCLUDED)
     return exist;
 }
 //=================================================================================================//
+bool BinaryShapes::checkContainBySubShapeTree(const Vecd &pnt)
+{
+    // sub-shapes whose bounds do not contain the point change nothing
+    if (!has_subtraction_)
+    {
+        bool exist = false;
+        sub_shape_tree_.visitItemsContaining(
+            pnt, [&](size_t index)
+            {
+                exist = sub_shapes_and_ops_[index].first->checkContain(pnt);
+                return exist; });
+        return exist;
+    }
+
+    // With the boolean operations applied in the order of definition,
+    // the last sub-shape containing the point decides the result.
+    size_t last_containing = sub_shapes_and_ops_.size();
+    sub_shape_tree_.visitItemsContaining(
+        pnt, [&](size_t index)
+        {
+            if ((last_containing == sub_shapes_and_ops_.size() || index > last_containing) &&
+                sub_shapes_and_ops_[index].first->checkContain(pnt))
+                last_containing = index;
+            return false; });
+    return last_containing != sub_shapes_and_ops_.size() &&
+           sub_shapes_and_ops_[last_containing].second == ShapeBooleanOps::add;
+}
+//=================================================================================================//
 Vecd BinaryShapes::findClosestPoint(const Vecd &probe_point)
 {
     // a big positive number
@@ -119,6 +154,27 @@ Vecd BinaryShapes::findClosestPoint(const Vecd &probe_point)
     Vecd pnt_closest = Vecd::Zero();
     Vecd pnt_found = Vecd::Zero();
 
+    if (sub_shape_tree_.isBuilt())
+    {
+        size_t index_closest = 0;
+        sub_shape_tree_.visitNearItems(
+            probe_point,
+            [&](size_t index)
+            {
+                pnt_found = sub_shapes_and_ops_[index].first->findClosestPoint(probe_point);
+                Real dist = (probe_point - pnt_found).norm();
+                // for equal distances, the later sub-shape is taken as in the sequential search
+                if (dist < dist_min || (dist == dist_min && index > index_closest))
+                {
+                    dist_min = dist;
+                    pnt_closest = pnt_found;
+                    index_closest = index;
+                }
+                return dist_min;
+            });
+        return pnt_closest;
+    }
+
     for (auto &sub_shape_and_op : sub_shapes_and_ops_)
     {
         Shape *geometry = sub_shape_and_op.first;
@@ -135,6 +191,32 @@ Vecd BinaryShapes::findClosestPoint(const Vecd &probe_point)
     return pnt_closest;
 }
 //=================================================================================================//
+void BinaryShapes::buildSubShapeTree()
+{
+    StdVec<BoundingBox> sub_shape_bounds;
+    has_subtraction_ = false;
+    for (auto &sub_shape_and_op : sub_shapes_and_ops_)
+    {
+        sub_shape_bounds.push_back(sub_shape_and_op.first->getBounds());
+        has_subtraction_ = has_subtraction_ || sub_shape_and_op.second == ShapeBooleanOps::sub;
+    }
+    sub_shape_tree_.build(sub_shape_bounds);
+}
+//=================================================================================================//
+bool BinaryShapes::hashGeometrySource(FNVHash &hash)
+{
+    hash.add("BinaryShapes");
+    for (auto &sub_shape_and_op : sub_shapes_and_ops_)
+    {
+        hash.add(int(sub_shape_and_op.second));
+        if (!sub_shape_and_op.first->hashGeometrySource(hash))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+//=================================================================================================//
 SubShapeAndOp *BinaryShapes::getSubShapeAndOpByName(const std::string &name)
 {
     for (auto &sub_shape_and_op : sub_shapes_and_ops_)
@@ -169,4 +251,64 @@ size_t BinaryShapes::getSubShapeIndexByName(const std::string &name)
     return MaxSize_t;
 }
 //=================================================================================================//
+void BoundingBoxTree::build(const StdVec<BoundingBox> &item_bounds)
+{
+    clear();
+    if (item_bounds.empty())
+        return;
+
+    // slightly enlarged bounds so that points on the surface are not missed due to round-off
+    StdVec<BoundingBox> enlarged_bounds;
+    for (const BoundingBox &bounds : item_bounds)
+    {
+        Vecd margin = SqrtEps * (bounds.second_ - bounds.first_).cwiseAbs() + Eps * Vecd::Ones();
+        enlarged_bounds.push_back(BoundingBox(bounds.first_ - margin, bounds.second_ + margin));
+    }
+
+    for (size_t i = 0; i != item_bounds.size(); ++i)
+    {
+        items_.push_back(i);
+    }
+    buildNode(enlarged_bounds, 0, items_.size());
+}
+//=================================================================================================//
+size_t BoundingBoxTree::buildNode(const StdVec<BoundingBox> &item_bounds, size_t first_item, size_t last_item)
+{
+    size_t node_index = nodes_.size();
+    nodes_.push_back(TreeNode());
+
+    Vecd lower_bound = item_bounds[items_[first_item]].first_;
+    Vecd upper_bound = item_bounds[items_[first_item]].second_;
+    for (size_t i = first_item + 1; i != last_item; ++i)
+    {
+        lower_bound = lower_bound.cwiseMin(item_bounds[items_[i]].first_);
+        upper_bound = upper_bound.cwiseMax(item_bounds[items_[i]].second_);
+    }
+
+    size_t left_child = 0, right_child = 0;
+    if (last_item - first_item > max_items_in_leaf_)
+    {
+        // split at the median of the box centers along the longest axis
+        int axis = 0;
+        (upper_bound - lower_bound).maxCoeff(&axis);
+        size_t middle_item = (first_item + last_item) / 2;
+        std::nth_element(items_.begin() + first_item, items_.begin() + middle_item, items_.begin() + last_item,
+                         [&](size_t a, size_t b)
+                         {
+                             return item_bounds[a].first_[axis] + item_bounds[a].second_[axis] <
+                                    item_bounds[b].first_[axis] + item_bounds[b].second_[axis];
+                         });
+        left_child = buildNode(item_bounds, first_item, middle_item);
+        right_child = buildNode(item_bounds, middle_item, last_item);
+    }
+    nodes_[node_index] = {BoundingBox(lower_bound, upper_bound), first_item, last_item, left_child, right_child};
+    return node_index;
+}
+//=================================================================================================//
+Real BoundingBoxTree::distanceToBounds(const Vecd &point, const BoundingBox &bounds)
+{
+    Vecd outside = (bounds.first_ - point).cwiseMax(point - bounds.second_).cwiseMax(Vecd::Zero());
+    return outside.norm();
+}
+//=================================================================================================//
 } // namespace SPH
\ No newline at end of file
@@ -31,6 +31,7 @@
 #define BASE_GEOMETRY_H
 
 #include "base_data_package.h"
+#include "fnv_hash.h"
 #include "sphinxsys_containers.h"
 #include <string>
 
@@ -81,6 +82,9 @@ class Shape
     Real findSignedDistance(const Vecd &probe_point);
     /** Normal direction point toward outside of the shape. */
     Vecd findNormalDirection(const Vecd &probe_point);
+    /** Add the source defining the geometry, e.g. parameters or vertices, to a hash identifying the shape.
+     * Returns false if the shape has no such source, and it is then identified by sampling. */
+    virtual bool hashGeometrySource(FNVHash &hash) { return false; };
 
   protected:
     std::string name_;
@@ -89,6 +93,105 @@ class Shape
     virtual BoundingBox findBounds() = 0;
 };
 
+/**
+ * @class BoundingBoxTree
+ * @brief Binary tree of the bounding boxes of a set of items.
+ * A query visits only the items whose bounding boxes are relevant to the probe point.
+ */
+class BoundingBoxTree
+{
+  public:
+    BoundingBoxTree(){};
+    ~BoundingBoxTree(){};
+
+    void build(const StdVec<BoundingBox> &item_bounds);
+    void clear()
+    {
+        nodes_.clear();
+        items_.clear();
+    };
+    bool isBuilt() { return !nodes_.empty(); };
+    /** visit the items whose bounding boxes contain the point, not sorted.
+     * The traversal stops when the function returns true. */
+    template <typename FunctionOnItem>
+    void visitItemsContaining(const Vecd &point, const FunctionOnItem &function)
+    {
+        size_t stack[max_depth_];
+        size_t stack_size = 0;
+        stack[stack_size++] = 0;
+        while (stack_size != 0)
+        {
+            TreeNode &node = nodes_[stack[--stack_size]];
+            if (!node.bounds_.checkContain(point))
+                continue;
+
+            if (node.left_child_ == 0)
+            {
+                for (size_t i = node.first_item_; i != node.last_item_; ++i)
+                {
+                    if (function(items_[i]))
+                        return;
+                }
+            }
+            else
+            {
+                stack[stack_size++] = node.left_child_;
+                stack[stack_size++] = node.right_child_;
+            }
+        }
+    };
+    /** distance to the bounding box, which is a lower bound of the distance to any surface within the box */
+    static Real distanceToBounds(const Vecd &point, const BoundingBox &bounds);
+
+    /** visit the items in the order of nearer bounding boxes first.
+     * The function returns the current minimum distance,
+     * items with bounding boxes further than this distance are skipped. */
+    template <typename FunctionOnItem>
+    void visitNearItems(const Vecd &point, const FunctionOnItem &function)
+    {
+        Real distance_bound = MaxReal;
+        size_t stack[max_depth_];
+        size_t stack_size = 0;
+        stack[stack_size++] = 0;
+        while (stack_size != 0)
+        {
+            const TreeNode &node = nodes_[stack[--stack_size]];
+            if (distanceToBounds(point, node.bounds_) > distance_bound)
+                continue;
+
+            if (node.left_child_ == 0)
+            {
+                for (size_t i = node.first_item_; i != node.last_item_; ++i)
+                {
+                    distance_bound = function(items_[i]);
+                }
+            }
+            else
+            {
+                Real left_distance = distanceToBounds(point, nodes_[node.left_child_].bounds_);
+                Real right_distance = distanceToBounds(point, nodes_[node.right_child_].bounds_);
+                // the nearer child is pushed last so that it is visited first
+                stack[stack_size++] = left_distance < right_distance ? node.right_child_ : node.left_child_;
+                stack[stack_size++] = left_distance < right_distance ? node.left_child_ : node.right_child_;
+            }
+        }
+    };
+
+  protected:
+    struct TreeNode
+    {
+        BoundingBox bounds_;
+        size_t first_item_, last_item_;  /**< range in items_ for leaf nodes */
+        size_t left_child_, right_child_; /**< left_child_ is zero for leaf nodes */
+    };
+    static constexpr size_t max_items_in_leaf_ = 4;
+    static constexpr size_t max_depth_ = 128;
+    StdVec<TreeNode> nodes_; /**< the first node is the root */
+    StdVec<size_t> items_;   /**< item indices ordered by the leaves */
+
+    size_t buildNode(const StdVec<BoundingBox> &item_bounds, size_t first_item, size_t last_item);
+};
+
 using SubShapeAndOp = std::pair<Shape *, ShapeBooleanOps>;
 /**
  * @class BinaryShapes
@@ -110,6 +213,7 @@ class BinaryShapes : public Shape
         Shape *sub_shape = sub_shape_ptrs_keeper_.createPtr<SubShapeType>(std::forward<Args>(args)...);
         SubShapeAndOp sub_shape_and_op(sub_shape, ShapeBooleanOps::add);
         sub_shapes_and_ops_.push_back(sub_shape_and_op);
+        sub_shape_tree_.clear();
     };
 
     template <class SubShapeType, typename... Args>
@@ -118,20 +222,29 @@ class BinaryShapes : public Shape
         Shape *sub_shape = sub_shape_ptrs_keeper_.createPtr<SubShapeType>(std::forward<Args>(args)...);
         SubShapeAndOp sub_shape_and_op(sub_shape, ShapeBooleanOps::sub);
         sub_shapes_and_ops_.push_back(sub_shape_and_op);
+        sub_shape_tree_.clear();
     };
 
     virtual bool isValid() override;
     virtual bool checkContain(const Vecd &pnt, bool BOUNDARY_INCLUDED = true) override;
     virtual Vecd findClosestPoint(const Vecd &probe_point) override;
+    virtual bool hashGeometrySource(FNVHash &hash) override;
     Shape *getSubShapeByName(const std::string &name);
     SubShapeAndOp *getSubShapeAndOpByName(const std::string &name);
     size_t getSubShapeIndexByName(const std::string &name);
+    /** Build a bounding box tree over the sub-shapes after all of them are added,
+     * so that a query only visits the sub-shapes with relevant bounds.
+     * Adding or subtracting a shape afterwards falls back to visiting all sub-shapes. */
+    void buildSubShapeTree();
 
   protected:
     UniquePtrsKeeper<Shape> sub_shape_ptrs_keeper_;
     StdVec<SubShapeAndOp> sub_shapes_and_ops_;
+    BoundingBoxTree sub_shape_tree_;
+    bool has_subtraction_ = false;
 
     virtual BoundingBox findBounds() override;
+    bool checkContainBySubShapeTree(const Vecd &pnt);
 };
 
 /**
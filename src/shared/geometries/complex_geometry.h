@@ -59,8 +59,18 @@ class ComplexShape : public BinaryShapes
     LevelSetShape *defineLevelSetShape(SPHBody &sph_body, const std::string &shape_name, Args &&...args)
     {
         size_t index = getSubShapeIndexByName(shape_name);
+        SharedPtr<Shape> sub_shape_ptr =
+            index == MaxSize_t ? nullptr : SharedPtr<Shape>(sub_shape_ptrs_keeper_[index].releasePtr());
+        if (sub_shape_ptr == nullptr)
+        {
+            std::cout << "\n Error: the level set shape of the sub-shape " << shape_name
+                      << " can not be defined, as it is not added or subtracted to the complex shape "
+                      << getName() << "!" << std::endl;
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            exit(1);
+        }
         LevelSetShape *level_set_shape = sub_shape_ptrs_keeper_[index].createPtr<LevelSetShape>(
-            sph_body, *sub_shapes_and_ops_[index].first, std::forward<Args>(args)...);
+            sph_body, sub_shape_ptr, std::forward<Args>(args)...);
         sub_shapes_and_ops_[index].first = DynamicCast<Shape>(this, level_set_shape);
         return level_set_shape;
     };
@@ -16,6 +16,13 @@ Vecd GeometricShapeBox::findClosestPoint(const Vecd &probe_point)
     return GeometricBox::findClosestPoint(probe_point);
 }
 //=================================================================================================//
+bool GeometricShapeBox::hashGeometrySource(FNVHash &hash)
+{
+    hash.add("GeometricShapeBox");
+    hash.add(halfsize_);
+    return true;
+}
+//=================================================================================================//
 BoundingBox GeometricShapeBox::findBounds()
 {
     return BoundingBox(-halfsize_, halfsize_);
@@ -35,6 +42,14 @@ Vecd GeometricShapeBall::findClosestPoint(const Vecd &probe_point)
     return center_ + GeometricBall::findClosestPoint(probe_point - center_);
 }
 //=================================================================================================//
+bool GeometricShapeBall::hashGeometrySource(FNVHash &hash)
+{
+    hash.add("GeometricShapeBall");
+    hash.add(center_);
+    hash.add(radius_);
+    return true;
+}
+//=================================================================================================//
 BoundingBox GeometricShapeBall::findBounds()
 {
     Vecd shift = radius_ * Vecd::Ones();
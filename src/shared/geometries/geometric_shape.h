@@ -43,6 +43,7 @@ class GeometricShapeBox : public GeometricBox, public Shape
 
     virtual bool checkContain(const Vecd &probe_point, bool BOUNDARY_INCLUDED = true) override;
     virtual Vecd findClosestPoint(const Vecd &probe_point) override;
+    virtual bool hashGeometrySource(FNVHash &hash) override;
 
   protected:
     virtual BoundingBox findBounds() override;
@@ -59,6 +60,7 @@ class GeometricShapeBall : public GeometricBall, public Shape
 
     virtual bool checkContain(const Vecd &probe_point, bool BOUNDARY_INCLUDED = true) override;
     virtual Vecd findClosestPoint(const Vecd &probe_point) override;
+    virtual bool hashGeometrySource(FNVHash &hash) override;
 
   protected:
     virtual BoundingBox findBounds() override;
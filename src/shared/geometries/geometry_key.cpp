@@ -0,0 +1,57 @@
+#include "geometry_key.h"
+
+#include "adaptation.h"
+#include "base_geometry.h"
+#include "base_kernel.h"
+#include "mesh_iterators.hpp"
+
+namespace SPH
+{
+//=================================================================================================//
+/** bounds the samples to about a million in 2D and a quarter of a million in 3D */
+constexpr int max_key_samples_per_axis = Dimensions == 2 ? 1024 : 64;
+//=================================================================================================//
+std::string generateGeometryKey(Shape &shape, SPHAdaptation &sph_adaptation, Real sample_spacing)
+{
+    BoundingBox bounds = shape.getBounds();
+    FNVHash geometry_hash;
+    if (!shape.hashGeometrySource(geometry_hash))
+    {
+        geometry_hash = FNVHash(); // discard the partial source of a composite shape
+        Vecd extent = bounds.second_ - bounds.first_;
+        Arrayi number_of_samples = (extent.array() / sample_spacing).ceil().cast<int>() + 1;
+        number_of_samples = number_of_samples.min(max_key_samples_per_axis).max(2);
+        Vecd spacing = (extent.array() / (number_of_samples - 1).cast<Real>()).matrix();
+        // the samples are hashed slab by slab, so that only one slab is kept in memory
+        Arrayi slab_samples = number_of_samples;
+        slab_samples[Dimensions - 1] = 1;
+        StdLargeVec<Real> signed_distances(slab_samples.prod());
+        for (int slab = 0; slab != number_of_samples[Dimensions - 1]; ++slab)
+        {
+            Arrayi lower = Arrayi::Zero();
+            lower[Dimensions - 1] = slab;
+            mesh_parallel_for(MeshRange(lower, lower + slab_samples),
+                              [&](const Arrayi &sample_index)
+                              {
+                                  size_t linear_index = 0;
+                                  for (int k = Dimensions - 2; k >= 0; --k)
+                                      linear_index = linear_index * slab_samples[k] + sample_index[k];
+                                  Vecd sample_point = bounds.first_ + spacing.cwiseProduct(sample_index.cast<Real>().matrix());
+                                  signed_distances[linear_index] = shape.findSignedDistance(sample_point);
+                              });
+            geometry_hash.addBytes(signed_distances.data(), signed_distances.size() * sizeof(Real));
+        }
+    }
+
+    std::stringstream key;
+    key << std::hexfloat << shape.getName() << ";geometry:" << geometry_hash.HexValue()
+        << ";bounds:" << bounds.first_.transpose() << "," << bounds.second_.transpose()
+        << ";adaptation:spacing:" << sph_adaptation.ReferenceSpacing()
+        << ",h:" << sph_adaptation.ReferenceSmoothingLength()
+        << ",levels:" << std::dec << sph_adaptation.LocalRefinementLevel()
+        << ";kernel:" << sph_adaptation.getKernel()->Name()
+        << ";real:" << sizeof(Real);
+    return key.str();
+}
+//=================================================================================================//
+} // namespace SPH
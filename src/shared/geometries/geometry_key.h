@@ -0,0 +1,48 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file    geometry_key.h
+ * @brief   Key of a shape and a particle resolution for caching the data generated from them.
+ * @author	Xiangyu Hu
+ */
+#pragma once
+
+#include "base_data_type.h"
+
+#include <string>
+
+namespace SPH
+{
+class Shape;
+class SPHAdaptation;
+/**
+ * The shape is identified by its geometric source if available, otherwise by the signed distances
+ * sampled within its bounds with the given spacing, which should be as fine as the cached data.
+ * The number of samples along each axis is bounded, so that the key is obtained much faster than
+ * the cached data for large shapes, but for which geometric changes much smaller
+ * than the resulting sample spacing may not change the key.
+ * Shapes used for caching should therefore provide their geometric source if possible.
+ * The adaptation and the kernel are included, so that the key gives the same data for the same resolution.
+ */
+std::string generateGeometryKey(Shape &shape, SPHAdaptation &sph_adaptation, Real sample_spacing);
+} // namespace SPH
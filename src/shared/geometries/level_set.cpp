@@ -9,7 +9,8 @@ namespace SPH
 MultilevelLevelSet::MultilevelLevelSet(
     BoundingBox tentative_bounds, Real reference_data_spacing, size_t total_levels,
     Shape &shape, SPHAdaptation &sph_adaptation)
-    : BaseMeshField("LevelSet_" + shape.getName()), kernel_(*sph_adaptation.getKernel()), shape_(shape), total_levels_(total_levels)
+    : BaseMeshField("LevelSet_" + shape.getName()), kernel_(*sph_adaptation.getKernel()), shape_(shape),
+      tentative_bounds_(tentative_bounds), total_levels_(total_levels)
 {
     Real global_h_ratio = sph_adaptation.ReferenceSpacing() / reference_data_spacing;
     global_h_ratio_vec_.push_back(global_h_ratio);
@@ -30,7 +31,8 @@ MultilevelLevelSet::MultilevelLevelSet(
 //=================================================================================================//
 MultilevelLevelSet::MultilevelLevelSet(
     BoundingBox tentative_bounds, MeshWithGridDataPackagesType* coarse_data, Shape &shape, SPHAdaptation &sph_adaptation)
-    : BaseMeshField("LevelSet_" + shape.getName()), kernel_(*sph_adaptation.getKernel()), shape_(shape), total_levels_(1)
+    : BaseMeshField("LevelSet_" + shape.getName()), kernel_(*sph_adaptation.getKernel()), shape_(shape),
+      tentative_bounds_(tentative_bounds), total_levels_(1)
 {
     Real reference_data_spacing = coarse_data->DataSpacing() * 0.5;
     Real global_h_ratio = sph_adaptation.ReferenceSpacing() / reference_data_spacing;
@@ -42,6 +44,68 @@ MultilevelLevelSet::MultilevelLevelSet(
     correct_topology = makeUnique<CorrectTopology>(*mesh_data_set_.back(), kernel_, global_h_ratio_vec_.back());
 }
 //=================================================================================================//
+MultilevelLevelSet::MultilevelLevelSet(
+    BinaryColumnFile &binary_file, Shape &shape, SPHAdaptation &sph_adaptation)
+    : BaseMeshField("LevelSet_" + shape.getName()), kernel_(*sph_adaptation.getKernel()), shape_(shape),
+      total_levels_(*binary_file.getColumnData<size_t>("TotalLevels", 1))
+{
+    const Vecd *bounds = binary_file.getColumnData<Vecd>("TentativeBounds", 2);
+    tentative_bounds_ = BoundingBox(bounds[0], bounds[1]);
+    const Real *data_spacing = binary_file.getColumnData<Real>("DataSpacing", total_levels_);
+
+    for (size_t level = 0; level < total_levels_; ++level)
+    {
+        global_h_ratio_vec_.push_back(sph_adaptation.ReferenceSpacing() / data_spacing[level]);
+        mesh_data_set_.push_back(
+            mesh_data_ptr_vector_keeper_
+                .template createPtr<MeshWithGridDataPackagesType>(tentative_bounds_, data_spacing[level], 4));
+
+        RegisterMeshVariable register_mesh_variable;
+        register_mesh_variable.exec(mesh_data_set_[level]);
+        registerProbes(level);
+    }
+    readFromBinaryFile(binary_file);
+
+    clean_interface = makeUnique<CleanInterface>(*mesh_data_set_.back(), kernel_, global_h_ratio_vec_.back());
+    correct_topology = makeUnique<CorrectTopology>(*mesh_data_set_.back(), kernel_, global_h_ratio_vec_.back());
+}
+//=================================================================================================//
+void MultilevelLevelSet::writeToBinaryFile(const std::string &filefullpath, const std::string &key)
+{
+    BinaryColumnFile binary_file;
+    binary_file.addColumn("Key", key.data(), key.size());
+    binary_file.addColumn("TotalLevels", &total_levels_, 1);
+    Vecd bounds[2] = {tentative_bounds_.first_, tentative_bounds_.second_};
+    binary_file.addColumn("TentativeBounds", bounds, 2);
+
+    StdVec<Real> data_spacing;
+    StdVec<StdVec<size_t>> index_data_buffers(total_levels_);
+    StdVec<StdVec<int>> meta_data_buffers(total_levels_);
+    for (size_t level = 0; level != total_levels_; ++level)
+    {
+        data_spacing.push_back(mesh_data_set_[level]->DataSpacing());
+        mesh_data_set_[level]->addPackagesToBinaryFile(binary_file, levelPrefix(level),
+                                                     index_data_buffers[level], meta_data_buffers[level]);
+    }
+    binary_file.addColumn("DataSpacing", data_spacing.data(), total_levels_);
+    binary_file.writeToFile(filefullpath);
+}
+//=================================================================================================//
+void MultilevelLevelSet::readFromBinaryFile(BinaryColumnFile &binary_file)
+{
+    if (*binary_file.getColumnData<size_t>("TotalLevels", 1) != total_levels_)
+    {
+        std::cout << "\n Error: the number of levels in the binary file does not match the level set!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+
+    for (size_t level = 0; level != total_levels_; ++level)
+    {
+        mesh_data_set_[level]->readPackagesFromBinaryFile(binary_file, levelPrefix(level));
+    }
+}
+//=================================================================================================//
 void MultilevelLevelSet::initializeLevel(size_t level, Real reference_data_spacing, Real global_h_ratio, BoundingBox tentative_bounds, MeshWithGridDataPackagesType* coarse_data)
 {
     mesh_data_set_.push_back(
@@ -47,6 +47,8 @@ class MultilevelLevelSet : public BaseMeshField
   public:
     MultilevelLevelSet(BoundingBox tentative_bounds, Real reference_data_spacing, size_t total_levels, Shape &shape, SPHAdaptation &sph_adaptation);
     MultilevelLevelSet(BoundingBox tentative_bounds, MeshWithGridDataPackagesType* coarse_data, Shape &shape, SPHAdaptation &sph_adaptation);
+    /** reconstruct the level set from a binary file written by writeToBinaryFile without computing the data. */
+    MultilevelLevelSet(BinaryColumnFile &binary_file, Shape &shape, SPHAdaptation &sph_adaptation);
     ~MultilevelLevelSet(){};
 
     void cleanInterface(Real small_shift_factor);
@@ -60,6 +62,10 @@ class MultilevelLevelSet : public BaseMeshField
     Vecd probeKernelGradientIntegral(const Vecd &position, Real h_ratio = 1.0);
     Vecd probeKernelGradientIntegral(const Vecd &position);
     StdVec<MeshWithGridDataPackagesType *> getMeshLevels() { return mesh_data_set_; };
+    /** write all levels with a key string which identifies how the level set is generated. */
+    void writeToBinaryFile(const std::string &filefullpath, const std::string &key);
+    /** replace the data of all levels by those in the binary file. */
+    void readFromBinaryFile(BinaryColumnFile &binary_file);
 
     void writeMeshFieldToPlt(std::ofstream &output_file) override
     {
@@ -73,9 +79,11 @@ class MultilevelLevelSet : public BaseMeshField
 
     void initializeLevel(size_t level, Real reference_data_spacing, Real global_h_ratio, BoundingBox tentative_bounds, MeshWithGridDataPackagesType* coarse_data = nullptr);
     void registerProbes(size_t level);
+    std::string levelPrefix(size_t level) { return "Level" + std::to_string(level) + "/"; };
 
     Kernel &kernel_;
     Shape &shape_;                           /**< the geometry is described by the level set. */
+    BoundingBox tentative_bounds_;
     size_t total_levels_;                    /**< level 0 is the coarsest */
     StdVec<Real> global_h_ratio_vec_;
     StdVec<MeshWithGridDataPackagesType *> mesh_data_set_;
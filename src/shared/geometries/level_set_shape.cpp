@@ -1,6 +1,7 @@
 #include "level_set_shape.h"
 
 #include "base_body.h"
+#include "geometry_key.h"
 #include "io_all.h"
 #include "sph_system.h"
 
@@ -8,50 +9,161 @@ namespace SPH
 {
 //=================================================================================================//
 LevelSetShape::
-    LevelSetShape(Shape &shape, SharedPtr<SPHAdaptation> sph_adaptation, Real refinement_ratio)
-    : Shape(shape.getName()), sph_adaptation_(sph_adaptation),
-      level_set_(*level_set_keeper_.movePtr(sph_adaptation->createLevelSet(shape, refinement_ratio)))
+    LevelSetShape(SharedPtr<Shape> shape_ptr, SharedPtr<SPHAdaptation> sph_adaptation, Real refinement_ratio)
+    : Shape(shape_ptr->getName()), sph_adaptation_(sph_adaptation), source_shape_ptr_(shape_ptr),
+      level_set_adaptation_(*sph_adaptation), refinement_ratio_(refinement_ratio),
+      is_cache_refreshed_(false), level_set_(nullptr)
 {
-    bounding_box_ = shape.getBounds();
+    bounding_box_ = shape_ptr->getBounds();
     is_bounds_found_ = true;
+    is_source_hashed_ = shape_ptr->hashGeometrySource(source_hash_);
+    generateLevelSet();
 }
 //=================================================================================================//
-LevelSetShape::LevelSetShape(SPHBody &sph_body, Shape &shape, Real refinement_ratio)
-    : Shape(shape.getName()),
-      level_set_(*level_set_keeper_.movePtr(
-          sph_body.getSPHAdaptation().createLevelSet(shape, refinement_ratio)))
+LevelSetShape::LevelSetShape(SPHBody &sph_body, SharedPtr<Shape> shape_ptr, Real refinement_ratio)
+    : Shape(shape_ptr->getName()), source_shape_ptr_(shape_ptr),
+      level_set_adaptation_(sph_body.getSPHAdaptation()), refinement_ratio_(refinement_ratio),
+      cache_folder_(sph_body.getSPHSystem().LevelSetCaching()
+                        ? sph_body.getSPHSystem().getIOEnvironment().level_set_cache_folder_
+                        : ""),
+      is_cache_refreshed_(sph_body.getSPHSystem().LevelSetCacheRefreshing()), level_set_(nullptr)
 {
-    bounding_box_ = shape.getBounds();
+    bounding_box_ = shape_ptr->getBounds();
     is_bounds_found_ = true;
+    is_source_hashed_ = shape_ptr->hashGeometrySource(source_hash_);
+    if (cache_folder_.empty())
+    {
+        generateLevelSet();
+        return;
+    }
+
+    // sampled up to the finest level set spacing if the shape has no geometric source
+    std::stringstream key;
+    key << generateGeometryKey(*shape_ptr, level_set_adaptation_, level_set_adaptation_.MinimumSpacing() / refinement_ratio)
+        << ";refinement_ratio:" << std::hexfloat << refinement_ratio;
+    cache_key_ = key.str();
+}
+//=================================================================================================//
+MultilevelLevelSet &LevelSetShape::generateLevelSet()
+{
+    std::lock_guard<std::mutex> lock(level_set_generation_);
+    MultilevelLevelSet *level_set = level_set_.load(std::memory_order_relaxed);
+    if (level_set != nullptr)
+    {
+        return *level_set;
+    }
+
+    BinaryColumnFile binary_file;
+    if (!cache_folder_.empty() && !is_cache_refreshed_ && loadCacheFile(binary_file))
+    {
+        level_set = level_set_keeper_.movePtr(
+            makeUnique<MultilevelLevelSet>(binary_file, *source_shape_ptr_, level_set_adaptation_));
+    }
+    else
+    {
+        level_set = level_set_keeper_.movePtr(
+            level_set_adaptation_.createLevelSet(*source_shape_ptr_, refinement_ratio_));
+        for (auto &operation : deferred_operations_)
+        {
+            operation(*level_set);
+        }
+        if (!cache_folder_.empty())
+        {
+            writeCacheFile(*level_set);
+        }
+    }
+    deferred_operations_.clear();
+    level_set_.store(level_set, std::memory_order_release);
+    return *level_set;
+}
+//=================================================================================================//
+std::string LevelSetShape::CacheFilePath()
+{
+    FNVHash key_hash;
+    key_hash.add(cache_key_ + operations_);
+    return cache_folder_ + "/" + getName() + "_" + key_hash.HexValue() + ".bin";
+}
+//=================================================================================================//
+bool LevelSetShape::loadCacheFile(BinaryColumnFile &binary_file)
+{
+    std::string filefullpath = CacheFilePath();
+    if (!fs::exists(filefullpath))
+    {
+        return false;
+    }
+
+    binary_file.loadFile(filefullpath);
+    BinaryColumnFile::Column *key = binary_file.findColumn("Key");
+    return key != nullptr && std::string(key->data_, key->number_of_values_) == cache_key_ + operations_;
+}
+//=================================================================================================//
+void LevelSetShape::writeCacheFile(MultilevelLevelSet &level_set)
+{
+    if (!fs::exists(cache_folder_))
+    {
+        fs::create_directory(cache_folder_);
+    }
+    level_set.writeToBinaryFile(CacheFilePath(), cache_key_ + operations_);
 }
 //=================================================================================================//
 void LevelSetShape::writeLevelSet(SPHSystem &sph_system)
 {
-    MeshRecordingToPlt write_level_set_to_plt(sph_system, level_set_);
+    MeshRecordingToPlt write_level_set_to_plt(sph_system, getLevelSet());
     write_level_set_to_plt.writeToFile(0);
 }
 //=================================================================================================//
+void LevelSetShape::applyOperation(const std::string &operation, Real small_shift_factor,
+                                   const std::function<void(MultilevelLevelSet &)> &function)
+{
+    std::stringstream operation_key;
+    operation_key << ";" << operation << ":" << std::hexfloat << small_shift_factor;
+    operations_ += operation_key.str();
+    // operations requested before the deferred generation are carried out and cached with it
+    if (level_set_.load(std::memory_order_acquire) == nullptr && !cache_folder_.empty())
+    {
+        deferred_operations_.push_back(function);
+        return;
+    }
+    function(getLevelSet());
+}
+//=================================================================================================//
 LevelSetShape *LevelSetShape::cleanLevelSet(Real small_shift_factor)
 {
-    level_set_.cleanInterface(small_shift_factor);
+    applyOperation("clean", small_shift_factor, [=](MultilevelLevelSet &level_set)
+                   { level_set.cleanInterface(small_shift_factor); });
     return this;
 }
 //=================================================================================================//
 LevelSetShape *LevelSetShape::correctLevelSetSign(Real small_shift_factor)
 {
-    level_set_.correctTopology(small_shift_factor);
+    applyOperation("correct", small_shift_factor, [=](MultilevelLevelSet &level_set)
+                   { level_set.correctTopology(small_shift_factor); });
     return this;
 }
 //=================================================================================================//
+bool LevelSetShape::hashGeometrySource(FNVHash &hash)
+{
+    if (!is_source_hashed_)
+    {
+        return false;
+    }
+    hash.add("LevelSetShape");
+    hash.add(refinement_ratio_);
+    hash.add(operations_);
+    hash.add(source_hash_.Value());
+    return true;
+}
+//=================================================================================================//
 bool LevelSetShape::checkContain(const Vecd &probe_point, bool BOUNDARY_INCLUDED)
 {
-    return level_set_.probeSignedDistance(probe_point) < 0.0 ? true : false;
+    return getLevelSet().probeSignedDistance(probe_point) < 0.0 ? true : false;
 }
 //=================================================================================================//
 Vecd LevelSetShape::findClosestPoint(const Vecd &probe_point)
 {
-    Real phi = level_set_.probeSignedDistance(probe_point);
-    Vecd normal = level_set_.probeNormalDirection(probe_point);
+    MultilevelLevelSet &level_set = getLevelSet();
+    Real phi = level_set.probeSignedDistance(probe_point);
+    Vecd normal = level_set.probeNormalDirection(probe_point);
     return probe_point - phi * normal;
 }
 //=================================================================================================//
@@ -68,17 +180,17 @@ BoundingBox LevelSetShape::findBounds()
 //=================================================================================================//
 Vecd LevelSetShape::findLevelSetGradient(const Vecd &probe_point)
 {
-    return level_set_.probeLevelSetGradient(probe_point);
+    return getLevelSet().probeLevelSetGradient(probe_point);
 }
 //=================================================================================================//
 Real LevelSetShape::computeKernelIntegral(const Vecd &probe_point, Real h_ratio)
 {
-    return level_set_.probeKernelIntegral(probe_point, h_ratio);
+    return getLevelSet().probeKernelIntegral(probe_point, h_ratio);
 }
 //=================================================================================================//
 Vecd LevelSetShape::computeKernelGradientIntegral(const Vecd &probe_point, Real h_ratio)
 {
-    return level_set_.probeKernelGradientIntegral(probe_point, h_ratio);
+    return getLevelSet().probeKernelGradientIntegral(probe_point, h_ratio);
 }
 //=================================================================================================//
 } // namespace SPH
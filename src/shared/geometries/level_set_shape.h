@@ -32,6 +32,9 @@
 #include "base_geometry.h"
 #include "level_set.h"
 
+#include <atomic>
+#include <functional>
+#include <mutex>
 #include <string>
 
 namespace SPH
@@ -41,22 +44,41 @@ class SPHSystem;
 /**
  * @class LevelSetShape
  * @brief A shape using level set to define geometry
+ * @details When level set caching is enabled in the SPH system, the generation of the level set
+ * is deferred to its first use, so that cleaning and sign correction requested before are known.
+ * The final level set is then reloaded from the cache file or generated and saved,
+ * with a key from the shape geometry, the adaptation, the kernel and all the requested operations.
+ * The source shape, which is used by the level set during its lifetime, is given with its shared ownership
+ * at construction, or with an empty owner if it is kept alive by the caller.
+ * The level set is generated once and published by a pointer, which is then used directly by the probes.
  */
 class LevelSetShape : public Shape
 {
   private:
     UniquePtrKeeper<MultilevelLevelSet> level_set_keeper_;
     SharedPtr<SPHAdaptation> sph_adaptation_;
+    SharedPtr<Shape> source_shape_ptr_; /**< shared ownership of the source shape used by the level set */
+    SPHAdaptation &level_set_adaptation_;
+    Real refinement_ratio_;
+    std::string cache_folder_; /**< empty if the level set is not cached */
+    bool is_cache_refreshed_;  /**< regenerate the level set and overwrite the cache file */
+    std::string cache_key_;    /**< records how the level set is generated and post-processed */
+    std::string operations_;   /**< the cleaning and sign correction operations carried out */
+    FNVHash source_hash_;      /**< hash of the source shape taken at construction */
+    bool is_source_hashed_;
+    StdVec<std::function<void(MultilevelLevelSet &)>> deferred_operations_;
+    std::mutex level_set_generation_;
 
   public:
     /** refinement_ratio is between body reference resolution and level set resolution */
-    LevelSetShape(Shape &shape, SharedPtr<SPHAdaptation> sph_adaptation, Real refinement_ratio = 1.0);
-    LevelSetShape(SPHBody &sph_body, Shape &shape, Real refinement_ratio = 1.0);
+    LevelSetShape(SharedPtr<Shape> shape_ptr, SharedPtr<SPHAdaptation> sph_adaptation, Real refinement_ratio = 1.0);
+    LevelSetShape(SPHBody &sph_body, SharedPtr<Shape> shape_ptr, Real refinement_ratio = 1.0);
 
     virtual ~LevelSetShape(){};
 
     virtual bool checkContain(const Vecd &probe_point, bool BOUNDARY_INCLUDED = true) override;
     virtual Vecd findClosestPoint(const Vecd &probe_point) override;
+    virtual bool hashGeometrySource(FNVHash &hash) override;
 
     Vecd findLevelSetGradient(const Vecd &probe_point);
     Real computeKernelIntegral(const Vecd &probe_point, Real h_ratio = 1.0);
@@ -66,11 +88,23 @@ class LevelSetShape : public Shape
     /** required to build level set from triangular mesh in stl file format. */
     LevelSetShape *correctLevelSetSign(Real small_shift_factor = 1.0);
     void writeLevelSet(SPHSystem &sph_system);
+    /** the level set is generated or reloaded from the cache at the first call */
+    MultilevelLevelSet &getLevelSet()
+    {
+        MultilevelLevelSet *level_set = level_set_.load(std::memory_order_acquire);
+        return level_set != nullptr ? *level_set : generateLevelSet();
+    };
 
   protected:
-    MultilevelLevelSet &level_set_; /**< narrow bounded level set mesh. */
+    std::atomic<MultilevelLevelSet *> level_set_; /**< narrow bounded level set mesh, published once generated. */
 
     virtual BoundingBox findBounds() override;
+    MultilevelLevelSet &generateLevelSet();
+    void applyOperation(const std::string &operation, Real small_shift_factor,
+                        const std::function<void(MultilevelLevelSet &)> &function);
+    std::string CacheFilePath();
+    bool loadCacheFile(BinaryColumnFile &binary_file);
+    void writeCacheFile(MultilevelLevelSet &level_set);
 };
 } // namespace SPH
 #endif // LEVEL_SET_SHAPE_H
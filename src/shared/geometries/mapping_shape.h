@@ -57,6 +57,12 @@ class InverseShape : public BaseShapeType
     {
         return !BaseShapeType::checkContain(probe_point);
     };
+
+    virtual bool hashGeometrySource(FNVHash &hash) override
+    {
+        hash.add("InverseShape");
+        return BaseShapeType::hashGeometrySource(hash);
+    };
 };
 
 /**
@@ -102,6 +108,13 @@ class ExtrudeShape : public BaseShapeType
         closest_point += BaseShapeType::checkContain(probe_point) ? shift : -shift;
         return closest_point;
     };
+
+    virtual bool hashGeometrySource(FNVHash &hash) override
+    {
+        hash.add("ExtrudeShape");
+        hash.add(thickness_);
+        return BaseShapeType::hashGeometrySource(hash);
+    };
 };
 } // namespace SPH
 
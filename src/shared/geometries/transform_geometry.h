@@ -92,6 +92,15 @@ class TransformShape : public TransformGeometry<ShapeType>
         return TransformGeometry<ShapeType>::findClosestPoint(probe_point);
     };
 
+    virtual bool hashGeometrySource(FNVHash &hash) override
+    {
+        hash.add("TransformShape");
+        hash.add(this->transform_.shiftFrameStationToBase(Vecd::Zero()));
+        for (int i = 0; i != Dimensions; ++i)
+            hash.add(this->transform_.xformFrameVecToBase(Vecd::Unit(i)));
+        return ShapeType::hashGeometrySource(hash);
+    };
+
   protected:
     // Returns the AABB of the rotated underlying shape's AABB
     // It is not the tight fit AABB of the underlying shape
@@ -23,6 +23,81 @@ bool BaseIO::isBodyIncluded(const SPHBodyVector &bodies, SPHBody *sph_body)
     return result != bodies.end() ? true : false;
 }
 //=============================================================================================//
+BackgroundWriter::BackgroundWriter(size_t max_queue_depth)
+    : max_queue_depth_(SMAX(max_queue_depth, size_t(1))), is_writing_(false), is_terminated_(false),
+      writing_thread_(&BackgroundWriter::runTasks, this) {}
+//=============================================================================================//
+BackgroundWriter::~BackgroundWriter()
+{
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        is_terminated_ = true;
+    }
+    task_available_.notify_one();
+    writing_thread_.join();
+    if (task_exception_ != nullptr)
+    {
+        std::cout << "\n Error: a background writing task has failed and the exception is not handled!" << std::endl;
+    }
+}
+//=============================================================================================//
+void BackgroundWriter::push(std::function<void()> task)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    task_finished_.wait(lock, [&]
+                        { return tasks_.size() < max_queue_depth_; });
+    tasks_.push_back(std::move(task));
+    task_available_.notify_one();
+}
+//=============================================================================================//
+void BackgroundWriter::flush()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    task_finished_.wait(lock, [&]
+                        { return tasks_.empty() && !is_writing_; });
+    if (task_exception_ != nullptr)
+    {
+        std::exception_ptr task_exception = task_exception_;
+        task_exception_ = nullptr;
+        std::rethrow_exception(task_exception);
+    }
+}
+//=============================================================================================//
+void BackgroundWriter::runTasks()
+{
+    while (true)
+    {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            task_available_.wait(lock, [&]
+                                 { return !tasks_.empty() || is_terminated_; });
+            if (tasks_.empty())
+                return; // terminated and all tasks finished
+
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+            is_writing_ = true;
+        }
+        std::exception_ptr task_exception = nullptr;
+        try
+        {
+            task();
+        }
+        catch (...)
+        {
+            task_exception = std::current_exception();
+        }
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            is_writing_ = false;
+            if (task_exception_ == nullptr)
+                task_exception_ = task_exception;
+        }
+        task_finished_.notify_all();
+    }
+}
+//=============================================================================================//
 BodyStatesRecording::BodyStatesRecording(SPHSystem &sph_system)
     : BaseIO(sph_system), bodies_(sph_system.getRealBodies()),
       state_recording_(sph_system_.StateRecording()) {}
@@ -52,7 +127,7 @@ void BodyStatesRecording::writeToFile(size_t iteration_step)
 RestartIO::RestartIO(SPHSystem &sph_system)
     : BaseIO(sph_system), bodies_(sph_system.getRealBodies()),
       overall_file_path_(io_environment_.restart_folder_ + "/Restart_time_"),
-      prepare_variable_to_restart_()
+      restart_format_(RestartFormat::xml), prepare_variable_to_restart_()
 {
     for (size_t i = 0; i < bodies_.size(); ++i)
     {
@@ -73,14 +148,22 @@ void RestartIO::writeToFile(size_t iteration_step)
 
     for (size_t i = 0; i < bodies_.size(); ++i)
     {
-        std::string filefullpath = file_names_[i] + padValueWithZeros(iteration_step) + ".xml";
+        std::string filefullpath = file_names_[i] + padValueWithZeros(iteration_step) +
+                                   (restart_format_ == RestartFormat::binary ? ".bin" : ".xml");
 
         if (fs::exists(filefullpath))
         {
             fs::remove(filefullpath);
         }
         BaseParticles &base_particles = bodies_[i]->getBaseParticles();
-        base_particles.writeParticlesToXmlForRestart(filefullpath);
+        if (restart_format_ == RestartFormat::binary)
+        {
+            base_particles.writeParticlesToBinaryForRestart(filefullpath);
+        }
+        else
+        {
+            base_particles.writeParticlesToXmlForRestart(filefullpath);
+        }
     }
 }
 //=============================================================================================//
@@ -106,7 +189,8 @@ void RestartIO::readFromFile(size_t restart_step)
 {
     for (size_t i = 0; i < bodies_.size(); ++i)
     {
-        std::string filefullpath = file_names_[i] + padValueWithZeros(restart_step) + ".xml";
+        std::string filefullpath = file_names_[i] + padValueWithZeros(restart_step) +
+                                   (restart_format_ == RestartFormat::binary ? ".bin" : ".xml");
 
         if (!fs::exists(filefullpath))
         {
@@ -115,7 +199,14 @@ void RestartIO::readFromFile(size_t restart_step)
             exit(1);
         }
         BaseParticles &base_particles = bodies_[i]->getBaseParticles();
-        base_particles.readParticlesFromXmlForRestart(filefullpath);
+        if (restart_format_ == RestartFormat::binary)
+        {
+            base_particles.readParticlesFromBinaryForRestart(filefullpath);
+        }
+        else
+        {
+            base_particles.readParticlesFromXmlForRestart(filefullpath);
+        }
     }
 }
 //=============================================================================================//
@@ -36,10 +36,14 @@
 #include "sphinxsys_containers.h"
 #include "xml_engine.h"
 
+#include <condition_variable>
+#include <deque>
+#include <exception>
 #include <filesystem>
 #include <fstream>
 #include <iomanip>
 #include <sstream>
+#include <thread>
 namespace fs = std::filesystem;
 
 namespace SPH
@@ -90,6 +94,37 @@ class BaseIO
     };
 };
 
+/**
+ * @class BackgroundWriter
+ * @brief Run writing tasks one after another on a background thread.
+ * @details The queue depth is bounded so that the memory of pending snapshots is limited.
+ * Pushing a task blocks while the queue is full.
+ * All pending tasks are finished before destruction.
+ * The first exception thrown by a task is kept and rethrown by flush().
+ */
+class BackgroundWriter
+{
+  public:
+    explicit BackgroundWriter(size_t max_queue_depth);
+    ~BackgroundWriter();
+    void push(std::function<void()> task);
+    /** wait until all pushed tasks are finished and rethrow the exception of a failed task */
+    void flush();
+
+  protected:
+    size_t max_queue_depth_;
+    std::deque<std::function<void()>> tasks_;
+    bool is_writing_;
+    bool is_terminated_;
+    std::exception_ptr task_exception_;
+    std::mutex mutex_;
+    std::condition_variable task_available_;
+    std::condition_variable task_finished_;
+    std::thread writing_thread_;
+
+    void runTasks();
+};
+
 /**
  * @class BodyStatesRecording
  * @brief base class for write body states.
@@ -172,9 +207,16 @@ class BodyStatesRecording : public BaseIO
     UniquePtrsKeeper<BaseDynamics<void>> derived_variables_keeper_;
 };
 
+/** XML restart files are readable, binary ones are fast for large bodies. */
+enum class RestartFormat
+{
+    xml,
+    binary
+};
+
 /**
  * @class RestartIO
- * @brief Write and read the restart files in XML format.
+ * @brief Write and read the restart files in XML or binary format.
  */
 class RestartIO : public BaseIO
 {
@@ -182,6 +224,7 @@ class RestartIO : public BaseIO
     SPHBodyVector bodies_;
     std::string overall_file_path_;
     StdVec<std::string> file_names_;
+    RestartFormat restart_format_;
     OperationOnDataAssemble<ParticleVariables, prepareVariablesToWrite> prepare_variable_to_restart_;
 
     Real readRestartTime(size_t restart_step);
@@ -189,6 +232,7 @@ class RestartIO : public BaseIO
   public:
     RestartIO(SPHSystem &sph_system);
     virtual ~RestartIO() {};
+    void setRestartFormat(RestartFormat restart_format) { restart_format_ = restart_format; };
 
     virtual void writeToFile(size_t iteration_step = 0) override;
 
@@ -9,7 +9,8 @@ namespace SPH
 IOEnvironment::IOEnvironment(SPHSystem &sph_system, bool delete_output)
     : sph_system_(sph_system),
       input_folder_("./input"), output_folder_("./output"),
-      restart_folder_("./restart"), reload_folder_("./reload")
+      restart_folder_("./restart"), reload_folder_("./reload"),
+      level_set_cache_folder_("./level_set_cache")
 {
     if (!fs::exists(input_folder_))
     {
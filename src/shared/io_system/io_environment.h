@@ -58,6 +58,7 @@ class IOEnvironment
     std::string output_folder_;
     std::string restart_folder_;
     std::string reload_folder_;
+    std::string level_set_cache_folder_; /**< created only when level set caching is used */
 
     explicit IOEnvironment(SPHSystem &sph_system, bool delete_output = true);
     virtual ~IOEnvironment(){};
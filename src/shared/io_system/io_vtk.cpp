@@ -5,17 +5,113 @@
 
 #include "io_vtk.hpp"
 
+#ifdef ZLIB_AVAILABLE
+#include <zlib.h>
+#endif
+
 namespace SPH
 {
 //=============================================================================================//
+VtkAppendedData::VtkAppendedData(bool is_compressed) : is_compressed_(is_compressed) {}
+//=============================================================================================//
+std::string VtkAppendedData::FileAttributes()
+{
+    std::string attributes = "header_type=\"UInt64\"";
+    if (is_compressed_)
+        attributes += " compressor=\"vtkZLibDataCompressor\"";
+    return attributes;
+}
+//=============================================================================================//
+size_t VtkAppendedData::appendBytes(const char *data, size_t size)
+{
+    size_t offset = buffer_.size();
+    if (!is_compressed_)
+    {
+        uint64_t header = size;
+        buffer_.append(reinterpret_cast<const char *>(&header), sizeof(uint64_t));
+        buffer_.append(data, size);
+        return offset;
+    }
+#ifdef ZLIB_AVAILABLE
+    // header: number of blocks, block size, size of the last partial block and compressed sizes
+    size_t number_of_blocks = (size + block_size_ - 1) / block_size_;
+    StdVec<std::string> compressed_blocks(number_of_blocks);
+    StdVec<int> compression_results(number_of_blocks, Z_OK);
+    parallel_for(
+        IndexRange(0, number_of_blocks),
+        [&](const IndexRange &r)
+        {
+            for (size_t k = r.begin(); k != r.end(); ++k)
+            {
+                uLong source_size = SMIN(block_size_, size - k * block_size_);
+                uLongf compressed_size = compressBound(source_size);
+                compressed_blocks[k].resize(compressed_size);
+                compression_results[k] =
+                    compress2(reinterpret_cast<Bytef *>(&compressed_blocks[k][0]), &compressed_size,
+                              reinterpret_cast<const Bytef *>(data + k * block_size_), source_size, Z_BEST_SPEED);
+                compressed_blocks[k].resize(compressed_size);
+            }
+        },
+        ap);
+    for (size_t k = 0; k != number_of_blocks; ++k)
+    {
+        if (compression_results[k] != Z_OK)
+        {
+            throw std::runtime_error("VtkAppendedData: zlib compression failed with error code " +
+                                     std::to_string(compression_results[k]) + "!");
+        }
+    }
+
+    StdVec<uint64_t> header(3 + number_of_blocks);
+    header[0] = number_of_blocks;
+    header[1] = block_size_;
+    header[2] = size % block_size_;
+    for (size_t k = 0; k != number_of_blocks; ++k)
+    {
+        header[3 + k] = compressed_blocks[k].size();
+    }
+    buffer_.append(reinterpret_cast<const char *>(header.data()), header.size() * sizeof(uint64_t));
+    for (size_t k = 0; k != number_of_blocks; ++k)
+    {
+        buffer_.append(compressed_blocks[k]);
+    }
+#endif
+    return offset;
+}
+//=============================================================================================//
+void VtkAppendedData::writeDataArrayHeader(std::ostream &output_stream, const std::string &name,
+                                           const std::string &type, size_t components, size_t offset)
+{
+    output_stream << "    <DataArray Name=\"" << name << "\" type=\"" << type
+                  << "\" NumberOfComponents=\"" << components
+                  << "\" format=\"appended\" offset=\"" << offset << "\"/>\n";
+}
+//=============================================================================================//
+void VtkAppendedData::writeAppendedSection(std::ostream &output_stream)
+{
+    output_stream << " <AppendedData encoding=\"raw\">\n_";
+    output_stream.write(buffer_.data(), buffer_.size());
+    output_stream << "\n </AppendedData>\n";
+}
+//=============================================================================================//
+void BodyStatesRecordingToVtp::setDataFormat(VtkDataFormat data_format)
+{
+    data_format_ = data_format;
+#ifndef ZLIB_AVAILABLE
+    if (data_format_ == VtkDataFormat::compressed)
+    {
+        std::cout << "\n Warning: zlib is not available, binary vtp output is used instead!" << std::endl;
+        data_format_ = VtkDataFormat::binary;
+    }
+#endif
+}
+//=============================================================================================//
 void BodyStatesRecordingToVtp::writeWithFileName(const std::string &sequence)
 {
     for (SPHBody *body : bodies_)
     {
         if (body->checkNewlyUpdated())
         {
-            BaseParticles &base_particles = body->getBaseParticles();
-
             if (state_recording_)
             {
                 std::string filefullpath = io_environment_.output_folder_ + "/" + body->getName() + "_" + sequence + ".vtp";
@@ -23,65 +119,234 @@ void BodyStatesRecordingToVtp::writeWithFileName(const std::string &sequence)
                 {
                     fs::remove(filefullpath);
                 }
-                std::ofstream out_file(filefullpath.c_str(), std::ios::trunc);
-                // begin of the XML file
-                out_file << "<?xml version=\"1.0\"?>\n";
-                out_file << "<VTKFile type=\"PolyData\" version=\"0.1\" byte_order=\"LittleEndian\">\n";
-                out_file << " <PolyData>\n";
-
-                size_t total_real_particles = base_particles.TotalRealParticles();
-                out_file << "  <Piece Name =\"" << body->getName() << "\" NumberOfPoints=\"" << total_real_particles
-                         << "\" NumberOfVerts=\"" << total_real_particles << "\">\n";
-
-                // write current/final particle positions first
-                out_file << "   <Points>\n";
-                out_file << "    <DataArray Name=\"Position\" type=\"Float32\"  NumberOfComponents=\"3\" Format=\"ascii\">\n";
-                out_file << "    ";
-                for (size_t i = 0; i != total_real_particles; ++i)
+
+                if (background_writer_ != nullptr)
                 {
-                    Vec3d particle_position = upgradeToVec3d(base_particles.ParticlePositions()[i]);
-                    out_file << particle_position[0] << " " << particle_position[1] << " " << particle_position[2] << " ";
+                    SharedPtr<VtpSnapshot> snapshot = makeShared<VtpSnapshot>(*body, data_format_);
+                    background_writer_->push([snapshot, filefullpath]()
+                                             { snapshot->writeToFile(filefullpath); });
                 }
-                out_file << std::endl;
-                out_file << "    </DataArray>\n";
-                out_file << "   </Points>\n";
-
-                // write header of particles data
-                out_file << "   <PointData  Vectors=\"vector\">\n";
-                writeParticlesToVtk(out_file, base_particles);
-                out_file << "   </PointData>\n";
-
-                // write empty cells
-                out_file << "   <Verts>\n";
-                out_file << "    <DataArray type=\"Int32\"  Name=\"connectivity\"  Format=\"ascii\">\n";
-                out_file << "    ";
-                for (size_t i = 0; i != total_real_particles; ++i)
+                else if (data_format_ != VtkDataFormat::ascii)
                 {
-                    out_file << i << " ";
+                    VtpSnapshot(*body, data_format_).writeToFile(filefullpath);
                 }
-                out_file << std::endl;
-                out_file << "    </DataArray>\n";
-                out_file << "    <DataArray type=\"Int32\"  Name=\"offsets\"  Format=\"ascii\">\n";
-                out_file << "    ";
-                for (size_t i = 0; i != total_real_particles; ++i)
+                else
                 {
-                    out_file << i + 1 << " ";
+                    writeAsciiToFile(filefullpath, *body);
                 }
-                out_file << std::endl;
-                out_file << "    </DataArray>\n";
-                out_file << "   </Verts>\n";
-
-                out_file << "  </Piece>\n";
-                out_file << " </PolyData>\n";
-                out_file << "</VTKFile>\n";
-
-                out_file.close();
             }
         }
         body->setNotNewlyUpdated();
     }
 }
 //=============================================================================================//
+void BodyStatesRecordingToVtp::writeAsciiToFile(const std::string &filefullpath, SPHBody &body)
+{
+    BaseParticles &base_particles = body.getBaseParticles();
+    std::ofstream out_file(filefullpath.c_str(), std::ios::trunc);
+    // begin of the XML file
+    out_file << "<?xml version=\"1.0\"?>\n";
+    out_file << "<VTKFile type=\"PolyData\" version=\"0.1\" byte_order=\"LittleEndian\">\n";
+    out_file << " <PolyData>\n";
+
+    size_t total_real_particles = base_particles.TotalRealParticles();
+    out_file << "  <Piece Name =\"" << body.getName() << "\" NumberOfPoints=\"" << total_real_particles
+             << "\" NumberOfVerts=\"" << total_real_particles << "\">\n";
+
+    // write current/final particle positions first
+    out_file << "   <Points>\n";
+    out_file << "    <DataArray Name=\"Position\" type=\"Float32\"  NumberOfComponents=\"3\" Format=\"ascii\">\n";
+    out_file << "    ";
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        Vec3d particle_position = upgradeToVec3d(base_particles.ParticlePositions()[i]);
+        out_file << particle_position[0] << " " << particle_position[1] << " " << particle_position[2] << " ";
+    }
+    out_file << std::endl;
+    out_file << "    </DataArray>\n";
+    out_file << "   </Points>\n";
+
+    // write header of particles data
+    out_file << "   <PointData  Vectors=\"vector\">\n";
+    writeParticlesToVtk(out_file, base_particles);
+    out_file << "   </PointData>\n";
+
+    // write empty cells
+    out_file << "   <Verts>\n";
+    out_file << "    <DataArray type=\"Int32\"  Name=\"connectivity\"  Format=\"ascii\">\n";
+    out_file << "    ";
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        out_file << i << " ";
+    }
+    out_file << std::endl;
+    out_file << "    </DataArray>\n";
+    out_file << "    <DataArray type=\"Int32\"  Name=\"offsets\"  Format=\"ascii\">\n";
+    out_file << "    ";
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        out_file << i + 1 << " ";
+    }
+    out_file << std::endl;
+    out_file << "    </DataArray>\n";
+    out_file << "   </Verts>\n";
+
+    out_file << "  </Piece>\n";
+    out_file << " </PolyData>\n";
+    out_file << "</VTKFile>\n";
+
+    out_file.close();
+}
+//=============================================================================================//
+VtpSnapshot::VtpSnapshot(SPHBody &body, VtkDataFormat data_format)
+    : body_name_(body.getName()),
+      total_real_particles_(body.getBaseParticles().TotalRealParticles()),
+      data_format_(data_format)
+{
+    // ascii output keeps the precision and the layout of the synchronous writer
+    if (data_format_ == VtkDataFormat::ascii)
+    {
+        convertParticleStates<double, int64_t>(body.getBaseParticles());
+    }
+    else
+    {
+        convertParticleStates<float, int32_t>(body.getBaseParticles());
+    }
+}
+//=============================================================================================//
+void VtpSnapshot::writeDataArray(std::ostream &output_stream, const DataArray &data_array,
+                                 VtkAppendedData *appended_data)
+{
+    if (appended_data != nullptr)
+    {
+        size_t offset = appended_data->appendBytes(data_array.bytes_.data(), data_array.bytes_.size());
+        appended_data->writeDataArrayHeader(output_stream, data_array.name_, data_array.type_,
+                                            data_array.components_, offset);
+        return;
+    }
+
+    output_stream << data_array.ascii_header_;
+    output_stream << "    ";
+    size_t number_of_values = total_real_particles_ * data_array.components_;
+    if (data_array.type_ == "Int64")
+    {
+        const int64_t *values = reinterpret_cast<const int64_t *>(data_array.bytes_.data());
+        for (size_t i = 0; i != number_of_values; ++i)
+            output_stream << values[i] << " ";
+    }
+    else if (&data_array == &position_)
+    {
+        // positions are written with the default format before any fixed-point value
+        const double *values = reinterpret_cast<const double *>(data_array.bytes_.data());
+        for (size_t i = 0; i != number_of_values; ++i)
+            output_stream << values[i] << " ";
+    }
+    else
+    {
+        const double *values = reinterpret_cast<const double *>(data_array.bytes_.data());
+        for (size_t i = 0; i != number_of_values; ++i)
+            output_stream << std::fixed << std::setprecision(9) << values[i] << " ";
+    }
+    output_stream << std::endl;
+    output_stream << "    </DataArray>\n";
+}
+//=============================================================================================//
+void VtpSnapshot::writeToFile(const std::string &filefullpath)
+{
+    UniquePtr<VtkAppendedData> appended_data;
+    if (data_format_ != VtkDataFormat::ascii)
+    {
+        appended_data = makeUnique<VtkAppendedData>(data_format_ == VtkDataFormat::compressed);
+    }
+
+    std::ostringstream xml_stream;
+    xml_stream << "<?xml version=\"1.0\"?>\n";
+    // the UInt64 headers of the appended data require version 1.0
+    xml_stream << "<VTKFile type=\"PolyData\" version=\"" << (appended_data != nullptr ? "1.0" : "0.1")
+               << "\" byte_order=\"LittleEndian\"";
+    if (appended_data != nullptr)
+    {
+        xml_stream << " " << appended_data->FileAttributes();
+    }
+    xml_stream << ">\n";
+    xml_stream << " <PolyData>\n";
+    xml_stream << "  <Piece Name =\"" << body_name_ << "\" NumberOfPoints=\"" << total_real_particles_
+               << "\" NumberOfVerts=\"" << total_real_particles_ << "\">\n";
+
+    // write current/final particle positions first
+    xml_stream << "   <Points>\n";
+    writeDataArray(xml_stream, position_, appended_data.get());
+    xml_stream << "   </Points>\n";
+
+    xml_stream << "   <PointData  Vectors=\"vector\">\n";
+    for (const DataArray &data_array : point_data_)
+    {
+        writeDataArray(xml_stream, data_array, appended_data.get());
+    }
+    xml_stream << "   </PointData>\n";
+
+    // write empty cells
+    xml_stream << "   <Verts>\n";
+    DataArray connectivity, offsets;
+    if (appended_data != nullptr)
+    {
+        convertDataArray<int32_t>(
+            connectivity, "connectivity", 1, [&](size_t i, int32_t *values)
+            { values[0] = int32_t(i); });
+        convertDataArray<int32_t>(
+            offsets, "offsets", 1, [&](size_t i, int32_t *values)
+            { values[0] = int32_t(i + 1); });
+    }
+    else
+    {
+        convertDataArray<int64_t>(
+            connectivity, "connectivity", 1, [&](size_t i, int64_t *values)
+            { values[0] = int64_t(i); });
+        convertDataArray<int64_t>(
+            offsets, "offsets", 1, [&](size_t i, int64_t *values)
+            { values[0] = int64_t(i + 1); });
+    }
+    connectivity.ascii_header_ = "    <DataArray type=\"Int32\"  Name=\"connectivity\"  Format=\"ascii\">\n";
+    offsets.ascii_header_ = "    <DataArray type=\"Int32\"  Name=\"offsets\"  Format=\"ascii\">\n";
+    writeDataArray(xml_stream, connectivity, appended_data.get());
+    writeDataArray(xml_stream, offsets, appended_data.get());
+    xml_stream << "   </Verts>\n";
+
+    xml_stream << "  </Piece>\n";
+    xml_stream << " </PolyData>\n";
+
+    std::ofstream out_file(filefullpath.c_str(), std::ios::trunc | std::ios::binary);
+    if (!out_file.is_open())
+    {
+        throw std::runtime_error("VtpSnapshot: cannot open " + filefullpath + " for writing!");
+    }
+    const std::string xml_content = xml_stream.str();
+    out_file.write(xml_content.data(), xml_content.size());
+    if (appended_data != nullptr)
+    {
+        appended_data->writeAppendedSection(out_file);
+    }
+    out_file << "</VTKFile>\n";
+    out_file.close();
+    if (out_file.fail())
+    {
+        throw std::runtime_error("VtpSnapshot: failed writing " + filefullpath + "!");
+    }
+}
+//=============================================================================================//
+void BodyStatesRecordingToVtp::setAsynchronous(size_t max_queue_depth)
+{
+    background_writer_ = makeUnique<BackgroundWriter>(SMAX(max_queue_depth, size_t(1)));
+}
+//=============================================================================================//
+void BodyStatesRecordingToVtp::flush()
+{
+    if (background_writer_ != nullptr)
+    {
+        background_writer_->flush();
+    }
+}
+//=============================================================================================//
 void BodyStatesRecordingToVtpString::writeWithFileName(const std::string &sequence)
 {
     for (SPHBody *body : bodies_)
@@ -157,6 +422,7 @@ void WriteToVtpIfVelocityOutOfBound::writeWithFileName(const std::string &sequen
     if (out_of_bound_)
     {
         BodyStatesRecordingToVtp::writeWithFileName(sequence);
+        flush();
         std::cout << "\n Velocity is out of bound at iteration step " << sequence
                   << "\n The body states have been outputted and the simulation terminates here. \n";
     }
@@ -35,6 +35,84 @@ using VtuStringData = std::map<std::string, std::string>;
 
 namespace SPH
 {
+/** Encoding of the data arrays in VTK XML files. */
+enum class VtkDataFormat
+{
+    ascii,
+    binary,
+    compressed
+};
+
+/**
+ * @class VtkAppendedData
+ * @brief Raw binary data arrays, optionally zlib compressed,
+ * for the appended data section of a VTK XML file.
+ * @details Each data array is converted and assembled in memory and
+ * the whole section is written at once. The headers are UInt64.
+ * A failure of the compression throws instead of writing a corrupt block.
+ */
+class VtkAppendedData
+{
+  public:
+    explicit VtkAppendedData(bool is_compressed);
+    ~VtkAppendedData(){};
+    /** attributes for the VTKFile element */
+    std::string FileAttributes();
+    /** returns the offset of the appended bytes */
+    size_t appendBytes(const char *data, size_t size);
+    void writeDataArrayHeader(std::ostream &output_stream, const std::string &name,
+                              const std::string &type, size_t components, size_t offset);
+    void writeAppendedSection(std::ostream &output_stream);
+
+  protected:
+    /** uncompressed size of a compressed block */
+    static constexpr size_t block_size_ = 1 << 20;
+    bool is_compressed_;
+    std::string buffer_;
+};
+
+/**
+ * @class VtpSnapshot
+ * @brief Copy of the particle states of a body to be written into a vtp file.
+ * @details The positions and the variables to write are converted into Float32 or Int32 arrays
+ * (double and 64-bit integers for ascii output) in parallel, so that the file can be formatted and written later,
+ * e.g. on a background thread, while the particle states continue evolving.
+ * The snapshot is used for the binary, compressed and asynchronous output.
+ * Its ascii output is identical to that of the streaming writer of BodyStatesRecordingToVtp.
+ * Writing throws if the file cannot be written.
+ */
+class VtpSnapshot
+{
+    struct DataArray
+    {
+        std::string name_;
+        std::string type_;
+        size_t components_;
+        StdLargeVec<char> bytes_;
+        std::string ascii_header_;
+    };
+
+  public:
+    VtpSnapshot(SPHBody &body, VtkDataFormat data_format);
+    ~VtpSnapshot(){};
+    void writeToFile(const std::string &filefullpath);
+
+  protected:
+    std::string body_name_;
+    size_t total_real_particles_;
+    VtkDataFormat data_format_;
+    DataArray position_;
+    StdVec<DataArray> point_data_;
+
+    template <typename OutputType, class ConvertFunction>
+    void convertDataArray(DataArray &data_array, const std::string &name, size_t components,
+                          const ConvertFunction &convert);
+    template <typename RealType, typename IntegerType>
+    void convertParticleStates(BaseParticles &particles);
+    void writeDataArray(std::ostream &output_stream, const DataArray &data_array,
+                        VtkAppendedData *appended_data);
+};
+
 /**
  * @class BodyStatesRecordingToVtp
  * @brief  Write files for bodies
@@ -43,12 +121,27 @@ namespace SPH
 class BodyStatesRecordingToVtp : public BodyStatesRecording
 {
   public:
-    BodyStatesRecordingToVtp(SPHBody &body) : BodyStatesRecording(body){};
-    BodyStatesRecordingToVtp(SPHSystem &sph_system) : BodyStatesRecording(sph_system){};
+    BodyStatesRecordingToVtp(SPHBody &body)
+        : BodyStatesRecording(body), data_format_(VtkDataFormat::ascii){};
+    BodyStatesRecordingToVtp(SPHSystem &sph_system)
+        : BodyStatesRecording(sph_system), data_format_(VtkDataFormat::ascii){};
     virtual ~BodyStatesRecordingToVtp(){};
+    /** Binary and compressed data are written in appended raw encoding.
+     *  Compressed output falls back to binary if zlib is not available. */
+    void setDataFormat(VtkDataFormat data_format);
+    /** Take snapshots of the states and write the files on a background thread.
+     *  At most max_queue_depth snapshots are pending, further writing waits.
+     *  Pending files are finished by flush() or on destruction.
+     *  A failure of writing is rethrown by flush(). */
+    void setAsynchronous(size_t max_queue_depth = 2);
+    void flush();
 
   protected:
+    VtkDataFormat data_format_;
+    UniquePtr<BackgroundWriter> background_writer_;
     virtual void writeWithFileName(const std::string &sequence) override;
+    /** synchronous ascii output streamed directly from the particle states */
+    void writeAsciiToFile(const std::string &filefullpath, SPHBody &body);
     template <typename OutStreamType>
     void writeParticlesToVtk(OutStreamType &output_stream, BaseParticles &particles);
 };
@@ -5,6 +5,117 @@
 
 namespace SPH
 {
+//=============================================================================================//
+template <typename OutputType, class ConvertFunction>
+void VtpSnapshot::convertDataArray(DataArray &data_array, const std::string &name, size_t components,
+                                   const ConvertFunction &convert)
+{
+    data_array.name_ = name;
+    data_array.type_ = std::is_same<OutputType, float>::value     ? "Float32"
+                       : std::is_same<OutputType, double>::value  ? "Float64"
+                       : std::is_same<OutputType, int64_t>::value ? "Int64"
+                                                                  : "Int32";
+    data_array.components_ = components;
+    data_array.bytes_.resize(total_real_particles_ * components * sizeof(OutputType));
+    OutputType *data = reinterpret_cast<OutputType *>(data_array.bytes_.data());
+    particle_for(par, IndexRange(0, total_real_particles_),
+                 [&](size_t i)
+                 { convert(i, data + i * components); });
+}
+//=============================================================================================//
+template <typename RealType, typename IntegerType>
+void VtpSnapshot::convertParticleStates(BaseParticles &particles)
+{
+    ParticleVariables &variables_to_write = particles.VariablesToWrite();
+    auto ascii_header = [](const std::string &name, const std::string &attributes)
+    { return "    <DataArray Name=\"" + name + "\" " + attributes + " Format=\"ascii\">\n"; };
+
+    Vecd *pos = particles.ParticlePositions();
+    convertDataArray<RealType>(
+        position_, "Position", 3, [&](size_t i, RealType *values)
+        {
+            Vec3d particle_position = upgradeToVec3d(pos[i]);
+            for (int k = 0; k != 3; ++k)
+                values[k] = RealType(particle_position[k]); });
+    position_.ascii_header_ = ascii_header("Position", "type=\"Float32\"  NumberOfComponents=\"3\"");
+
+    // sorted particles ID
+    point_data_.emplace_back();
+    convertDataArray<IntegerType>(
+        point_data_.back(), "SortedParticle_ID", 1, [&](size_t i, IntegerType *values)
+        { values[0] = IntegerType(i); });
+    point_data_.back().ascii_header_ = ascii_header("SortedParticle_ID", "type=\"Int32\"");
+
+    // particle IDs
+    constexpr int type_index_UnsignedInt = DataTypeIndex<UnsignedInt>::value;
+    for (DiscreteVariable<UnsignedInt> *variable : std::get<type_index_UnsignedInt>(variables_to_write))
+    {
+        UnsignedInt *data_field = variable->Data();
+        point_data_.emplace_back();
+        convertDataArray<IntegerType>(
+            point_data_.back(), variable->Name(), 1, [&](size_t i, IntegerType *values)
+            { values[0] = IntegerType(data_field[i]); });
+        point_data_.back().ascii_header_ = ascii_header(variable->Name(), "type=\"Int32\"");
+    }
+
+    // integers
+    constexpr int type_index_int = DataTypeIndex<int>::value;
+    for (DiscreteVariable<int> *variable : std::get<type_index_int>(variables_to_write))
+    {
+        int *data_field = variable->Data();
+        point_data_.emplace_back();
+        convertDataArray<IntegerType>(
+            point_data_.back(), variable->Name(), 1, [&](size_t i, IntegerType *values)
+            { values[0] = IntegerType(data_field[i]); });
+        point_data_.back().ascii_header_ = ascii_header(variable->Name(), "type=\"Int32\"");
+    }
+
+    // scalars
+    constexpr int type_index_Real = DataTypeIndex<Real>::value;
+    for (DiscreteVariable<Real> *variable : std::get<type_index_Real>(variables_to_write))
+    {
+        Real *data_field = variable->Data();
+        point_data_.emplace_back();
+        convertDataArray<RealType>(
+            point_data_.back(), variable->Name(), 1, [&](size_t i, RealType *values)
+            { values[0] = RealType(data_field[i]); });
+        point_data_.back().ascii_header_ = ascii_header(variable->Name(), "type=\"Float32\"");
+    }
+
+    // vectors
+    constexpr int type_index_Vecd = DataTypeIndex<Vecd>::value;
+    for (DiscreteVariable<Vecd> *variable : std::get<type_index_Vecd>(variables_to_write))
+    {
+        Vecd *data_field = variable->Data();
+        point_data_.emplace_back();
+        convertDataArray<RealType>(
+            point_data_.back(), variable->Name(), 3, [&](size_t i, RealType *values)
+            {
+                Vec3d vector_value = upgradeToVec3d(data_field[i]);
+                for (int k = 0; k != 3; ++k)
+                    values[k] = RealType(vector_value[k]); });
+        point_data_.back().ascii_header_ =
+            ascii_header(variable->Name(), "type=\"Float32\"  NumberOfComponents=\"3\"");
+    }
+
+    // matrices
+    constexpr int type_index_Matd = DataTypeIndex<Matd>::value;
+    for (DiscreteVariable<Matd> *variable : std::get<type_index_Matd>(variables_to_write))
+    {
+        Matd *data_field = variable->Data();
+        point_data_.emplace_back();
+        convertDataArray<RealType>(
+            point_data_.back(), variable->Name(), 9, [&](size_t i, RealType *values)
+            {
+                Mat3d matrix_value = upgradeToMat3d(data_field[i]);
+                for (int k = 0; k != 3; ++k)
+                    for (int l = 0; l != 3; ++l)
+                        values[3 * k + l] = RealType(matrix_value(l, k)); });
+        point_data_.back().ascii_header_ =
+            ascii_header(variable->Name(), "type= \"Float32\"  NumberOfComponents=\"9\"");
+    }
+}
+
 //=============================================================================================//
 template <typename OutStreamType>
 void BodyStatesRecordingToVtp::writeParticlesToVtk(OutStreamType &output_stream, BaseParticles &particles)
@@ -46,6 +46,14 @@ using namespace std::placeholders;
 
 namespace SPH
 {
+/** Tags of the space-filling curves for ordering cells and particles. */
+class MortonOrder
+{
+};
+class HilbertOrder
+{
+};
+
 /**
  * @class Mesh
  * @brief Base class for all structured meshes which may be grid or cell based.
@@ -106,18 +114,88 @@ class Mesh
                mesh_index[2];
     };
     /** converts mesh index into a Morton order.
-     * Interleave a 10 bit number in 32 bits, fill one bit and leave the other 2 as zeros
+     * The keys use all bits of UnsignedInt, i.e. 32 (2D) or 21 (3D) bits per axis
+     * for 64-bit UnsignedInt, so that large meshes are ordered without truncation.
      * https://stackoverflow.com/questions/18529057/
      * produce-interleaving-bit-patterns-morton-keys-for-32-bit-64-bit-and-128bit
      */
     size_t transferMeshIndexToMortonOrder(const Array2i &mesh_index) const
     {
-        return MortonCode(mesh_index[0]) | (MortonCode(mesh_index[1]) << 1);
+        return MortonCode2d(mesh_index[0]) | (MortonCode2d(mesh_index[1]) << 1);
     };
 
     size_t transferMeshIndexToMortonOrder(const Array3i &mesh_index) const
     {
-        return MortonCode(mesh_index[0]) | (MortonCode(mesh_index[1]) << 1) | (MortonCode(mesh_index[2]) << 2);
+        return MortonCode3d(mesh_index[0]) | (MortonCode3d(mesh_index[1]) << 1) | (MortonCode3d(mesh_index[2]) << 2);
+    };
+    /** converts mesh index into a Hilbert order, which has better locality than Morton order
+     * because consecutive cells along the curve are always face neighbors.
+     * Skilling's transpose algorithm, see AIP Conference Proceedings 707, 381 (2004).
+     */
+    template <int N>
+    size_t transferMeshIndexToHilbertOrder(const Eigen::Array<int, N, 1> &mesh_index) const
+    {
+        constexpr int axis_bits = SequenceKeyBits / N;
+        uint64_t x[N];
+        for (int i = 0; i != N; ++i)
+            x[i] = uint64_t(mesh_index[i]) & ((uint64_t(1) << axis_bits) - 1);
+
+        // inverse undo excess work
+        for (uint64_t q = uint64_t(1) << (axis_bits - 1); q > 1; q >>= 1)
+        {
+            uint64_t p = q - 1;
+            for (int i = 0; i != N; ++i)
+            {
+                if (x[i] & q)
+                {
+                    x[0] ^= p;
+                }
+                else
+                {
+                    uint64_t t = (x[0] ^ x[i]) & p;
+                    x[0] ^= t;
+                    x[i] ^= t;
+                }
+            }
+        }
+        // Gray encode
+        for (int i = 1; i != N; ++i)
+            x[i] ^= x[i - 1];
+        uint64_t t = 0;
+        for (uint64_t q = uint64_t(1) << (axis_bits - 1); q > 1; q >>= 1)
+        {
+            if (x[N - 1] & q)
+                t ^= q - 1;
+        }
+        for (int i = 0; i != N; ++i)
+            x[i] ^= t;
+        // interleave the transposed bits with the first axis as most significant
+        uint64_t key = 0;
+        for (int bit = axis_bits - 1; bit >= 0; --bit)
+        {
+            for (int i = 0; i != N; ++i)
+                key = (key << 1) | ((x[i] >> bit) & 1);
+        }
+        return key;
+    };
+
+    /** number of cells along each axis which are distinguished by the sequence keys,
+     *  limited to what an int cell index can hold */
+    static constexpr int SequenceCellsPerAxis()
+    {
+        return int(uint64_t(1) << std::min(SequenceKeyBits / Dimensions, 30));
+    };
+
+    template <int N>
+    size_t transferMeshIndexToSequence(const MortonOrder &, const Eigen::Array<int, N, 1> &mesh_index) const
+    {
+        return transferMeshIndexToMortonOrder(mesh_index);
+    };
+
+    template <int N>
+    size_t transferMeshIndexToSequence(const HilbertOrder &, const Eigen::Array<int, N, 1> &mesh_index) const
+    {
+        return transferMeshIndexToHilbertOrder(mesh_index);
     };
 
   protected:
@@ -127,14 +205,28 @@ class Mesh
     Arrayi all_grid_points_; /**< number of grid points by dimension */
     Arrayi all_cells_;       /**< number of cells by dimension */
 
-    size_t MortonCode(const size_t &i) const
+    /** number of bits available for a sequence key */
+    static constexpr int SequenceKeyBits = 8 * sizeof(UnsignedInt);
+    /** spread a 32 (or 16 for 32-bit keys) bit number by leaving one zero bit in between */
+    size_t MortonCode2d(const size_t &i) const
+    {
+        uint64_t x = uint64_t(i) & ((uint64_t(1) << (SequenceKeyBits / 2)) - 1);
+        x = (x | x << 16) & 0x0000ffff0000ffff;
+        x = (x | x << 8) & 0x00ff00ff00ff00ff;
+        x = (x | x << 4) & 0x0f0f0f0f0f0f0f0f;
+        x = (x | x << 2) & 0x3333333333333333;
+        x = (x | x << 1) & 0x5555555555555555;
+        return x;
+    };
+    /** spread a 21 (or 10 for 32-bit keys) bit number by leaving two zero bits in between */
+    size_t MortonCode3d(const size_t &i) const
     {
-        size_t x = i;
-        x &= 0x3ff;
-        x = (x | x << 16) & 0x30000ff;
-        x = (x | x << 8) & 0x300f00f;
-        x = (x | x << 4) & 0x30c30c3;
-        x = (x | x << 2) & 0x9249249;
+        uint64_t x = uint64_t(i) & ((uint64_t(1) << (SequenceKeyBits / 3)) - 1);
+        x = (x | x << 32) & 0x001f00000000ffff;
+        x = (x | x << 16) & 0x001f0000ff0000ff;
+        x = (x | x << 8) & 0x100f00f00f00f00f;
+        x = (x | x << 4) & 0x10c30c30c30c30c3;
+        x = (x | x << 2) & 0x1249249249249249;
         return x;
     };
 };
@@ -160,10 +160,15 @@ void CellLinkedList ::insertParticleIndex(UnsignedInt particle_index, const Vecd
 //=================================================================================================//
 void CellLinkedList ::InsertListDataEntry(UnsignedInt particle_index, const Vecd &particle_position)
 {
-    UnsignedInt linear_index = mesh_->LinearCellIndexFromPosition(particle_position);
+    UnsignedInt linear_index = ListDataCellIndex(particle_index, particle_position);
     cell_data_lists_[linear_index].emplace_back(std::make_pair(particle_index, particle_position));
 }
 //=================================================================================================//
+UnsignedInt CellLinkedList::ListDataCellIndex(UnsignedInt particle_index, const Vecd &particle_position)
+{
+    return mesh_->LinearCellIndexFromPosition(particle_position);
+}
+//=================================================================================================//
 void CellLinkedList::tagBoundingCells(StdVec<CellLists> &cell_data_lists,
                                       const BoundingBox &bounding_bounds, int axis)
 {
@@ -183,6 +188,11 @@ UnsignedInt CellLinkedList::computingSequence(Vecd &position, UnsignedInt index_
     return mesh_->transferMeshIndexToMortonOrder(mesh_->CellIndexFromPosition(position));
 }
 //=================================================================================================//
+UnsignedInt CellLinkedList::computingHilbertSequence(Vecd &position, UnsignedInt index_i)
+{
+    return mesh_->transferMeshIndexToHilbertOrder(mesh_->CellIndexFromPosition(position));
+}
+//=================================================================================================//
 void CellLinkedList::tagBodyPartByCell(ConcurrentCellLists &cell_lists,
                                        ConcurrentIndexVector &cell_indexes,
                                        std::function<bool(Vecd, Real)> &check_included)
@@ -240,12 +250,17 @@ void MultilevelCellLinkedList::insertParticleIndex(UnsignedInt particle_index, c
 //=================================================================================================//
 void MultilevelCellLinkedList::InsertListDataEntry(UnsignedInt particle_index, const Vecd &particle_position)
 {
-    UnsignedInt level = getMeshLevel(kernel_.CutOffRadius(h_ratio_[particle_index]));
-    UnsignedInt linear_index = mesh_offsets_[level] + meshes_[level]->LinearCellIndexFromPosition(particle_position);
+    UnsignedInt linear_index = ListDataCellIndex(particle_index, particle_position);
     cell_data_lists_[linear_index]
         .emplace_back(std::make_pair(particle_index, particle_position));
 }
 //=================================================================================================//
+UnsignedInt MultilevelCellLinkedList::ListDataCellIndex(UnsignedInt particle_index, const Vecd &particle_position)
+{
+    UnsignedInt level = getMeshLevel(kernel_.CutOffRadius(h_ratio_[particle_index]));
+    return mesh_offsets_[level] + meshes_[level]->LinearCellIndexFromPosition(particle_position);
+}
+//=================================================================================================//
 UnsignedInt MultilevelCellLinkedList::computingSequence(Vecd &position, UnsignedInt index_i)
 {
     UnsignedInt level = getMeshLevel(kernel_.CutOffRadius(h_ratio_[index_i]));
@@ -253,6 +268,13 @@ UnsignedInt MultilevelCellLinkedList::computingSequence(Vecd &position, Unsigned
         meshes_[level]->CellIndexFromPosition(position));
 }
 //=================================================================================================//
+UnsignedInt MultilevelCellLinkedList::computingHilbertSequence(Vecd &position, UnsignedInt index_i)
+{
+    UnsignedInt level = getMeshLevel(kernel_.CutOffRadius(h_ratio_[index_i]));
+    return meshes_[level]->transferMeshIndexToHilbertOrder(
+        meshes_[level]->CellIndexFromPosition(position));
+}
+//=================================================================================================//
 void MultilevelCellLinkedList::tagBodyPartByCell(ConcurrentCellLists &cell_lists,
                                                  ConcurrentIndexVector &cell_indexes,
                                                  std::function<bool(Vecd, Real)> &check_included)
@@ -67,10 +67,23 @@ class BaseCellLinkedList : public BaseMeshField
     virtual void insertParticleIndex(UnsignedInt particle_index, const Vecd &particle_position) = 0;
     /** Insert a cell-linked_list entry of the index and particle position pair. */
     virtual void InsertListDataEntry(UnsignedInt particle_index, const Vecd &particle_position) = 0;
+    /** linear index of the cell for the entry of the index and particle position pair */
+    virtual UnsignedInt ListDataCellIndex(UnsignedInt particle_index, const Vecd &particle_position) = 0;
+    ListDataVector &getCellDataList(UnsignedInt linear_index) { return cell_data_lists_[linear_index]; };
     /** find the nearest list data entry */
     virtual ListData findNearestListDataEntry(const Vecd &position) = 0;
     /** computing the sequence which indicate the order of sorted particle data */
     virtual UnsignedInt computingSequence(Vecd &position, UnsignedInt index_i) = 0;
+    /** computing the sequence along Hilbert curve */
+    virtual UnsignedInt computingHilbertSequence(Vecd &position, UnsignedInt index_i) = 0;
+    UnsignedInt computingSequence(const MortonOrder &, Vecd &position, UnsignedInt index_i)
+    {
+        return computingSequence(position, index_i);
+    };
+    UnsignedInt computingSequence(const HilbertOrder &, Vecd &position, UnsignedInt index_i)
+    {
+        return computingHilbertSequence(position, index_i);
+    };
     /** Tag body part by cell, call by body part */
     virtual void tagBodyPartByCell(ConcurrentCellLists &cell_lists,
                                    ConcurrentIndexVector &cell_indexes,
@@ -82,6 +95,11 @@ class BaseCellLinkedList : public BaseMeshField
     void searchNeighborsByMesh(Mesh &mesh, UnsignedInt mesh_offset,
                                DynamicsRange &dynamics_range, ParticleConfiguration &particle_configuration,
                                GetSearchDepth &get_search_depth, GetNeighborRelation &get_neighbor_relation);
+    /** particle search algorithm building the compact (CSR) particle configuration */
+    template <typename GetSearchDepth, typename GetNeighborRelation>
+    void searchNeighborsByMesh(Mesh &mesh, UnsignedInt mesh_offset,
+                               BaseParticles &base_particles, CompactParticleConfiguration &particle_configuration,
+                               GetSearchDepth &get_search_depth, GetNeighborRelation &get_neighbor_relation);
     DiscreteVariable<UnsignedInt> *getParticleIndex() { return dv_particle_index_; };
     DiscreteVariable<UnsignedInt> *getCellOffset() { return dv_cell_offset_; };
 
@@ -131,7 +149,7 @@ class NeighborSearch : public Mesh
 {
   public:
     template <class ExecutionPolicy>
-    NeighborSearch(const ExecutionPolicy &ex_policy, CellLinkedList &cell_linked_list);
+    NeighborSearch(const ExecutionPolicy &ex_policy, CellLinkedList &cell_linked_list, int search_depth = 1);
 
     template <typename FunctionOnEach>
     void forEachSearch(UnsignedInt source_index, const Vecd *source_pos,
@@ -140,6 +158,7 @@ class NeighborSearch : public Mesh
   protected:
     UnsignedInt *particle_index_;
     UnsignedInt *cell_offset_;
+    int search_depth_; /**< number of cells searched in each direction */
 };
 
 /**
@@ -159,8 +178,10 @@ class CellLinkedList : public BaseCellLinkedList
     Mesh &getMesh() { return *mesh_; };
     void insertParticleIndex(UnsignedInt particle_index, const Vecd &particle_position) override;
     void InsertListDataEntry(UnsignedInt particle_index, const Vecd &particle_position) override;
+    virtual UnsignedInt ListDataCellIndex(UnsignedInt particle_index, const Vecd &particle_position) override;
     virtual ListData findNearestListDataEntry(const Vecd &position) override;
     virtual UnsignedInt computingSequence(Vecd &position, UnsignedInt index_i) override;
+    virtual UnsignedInt computingHilbertSequence(Vecd &position, UnsignedInt index_i) override;
     virtual void tagBodyPartByCell(ConcurrentCellLists &cell_lists,
                                    ConcurrentIndexVector &cell_indexes,
                                    std::function<bool(Vecd, Real)> &check_included) override;
@@ -168,7 +189,7 @@ class CellLinkedList : public BaseCellLinkedList
     virtual void writeMeshFieldToPlt(std::ofstream &output_file) override;
 
     template <class ExecutionPolicy>
-    NeighborSearch createNeighborSearch(const ExecutionPolicy &ex_policy);
+    NeighborSearch createNeighborSearch(const ExecutionPolicy &ex_policy, int search_depth = 1);
     UnsignedInt getCellOffsetListSize() { return cell_offset_list_size_; };
 
     /** split algorithm */;
@@ -199,8 +220,10 @@ class MultilevelCellLinkedList : public BaseCellLinkedList
     virtual ~MultilevelCellLinkedList() {};
     void insertParticleIndex(UnsignedInt particle_index, const Vecd &particle_position) override;
     void InsertListDataEntry(UnsignedInt particle_index, const Vecd &particle_position) override;
+    virtual UnsignedInt ListDataCellIndex(UnsignedInt particle_index, const Vecd &particle_position) override;
     virtual ListData findNearestListDataEntry(const Vecd &position) override { return ListData(0, Vecd::Zero()); }; // mocking, not implemented
     virtual UnsignedInt computingSequence(Vecd &position, UnsignedInt index_i) override;
+    virtual UnsignedInt computingHilbertSequence(Vecd &position, UnsignedInt index_i) override;
     virtual void tagBodyPartByCell(ConcurrentCellLists &cell_lists,
                                    ConcurrentIndexVector &cell_indexes,
                                    std::function<bool(Vecd, Real)> &check_included) override;
@@ -46,6 +46,51 @@ void BaseCellLinkedList::searchNeighborsByMesh(
                  });
 }
 //=================================================================================================//
+template <typename GetSearchDepth, typename GetNeighborRelation>
+void BaseCellLinkedList::searchNeighborsByMesh(
+    Mesh &mesh, UnsignedInt mesh_offset,
+    BaseParticles &base_particles, CompactParticleConfiguration &particle_configuration,
+    GetSearchDepth &get_search_depth, GetNeighborRelation &get_neighbor_relation)
+{
+    Vecd *pos = base_particles.ParticlePositions();
+    size_t total_real_particles = base_particles.TotalRealParticles();
+    size_t block_size = CompactParticleConfiguration::block_size_;
+    size_t number_of_blocks = (total_real_particles + block_size - 1) / block_size;
+
+    particle_configuration.resetBlockBuffers(total_real_particles);
+    parallel_for(
+        IndexRange(0, number_of_blocks),
+        [&](const IndexRange &r)
+        {
+            for (size_t k = r.begin(); k != r.end(); ++k)
+            {
+                size_t particle_end = SMIN((k + 1) * block_size, total_real_particles);
+                for (size_t index_i = k * block_size; index_i != particle_end; ++index_i)
+                {
+                    Neighborhood &buffer = particle_configuration.BlockBuffer(index_i);
+                    size_t size_before = buffer.current_size_;
+                    int search_depth = get_search_depth(index_i);
+                    Arrayi target_cell_index = mesh.CellIndexFromPosition(pos[index_i]);
+                    mesh_for_each(
+                        Arrayi::Zero().max(target_cell_index - search_depth * Arrayi::Ones()),
+                        mesh.AllCells().min(target_cell_index + (search_depth + 1) * Arrayi::Ones()),
+                        [&](const Arrayi &cell_index)
+                        {
+                            UnsignedInt linear_index = mesh_offset + mesh.LinearCellIndexFromCellIndex(cell_index);
+                            ListDataVector &target_particles = cell_data_lists_[linear_index];
+                            for (const ListData &data_list : target_particles)
+                            {
+                                get_neighbor_relation(buffer, pos[index_i], index_i, data_list);
+                            }
+                        });
+                    particle_configuration.setNeighborSize(index_i, buffer.current_size_ - size_before);
+                }
+            }
+        },
+        ap);
+    particle_configuration.packBlockBuffers(total_real_particles);
+}
+//=================================================================================================//
 template <class LocalDynamicsFunction>
 void BaseCellLinkedList::particle_for_split_by_mesh(
     const execution::SequencedPolicy &, Mesh &mesh, UnsignedInt mesh_offset,
@@ -184,10 +229,11 @@ DiscreteVariable<DataType> *BaseCellLinkedList::registerDiscreteVariableOnly(
 }
 //=================================================================================================//
 template <class ExecutionPolicy>
-NeighborSearch::NeighborSearch(const ExecutionPolicy &ex_policy, CellLinkedList &cell_linked_list)
+NeighborSearch::NeighborSearch(const ExecutionPolicy &ex_policy, CellLinkedList &cell_linked_list, int search_depth)
     : Mesh(cell_linked_list.getMesh()),
       particle_index_(cell_linked_list.getParticleIndex()->DelegatedData(ex_policy)),
-      cell_offset_(cell_linked_list.getCellOffset()->DelegatedData(ex_policy)) {}
+      cell_offset_(cell_linked_list.getCellOffset()->DelegatedData(ex_policy)),
+      search_depth_(search_depth) {}
 //=================================================================================================//
 template <typename FunctionOnEach>
 void NeighborSearch::forEachSearch(UnsignedInt source_index, const Vecd *source_pos,
@@ -195,8 +241,8 @@ void NeighborSearch::forEachSearch(UnsignedInt source_index, const Vecd *source_
 {
     const Arrayi target_cell_index = CellIndexFromPosition(source_pos[source_index]);
     mesh_for_each(
-        Arrayi::Zero().max(target_cell_index - Arrayi::Ones()),
-        all_cells_.min(target_cell_index + 2 * Arrayi::Ones()),
+        Arrayi::Zero().max(target_cell_index - search_depth_ * Arrayi::Ones()),
+        all_cells_.min(target_cell_index + (search_depth_ + 1) * Arrayi::Ones()),
         [&](const Arrayi &cell_index)
         {
             const UnsignedInt linear_index = LinearCellIndexFromCellIndex(cell_index);
@@ -210,9 +256,9 @@ void NeighborSearch::forEachSearch(UnsignedInt source_index, const Vecd *source_
 }
 //=================================================================================================//
 template <class ExecutionPolicy>
-NeighborSearch CellLinkedList::createNeighborSearch(const ExecutionPolicy &ex_policy)
+NeighborSearch CellLinkedList::createNeighborSearch(const ExecutionPolicy &ex_policy, int search_depth)
 {
-    return NeighborSearch(ex_policy, *this);
+    return NeighborSearch(ex_policy, *this, search_depth);
 }
 //=================================================================================================//
 template <class LocalDynamicsFunction>
@@ -30,15 +30,18 @@
 #define MESH_WITH_DATA_PACKAGES_H
 
 #include "base_mesh.h"
+#include "binary_column_file.h"
 #include "my_memory_pool.h"
 #include "sphinxsys_variable.h"
 #include "tbb/parallel_sort.h"
 #include "mesh_iterators.h"
 
 #include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <functional>
 #include <mutex>
+#include <type_traits>
 using namespace std::placeholders;
 
 namespace SPH
@@ -87,8 +90,8 @@ class MeshWithGridDataPackages : public Mesh
 
   public:
     ConcurrentVec<std::pair<size_t, int>> occupied_data_pkgs_; /**< (size_t)sort_index, (int)core1/inner0. */
-    CellNeighborhood *cell_neighborhood_;                  /**< 3*3(*3) array to store indicies of neighborhood cells. */
-    std::pair<Arrayi, int> *meta_data_cell_;          /**< metadata for each occupied cell: (arrayi)cell index, (int)core1/inner0. */
+    CellNeighborhood *cell_neighborhood_ = nullptr;        /**< 3*3(*3) array to store indicies of neighborhood cells. */
+    std::pair<Arrayi, int> *meta_data_cell_ = nullptr; /**< metadata for each occupied cell: (arrayi)cell index, (int)core1/inner0. */
     Mesh global_mesh_;                            /**< the mesh for the locations of all possible data points. */
     size_t num_grid_pkgs_ = 2;                        /**< the number of all distinct packages, initially only 2 singular packages. */
 
@@ -124,6 +127,42 @@ class MeshWithGridDataPackages : public Mesh
     };
     OperationOnDataAssemble<MeshVariableAssemble, ResizeMeshVariableData> resize_mesh_variable_data_{};
 
+    /** add the package data of all mesh variables as columns of a binary file */
+    struct AddMeshVariableToBinary
+    {
+        template <typename DataType>
+        void operator()(DataContainerAddressKeeper<MeshVariable<DataType>> &all_mesh_variables_,
+                        BinaryColumnFile &binary_file, const std::string &prefix, const size_t num_grid_pkgs_)
+        {
+            for (size_t l = 0; l != all_mesh_variables_.size(); ++l)
+            {
+                MeshVariable<DataType> *variable = all_mesh_variables_[l];
+                binary_file.addColumn(prefix + variable->Name(), variable->Data(), num_grid_pkgs_);
+            }
+        }
+    };
+    OperationOnDataAssemble<MeshVariableAssemble, AddMeshVariableToBinary> add_mesh_variable_to_binary_{};
+
+    /** copy the package data of all mesh variables from the columns of a binary file */
+    struct ReadMeshVariableFromBinary
+    {
+        template <typename DataType>
+        void operator()(DataContainerAddressKeeper<MeshVariable<DataType>> &all_mesh_variables_,
+                        BinaryColumnFile &binary_file, const std::string &prefix, const size_t num_grid_pkgs_)
+        {
+            using PackageData = typename MeshVariable<DataType>::PackageData;
+            for (size_t l = 0; l != all_mesh_variables_.size(); ++l)
+            {
+                MeshVariable<DataType> *variable = all_mesh_variables_[l];
+                static_assert(is_bitwise_serializable<PackageData>::value, "The package data are copied as raw bytes!");
+                const PackageData *data =
+                    binary_file.getColumnData<PackageData>(prefix + variable->Name(), num_grid_pkgs_);
+                std::memcpy(static_cast<void *>(variable->Data()), data, num_grid_pkgs_ * sizeof(PackageData));
+            }
+        }
+    };
+    OperationOnDataAssemble<MeshVariableAssemble, ReadMeshVariableFromBinary> read_mesh_variable_from_binary_{};
+
     /** probe by applying bi and tri-linear interpolation within the package. */
     template <class DataType>
     DataType probeDataPackage(MeshVariable<DataType> &mesh_variable, size_t package_index, const Arrayi &cell_index, const Vecd &position);
@@ -191,6 +230,68 @@ class MeshWithGridDataPackages : public Mesh
                          MeshVariable<OutDataType> &out_variable,
                          const size_t package_index);
 
+    /** add the packages as columns with the prefix, the buffers keep the cell index and metadata alive until written */
+    void addPackagesToBinaryFile(BinaryColumnFile &binary_file, const std::string &prefix,
+                                 StdVec<size_t> &index_data_buffer, StdVec<int> &meta_data_buffer)
+    {
+        index_data_buffer.clear();
+        mesh_for(MeshRange(Arrayi::Zero(), all_cells_),
+                 [&](const Arrayi &cell_index)
+                 { index_data_buffer.push_back(PackageIndexFromCellIndex(cell_index)); });
+        binary_file.addColumn(prefix + "IndexData", index_data_buffer.data(), index_data_buffer.size());
+        binary_file.addColumn(prefix + "CellNeighborhood", cell_neighborhood_, num_grid_pkgs_);
+        /** std::pair is not trivially copyable, the metadata are written as cell index and type integers */
+        meta_data_buffer.clear();
+        for (size_t package_index = 0; package_index != num_grid_pkgs_; ++package_index)
+        {
+            for (int n = 0; n != Dimensions; ++n)
+                meta_data_buffer.push_back(meta_data_cell_[package_index].first[n]);
+            meta_data_buffer.push_back(meta_data_cell_[package_index].second);
+        }
+        binary_file.addColumn(prefix + "MetaDataCell", meta_data_buffer.data(), meta_data_buffer.size());
+        add_mesh_variable_to_binary_(all_mesh_variables_, binary_file, prefix, num_grid_pkgs_);
+    }
+
+    /** replace the packages by those in the columns with the prefix, the mesh variables are required to be registered */
+    void readPackagesFromBinaryFile(BinaryColumnFile &binary_file, const std::string &prefix)
+    {
+        BinaryColumnFile::Column *neighborhood_column = binary_file.findColumn(prefix + "CellNeighborhood");
+        if (neighborhood_column == nullptr)
+        {
+            std::cout << "\n Error: the packages " << prefix << " are missing in the binary file!" << std::endl;
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            exit(1);
+        }
+        num_grid_pkgs_ = neighborhood_column->number_of_values_;
+
+        const size_t *index_data = binary_file.getColumnData<size_t>(prefix + "IndexData", all_cells_.prod());
+        size_t cell_count = 0;
+        mesh_for(MeshRange(Arrayi::Zero(), all_cells_),
+                 [&](const Arrayi &cell_index)
+                 { assignDataPackageIndex(cell_index, index_data[cell_count++]); });
+
+        delete[] cell_neighborhood_;
+        cell_neighborhood_ = new CellNeighborhood[num_grid_pkgs_];
+        static_assert(std::is_trivially_copyable<CellNeighborhood>::value, "CellNeighborhood is copied as raw bytes!");
+        std::memcpy(static_cast<void *>(cell_neighborhood_),
+                    binary_file.getColumnData<CellNeighborhood>(prefix + "CellNeighborhood", num_grid_pkgs_),
+                    num_grid_pkgs_ * sizeof(CellNeighborhood));
+        delete[] meta_data_cell_;
+        meta_data_cell_ = new std::pair<Arrayi, int>[num_grid_pkgs_];
+        const int *meta_data =
+            binary_file.getColumnData<int>(prefix + "MetaDataCell", num_grid_pkgs_ * (Dimensions + 1));
+        for (size_t package_index = 0; package_index != num_grid_pkgs_; ++package_index)
+        {
+            const int *package_meta_data = meta_data + package_index * (Dimensions + 1);
+            for (int n = 0; n != Dimensions; ++n)
+                meta_data_cell_[package_index].first[n] = package_meta_data[n];
+            meta_data_cell_[package_index].second = package_meta_data[Dimensions];
+        }
+
+        resizeMeshVariableData();
+        read_mesh_variable_from_binary_(all_mesh_variables_, binary_file, prefix, num_grid_pkgs_);
+    }
+
     void registerOccupied(std::pair<size_t, int> &occupied)
     {
         occupied_data_pkgs_.push_back(occupied);
@@ -62,6 +62,7 @@ class BaseLocalDynamics
     virtual ~BaseLocalDynamics() {};
     using Identifier = typename DynamicsIdentifier::BaseIdentifier;
     SPHBody &getSPHBody() { return sph_body_; };
+    DynamicsIdentifier &getDynamicsIdentifier() { return identifier_; };
     virtual void setupDynamics(Real dt = 0.0) {}; // setup global parameters
 
     class FinishDynamics
@@ -49,7 +49,7 @@ template <class ReturnType = void>
 class BaseDynamics
 {
   public:
-    BaseDynamics() : is_newly_updated_(false) {};
+    BaseDynamics() : is_newly_updated_(false), is_profiling_checked_(false), profiling_record_(nullptr) {};
     virtual ~BaseDynamics() {};
     bool checkNewlyUpdated() { return is_newly_updated_; };
     void setNotNewlyUpdated() { is_newly_updated_ = false; };
@@ -62,9 +62,34 @@ class BaseDynamics
 
     /** There is the interface functions for computing. */
     virtual ReturnType exec(Real dt = 0.0) = 0;
+    /** name in the profiling report instead of the type name */
+    void setProfilingName(const std::string &profiling_name) { profiling_name_ = profiling_name; };
+
+  protected:
+    /** returns nullptr if profiling is not enabled for the SPH system,
+     *  which is checked at the first execution only and cached afterwards */
+    ProfilingRecord *profilingRecord(SPHBody &sph_body)
+    {
+        if (!is_profiling_checked_)
+        {
+            DynamicsProfiler &dynamics_profiler = sph_body.getSPHSystem().getDynamicsProfiler();
+            if (dynamics_profiler.isEnabled())
+            {
+                std::string name = profiling_name_.empty()
+                                       ? DynamicsProfiler::getTypeName(typeid(*this))
+                                       : profiling_name_;
+                profiling_record_ = dynamics_profiler.getRecord(sph_body.getName() + ": " + name);
+            }
+            is_profiling_checked_ = true;
+        }
+        return profiling_record_;
+    };
 
   private:
     bool is_newly_updated_;
+    bool is_profiling_checked_;
+    std::string profiling_name_;
+    ProfilingRecord *profiling_record_;
 };
 
 /**
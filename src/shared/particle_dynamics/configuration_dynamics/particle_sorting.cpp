@@ -1,4 +1,4 @@
-#include "particle_sorting.h"
+#include "particle_sorting.hpp"
 
 #include "base_body.h"
 #include "base_particle_dynamics.h"
@@ -22,29 +22,43 @@ void SwapSortableParticleData::operator()(UnsignedInt *a, UnsignedInt *b)
     swap_particle_data_value_(evolving_variables_data_, index_a, index_b);
 }
 //=================================================================================================//
-ParticleSequence::ParticleSequence(RealBody &real_body)
-    : LocalDynamics(real_body),
-      pos_(particles_->getVariableDataByName<Vecd>("Position")),
-      sequence_(particles_->registerDiscreteVariable<UnsignedInt>("Sequence", particles_->ParticlesBound())),
-      cell_linked_list_(real_body.getCellLinkedList()) {}
+UpdateSortableVariables::UpdateSortableVariables(BaseParticles *particles)
+    : initialize_temp_variables_()
+{
+    initialize_temp_variables_(temp_variables_, particles->ParticlesBound());
+}
 //=================================================================================================//
-void ParticleSequence::update(size_t index_i, Real dt)
+void RadixSort::sort(const SequencedPolicy &ex_policy, BaseParticles *particles)
 {
-    sequence_[index_i] = cell_linked_list_.computingSequence(pos_[index_i], index_i);
+    sortByKey(ex_policy, dv_sequence_->DelegatedData(ex_policy),
+              dv_index_permutation_->DelegatedData(ex_policy), particles->TotalRealParticles());
+}
+//=================================================================================================//
+void RadixSort::sort(const ParallelPolicy &ex_policy, BaseParticles *particles)
+{
+    sortByKey(ex_policy, dv_sequence_->DelegatedData(ex_policy),
+              dv_index_permutation_->DelegatedData(ex_policy), particles->TotalRealParticles());
 }
 //=================================================================================================//
 ParticleDataSort<ParallelPolicy>::ParticleDataSort(RealBody &real_body)
     : LocalDynamics(real_body), BaseDynamics<void>(),
-      sequence_(particles_->getVariableDataByName<UnsignedInt>("Sequence")),
-      swap_sortable_particle_data_(particles_), compare_(),
-      quick_sort_particle_range_(sequence_, 0, compare_, swap_sortable_particle_data_),
-      quick_sort_particle_body_() {}
+      dv_sequence_(particles_->getVariableByName<UnsignedInt>("Sequence")),
+      dv_index_permutation_(particles_->registerDiscreteVariableOnly<UnsignedInt>(
+          "IndexPermutation", particles_->ParticlesBound())),
+      radix_sort_(par, dv_sequence_, dv_index_permutation_),
+      update_variables_to_sort_(particles_) {}
 //=================================================================================================//
 void ParticleDataSort<ParallelPolicy>::exec(Real dt)
 {
-    quick_sort_particle_range_.begin_ = sequence_;
-    quick_sort_particle_range_.size_ = particles_->TotalRealParticles();
-    parallel_for(quick_sort_particle_range_, quick_sort_particle_body_, ap);
+    UnsignedInt total_real_particles = particles_->TotalRealParticles();
+    UnsignedInt *index_permutation = dv_index_permutation_->Data();
+    particle_for(par, IndexRange(0, total_real_particles),
+                 [=](size_t i)
+                 { index_permutation[i] = i; });
+
+    radix_sort_.sort(par, particles_);
+    ParallelPolicy ex_policy = par;
+    update_variables_to_sort_(particles_->EvolvingVariables(), ex_policy, total_real_particles, dv_index_permutation_);
 }
 //=================================================================================================//
 UpdateSortedID::UpdateSortedID(RealBody &real_body)
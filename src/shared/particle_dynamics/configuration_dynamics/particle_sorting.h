@@ -245,6 +245,74 @@ class SwapSortableParticleData
     void operator()(UnsignedInt *a, UnsignedInt *b);
 };
 
+/**
+ * @class UpdateSortableVariables
+ * @brief Reorder the sortable variables according to an index permutation.
+ * @details Each variable is copied once into a temporary one and gathered back,
+ * so that the cost does not depend on the sorting algorithm.
+ */
+class UpdateSortableVariables
+{
+    typedef DataAssemble<UniquePtr, DiscreteVariable> TemporaryVariables;
+
+    struct InitializeTemporaryVariables
+    {
+        template <typename DataType>
+        void operator()(UniquePtr<DiscreteVariable<DataType>> &variable_ptr, UnsignedInt data_size);
+    };
+
+    TemporaryVariables temp_variables_;
+    OperationOnDataAssemble<TemporaryVariables, InitializeTemporaryVariables> initialize_temp_variables_;
+
+  public:
+    UpdateSortableVariables(BaseParticles *particles);
+
+    template <class ExecutionPolicy, typename DataType>
+    void operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables,
+                    ExecutionPolicy &ex_policy, UnsignedInt total_real_particles,
+                    DiscreteVariable<UnsignedInt> *dv_index_permutation);
+};
+
+/**
+ * @class RadixSort
+ * @brief Stable LSD radix sort of the particle sequence carrying the index permutation along.
+ * @details The keys are sorted by 8-bit digits. In each pass, the digits are counted block-wise,
+ * the scatter offsets of all blocks are obtained by one scan and the blocks are scattered
+ * into buffers concurrently. Passes beyond the highest digit of the largest key are skipped.
+ * The sorting for device execution is implemented in the SYCL sources.
+ */
+class RadixSort
+{
+    static constexpr UnsignedInt radix_bits_ = 8;
+    static constexpr UnsignedInt radix_size_ = 1 << radix_bits_;
+    static constexpr UnsignedInt radix_mask_ = radix_size_ - 1;
+    static constexpr UnsignedInt block_size_ = 4096;
+
+  public:
+    template <class ExecutionPolicy>
+    explicit RadixSort(const ExecutionPolicy &ex_policy,
+                       DiscreteVariable<UnsignedInt> *dv_sequence,
+                       DiscreteVariable<UnsignedInt> *dv_index_permutation);
+    void sort(const SequencedPolicy &ex_policy, BaseParticles *particles);
+    void sort(const ParallelPolicy &ex_policy, BaseParticles *particles);
+    void sort(const ParallelDevicePolicy &ex_policy, BaseParticles *particles);
+
+  protected:
+    DiscreteVariable<UnsignedInt> *dv_sequence_;
+    DiscreteVariable<UnsignedInt> *dv_index_permutation_;
+    StdLargeVec<UnsignedInt> sequence_buffer_, index_buffer_, digit_offset_;
+
+    template <class ExecutionPolicy>
+    void sortByKey(const ExecutionPolicy &ex_policy, UnsignedInt *sequence,
+                   UnsignedInt *index_permutation, UnsignedInt size);
+};
+
+/**
+ * @class ParticleSequence
+ * @brief Compute the sequence of particles along a space-filling curve,
+ * MortonOrder or HilbertOrder.
+ */
+template <class SequenceOrder>
 class ParticleSequence : public LocalDynamics
 {
   protected:
@@ -261,22 +329,20 @@ class ParticleSequence : public LocalDynamics
 template <class ExecutionPolicy>
 class ParticleDataSort;
 
+/**
+ * @class ParticleDataSort
+ * @brief Sort the particle sequence into an index permutation by radix sort
+ * and then gather each evolving variable once according to the permutation.
+ */
 template <>
 class ParticleDataSort<ParallelPolicy>
     : public LocalDynamics, public BaseDynamics<void>
 {
   protected:
-    UnsignedInt *sequence_;
-
-    /** using pointer because it is constructed after particles. */
-    SwapSortableParticleData swap_sortable_particle_data_;
-    CompareParticleSequence compare_;
-    tbb::interface9::QuickSortParticleRange<
-        UnsignedInt *, CompareParticleSequence, SwapSortableParticleData>
-        quick_sort_particle_range_;
-    tbb::interface9::QuickSortParticleBody<
-        UnsignedInt *, CompareParticleSequence, SwapSortableParticleData>
-        quick_sort_particle_body_;
+    DiscreteVariable<UnsignedInt> *dv_sequence_;
+    DiscreteVariable<UnsignedInt> *dv_index_permutation_;
+    RadixSort radix_sort_;
+    OperationOnDataAssemble<ParticleVariables, UpdateSortableVariables> update_variables_to_sort_;
 
   public:
     explicit ParticleDataSort(RealBody &real_body);
@@ -296,10 +362,10 @@ class UpdateSortedID : public LocalDynamics
     void update(size_t index_i, Real dt = 0.0);
 };
 
-template <class ExecutionPolicy = ParallelPolicy>
+template <class ExecutionPolicy = ParallelPolicy, class SequenceOrder = MortonOrder>
 class ParticleSorting : public BaseDynamics<void>
 {
-    SimpleDynamics<ParticleSequence, ExecutionPolicy> particle_sequence_;
+    SimpleDynamics<ParticleSequence<SequenceOrder>, ExecutionPolicy> particle_sequence_;
     ParticleDataSort<ParallelPolicy> particle_data_sort_;
     SimpleDynamics<UpdateSortedID, ExecutionPolicy> update_sorted_id_;
 
@@ -6,14 +6,135 @@
 namespace SPH
 {
 //=================================================================================================//
+template <typename DataType>
+void UpdateSortableVariables::InitializeTemporaryVariables::operator()(
+    UniquePtr<DiscreteVariable<DataType>> &variable_ptr, UnsignedInt data_size)
+{
+    variable_ptr = makeUnique<DiscreteVariable<DataType>>("Temporary", data_size);
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename DataType>
+void UpdateSortableVariables::operator()(
+    DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables,
+    ExecutionPolicy &ex_policy, UnsignedInt total_real_particles,
+    DiscreteVariable<UnsignedInt> *dv_index_permutation)
+{
+    constexpr int type_index = DataTypeIndex<DataType>::value;
+    DataType *temp_data_field = std::get<type_index>(temp_variables_)->DelegatedData(ex_policy);
+
+    UnsignedInt *index_permutation = dv_index_permutation->DelegatedData(ex_policy);
+
+    for (size_t k = 0; k != variables.size(); ++k)
+    {
+        DataType *sorted_data_field = variables[k]->DelegatedData(ex_policy);
+        particle_for(ex_policy, IndexRange(0, total_real_particles),
+                     [=](size_t i)
+                     { temp_data_field[i] = sorted_data_field[i]; });
+        particle_for(ex_policy, IndexRange(0, total_real_particles),
+                     [=](size_t i)
+                     { sorted_data_field[i] = temp_data_field[index_permutation[i]]; });
+    }
+}
+//=================================================================================================//
+template <class ExecutionPolicy>
+RadixSort::RadixSort(const ExecutionPolicy &ex_policy,
+                     DiscreteVariable<UnsignedInt> *dv_sequence,
+                     DiscreteVariable<UnsignedInt> *dv_index_permutation)
+    : dv_sequence_(dv_sequence), dv_index_permutation_(dv_index_permutation) {}
+//=================================================================================================//
 template <class ExecutionPolicy>
-ParticleSorting<ExecutionPolicy>::ParticleSorting(RealBody &real_body)
+void RadixSort::sortByKey(const ExecutionPolicy &ex_policy, UnsignedInt *sequence,
+                          UnsignedInt *index_permutation, UnsignedInt size)
+{
+    if (sequence_buffer_.size() < size)
+    {
+        sequence_buffer_.resize(size);
+        index_buffer_.resize(size);
+    }
+
+    UnsignedInt max_key = particle_reduce(
+        ex_policy, IndexRange(0, size), UnsignedInt(0),
+        [](UnsignedInt a, UnsignedInt b)
+        { return SMAX(a, b); },
+        [=](size_t i)
+        { return sequence[i]; });
+
+    UnsignedInt number_of_blocks = (size + block_size_ - 1) / block_size_;
+    digit_offset_.resize(radix_size_ * number_of_blocks);
+    UnsignedInt *digit_offset = digit_offset_.data();
+
+    UnsignedInt *key_in = sequence;
+    UnsignedInt *value_in = index_permutation;
+    UnsignedInt *key_out = sequence_buffer_.data();
+    UnsignedInt *value_out = index_buffer_.data();
+    constexpr UnsignedInt key_bits = sizeof(UnsignedInt) * 8;
+    for (UnsignedInt shift = 0; shift < key_bits && (max_key >> shift) != 0; shift += radix_bits_)
+    {
+        particle_for(ex_policy, IndexRange(0, number_of_blocks),
+                     [=](size_t block)
+                     {
+                         for (UnsignedInt digit = 0; digit != radix_size_; ++digit)
+                             digit_offset[digit * number_of_blocks + block] = 0;
+
+                         UnsignedInt end = SMIN(UnsignedInt((block + 1) * block_size_), size);
+                         for (UnsignedInt i = block * block_size_; i != end; ++i)
+                             digit_offset[((key_in[i] >> shift) & radix_mask_) * number_of_blocks + block]++;
+                     });
+
+        // digit-major layout, so that one scan gives the scatter offsets of all blocks
+        std::exclusive_scan(digit_offset, digit_offset + radix_size_ * number_of_blocks,
+                            digit_offset, UnsignedInt(0));
+
+        particle_for(ex_policy, IndexRange(0, number_of_blocks),
+                     [=](size_t block)
+                     {
+                         UnsignedInt end = SMIN(UnsignedInt((block + 1) * block_size_), size);
+                         for (UnsignedInt i = block * block_size_; i != end; ++i)
+                         {
+                             UnsignedInt &position =
+                                 digit_offset[((key_in[i] >> shift) & radix_mask_) * number_of_blocks + block];
+                             key_out[position] = key_in[i];
+                             value_out[position] = value_in[i];
+                             position++;
+                         }
+                     });
+
+        std::swap(key_in, key_out);
+        std::swap(value_in, value_out);
+    }
+
+    if (key_in != sequence)
+    {
+        particle_for(ex_policy, IndexRange(0, size),
+                     [=](size_t i)
+                     {
+                         sequence[i] = key_in[i];
+                         index_permutation[i] = value_in[i];
+                     });
+    }
+}
+//=================================================================================================//
+template <class SequenceOrder>
+ParticleSequence<SequenceOrder>::ParticleSequence(RealBody &real_body)
+    : LocalDynamics(real_body),
+      pos_(particles_->getVariableDataByName<Vecd>("Position")),
+      sequence_(particles_->registerDiscreteVariable<UnsignedInt>("Sequence", particles_->ParticlesBound())),
+      cell_linked_list_(real_body.getCellLinkedList()) {}
+//=================================================================================================//
+template <class SequenceOrder>
+void ParticleSequence<SequenceOrder>::update(size_t index_i, Real dt)
+{
+    sequence_[index_i] = cell_linked_list_.computingSequence(SequenceOrder{}, pos_[index_i], index_i);
+}
+//=================================================================================================//
+template <class ExecutionPolicy, class SequenceOrder>
+ParticleSorting<ExecutionPolicy, SequenceOrder>::ParticleSorting(RealBody &real_body)
     : BaseDynamics<void>(),
       particle_sequence_(real_body), particle_data_sort_(real_body),
       update_sorted_id_(real_body) {}
 //=================================================================================================//
-template <class ExecutionPolicy>
-void ParticleSorting<ExecutionPolicy>::exec(Real dt)
+template <class ExecutionPolicy, class SequenceOrder>
+void ParticleSorting<ExecutionPolicy, SequenceOrder>::exec(Real dt)
 {
     particle_sequence_.exec();
     particle_data_sort_.exec();
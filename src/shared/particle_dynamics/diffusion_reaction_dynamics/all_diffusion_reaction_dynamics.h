@@ -30,5 +30,6 @@
 #pragma once
 
 #include "diffusion_dynamics.hpp"
+#include "diffusion_implicit_dynamics.hpp"
 #include "general_diffusion_reaction_dynamics.h"
 #include "reaction_dynamics.hpp"
@@ -0,0 +1,269 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file    diffusion_implicit_dynamics.h
+ * @brief   Implicit diffusion by solving the linear system of the SPH Laplacian
+ *          with Jacobi preconditioned Krylov methods.
+ * @details The explicit diffusion rate of DiffusionRelaxation is written as b - A phi.
+ *          An implicit step of size dt solves (1/dt + A) phi = phi^n / dt + b,
+ *          and a zero dt gives the steady state A phi = b.
+ *          Only the diagonal of A and b are saved. The off-diagonal part
+ *          is evaluated matrix free from the inner neighbor list.
+ * @author  Xiangyu Hu
+ */
+
+#ifndef DIFFUSION_IMPLICIT_DYNAMICS_H
+#define DIFFUSION_IMPLICIT_DYNAMICS_H
+
+#include "diffusion_dynamics.h"
+
+namespace SPH
+{
+template <typename... InteractionTypes>
+class DiffusionLinearSystem;
+
+template <class DataDelegationType, class DiffusionType>
+class DiffusionLinearSystem<DataDelegationType, DiffusionType>
+    : public LocalDynamics,
+      public DataDelegationType
+{
+  protected:
+    Real *Vol_;
+    StdVec<DiffusionType *> diffusions_;
+    StdVec<Real *> diffusion_species_;
+    StdVec<Real *> diagonal_;
+    StdVec<Real *> rhs_;
+
+  public:
+    template <class BodyRelationType>
+    explicit DiffusionLinearSystem(BodyRelationType &body_relation);
+    virtual ~DiffusionLinearSystem() {};
+    /** set the time derivative part of the diagonal and the right hand side */
+    void initialization(size_t index_i, Real dt = 0.0);
+    size_t NumberOfSpecies() { return diffusions_.size(); };
+    std::string SpeciesName(size_t m) { return diffusions_[m]->DiffusionSpeciesName(); };
+    Real *DiffusionSpecies(size_t m) { return diffusion_species_[m]; };
+    Real *Diagonal(size_t m) { return diagonal_[m]; };
+    Real *RightHandSide(size_t m) { return rhs_[m]; };
+    Real *VolumetricMeasure() { return Vol_; };
+
+  private:
+    void getDiffusions();
+};
+
+/**
+ * @class DiffusionLinearSystemInner
+ * @brief Assemble the diagonal from the inner neighbors and
+ * give the matrix-vector product.
+ */
+template <class KernelGradientType, class DiffusionType>
+class DiffusionLinearSystem<Inner<KernelGradientType>, DiffusionType>
+    : public DiffusionLinearSystem<DataDelegateInner, DiffusionType>
+{
+  protected:
+    KernelGradientType kernel_gradient_;
+    /** the coefficient is positive, i.e. the negative of that in the explicit rate */
+    inline Real offDiagonalCoefficient(size_t m, size_t index_i, Neighborhood &inner_neighborhood, size_t n);
+
+  public:
+    template <typename... Args>
+    explicit DiffusionLinearSystem(Args &&...args);
+    virtual ~DiffusionLinearSystem() {};
+    inline void interaction(size_t index_i, Real dt = 0.0);
+    /** the row index_i of the operator applied to the input vector of species m */
+    inline Real matrixProduct(size_t m, size_t index_i, Real *input);
+    /** the sum of row index_i, which vanishes without the time derivative and the boundary terms */
+    inline Real rowSum(size_t m, size_t index_i);
+};
+
+template <class ContactKernelGradientType, class DiffusionType>
+class DiffusionLinearSystem<Contact<ContactKernelGradientType>, DiffusionType>
+    : public DiffusionLinearSystem<DataDelegateContact, DiffusionType>
+{
+  protected:
+    StdVec<ContactKernelGradientType> contact_kernel_gradients_;
+    StdVec<Real *> contact_Vol_;
+
+  public:
+    template <typename... Args>
+    explicit DiffusionLinearSystem(Args &&...args);
+    virtual ~DiffusionLinearSystem() {};
+};
+
+template <class ContactKernelGradientType, class DiffusionType>
+class DiffusionLinearSystem<Dirichlet<ContactKernelGradientType>, DiffusionType>
+    : public DiffusionLinearSystem<Contact<ContactKernelGradientType>, DiffusionType>
+{
+  protected:
+    StdVec<StdVec<Real *>> contact_gradient_species_;
+
+  public:
+    template <typename... Args>
+    explicit DiffusionLinearSystem(Args &&...args);
+    virtual ~DiffusionLinearSystem() {};
+    inline void interaction(size_t index_i, Real dt = 0.0);
+};
+
+template <class ContactKernelGradientType, class DiffusionType>
+class DiffusionLinearSystem<Neumann<ContactKernelGradientType>, DiffusionType>
+    : public DiffusionLinearSystem<Contact<ContactKernelGradientType>, DiffusionType>
+{
+    Vecd *n_;
+    StdVec<StdVec<Real *>> contact_diffusive_flux_;
+    StdVec<Vecd *> contact_n_;
+
+  public:
+    template <typename... Args>
+    explicit DiffusionLinearSystem(Args &&...args);
+    virtual ~DiffusionLinearSystem() {};
+    inline void interaction(size_t index_i, Real dt = 0.0);
+};
+
+template <class ContactKernelGradientType, class DiffusionType>
+class DiffusionLinearSystem<Robin<ContactKernelGradientType>, DiffusionType>
+    : public DiffusionLinearSystem<Contact<ContactKernelGradientType>, DiffusionType>
+{
+    Vecd *n_;
+    StdVec<StdVec<Real *>> contact_convection_;
+    StdVec<StdVec<Real *>> contact_species_infinity_;
+    StdVec<Vecd *> contact_n_;
+
+  public:
+    template <typename... Args>
+    explicit DiffusionLinearSystem(Args &&...args);
+    virtual ~DiffusionLinearSystem() {};
+    inline void interaction(size_t index_i, Real dt = 0.0);
+};
+
+/**
+ * @class DiffusionKrylovSolver
+ * @brief Base class of Jacobi preconditioned Krylov solvers for implicit diffusion.
+ * @details The linear system is assembled at the beginning of each exec
+ * and the species are solved one after another, starting from their current values.
+ * exec(dt) carries out an implicit step of size dt, and exec() gives the steady state.
+ * The steady state requires Dirichlet or Robin boundary conditions, otherwise the linear system
+ * with only inner and Neumann interactions is singular and exec() exits with an error.
+ * The first interaction of the linear system type should be the inner one.
+ */
+template <class LinearSystemType>
+class DiffusionKrylovSolver : public BaseDynamics<void>
+{
+  public:
+    template <typename FirstArg, typename... OtherArgs>
+    explicit DiffusionKrylovSolver(FirstArg &first_arg, OtherArgs &&...other_args);
+    virtual ~DiffusionKrylovSolver() {};
+
+    void setTolerance(Real tolerance) { tolerance_ = tolerance; };
+    void setMaxIterations(size_t max_iterations) { max_iterations_ = max_iterations; };
+    /** largest number of iterations among the species in the last exec */
+    size_t NumberOfIterations() { return number_of_iterations_; };
+    /** largest relative residual among the species in the last exec */
+    Real RelativeResidual() { return relative_residual_; };
+    virtual void exec(Real dt = 0.0) override;
+
+  protected:
+    InteractionWithInitialization<LinearSystemType> linear_system_;
+    BaseParticles &particles_;
+    Real tolerance_;
+    size_t max_iterations_;
+    size_t number_of_iterations_;
+    Real relative_residual_;
+
+    Real *registerKrylovVector(size_t m, const std::string &vector_name);
+    IndexRange LoopRange() { return IndexRange(0, particles_.TotalRealParticles()); };
+    Real dot(Real *a, Real *b);
+    /** inner product weighted by the particle volume */
+    Real dot(Real *a, Real *b, Real *weight);
+    /** output = A input */
+    void applyOperator(size_t m, Real *input, Real *output);
+    /** output = D^-1 input with D the diagonal of A */
+    void precondition(size_t m, Real *input, Real *output);
+    /** residual = b - A x and returns the norm of b */
+    Real initializeResidual(size_t m, Real *residual);
+    /** whether the boundary terms fix the level of the steady state of species m */
+    bool isSteadyStateDetermined(size_t m);
+    /** solve species m and returns the number of iterations and the relative residual */
+    virtual std::pair<size_t, Real> solve(size_t m) = 0;
+};
+
+/**
+ * @class DiffusionConjugateGradient
+ * @brief Preconditioned conjugate gradient method.
+ * @details As the off-diagonal coefficients scale with the volume of the neighbor particle,
+ * the linear system is not symmetric for non-uniform particle volume.
+ * However, the system scaled row by row with the volume of the particle is symmetric,
+ * if the inter-particle diffusion coefficients are symmetric and no kernel gradient correction is used.
+ * The method is carried out on this scaled system, i.e. with the inner products weighted by the volume.
+ * For other linear systems, use DiffusionBiCGSTAB.
+ */
+template <class LinearSystemType>
+class DiffusionConjugateGradient : public DiffusionKrylovSolver<LinearSystemType>
+{
+  public:
+    template <typename... Args>
+    explicit DiffusionConjugateGradient(Args &&...args);
+    virtual ~DiffusionConjugateGradient() {};
+
+  protected:
+    StdVec<Real *> residual_, preconditioned_, direction_, product_;
+    virtual std::pair<size_t, Real> solve(size_t m) override;
+};
+
+/**
+ * @class DiffusionBiCGSTAB
+ * @brief Right preconditioned bi-conjugate gradient stabilized method
+ * for general, not necessarily symmetric, linear system.
+ */
+template <class LinearSystemType>
+class DiffusionBiCGSTAB : public DiffusionKrylovSolver<LinearSystemType>
+{
+  public:
+    template <typename... Args>
+    explicit DiffusionBiCGSTAB(Args &&...args);
+    virtual ~DiffusionBiCGSTAB() {};
+
+  protected:
+    StdVec<Real *> residual_, shadow_residual_, direction_, preconditioned_direction_;
+    StdVec<Real *> direction_product_, intermediate_, preconditioned_intermediate_, intermediate_product_;
+    virtual std::pair<size_t, Real> solve(size_t m) override;
+};
+
+template <class DiffusionType, class KernelGradientType, class ContactKernelGradientType,
+          template <typename... Parameters> typename... ContactInteractionTypes>
+class DiffusionBodyImplicitComplex
+    : public DiffusionBiCGSTAB<
+          ComplexInteraction<DiffusionLinearSystem<
+                                 Inner<KernelGradientType>, ContactInteractionTypes<ContactKernelGradientType>...>,
+                             DiffusionType>>
+{
+  public:
+    template <typename FirstArg, typename... OtherArgs>
+    explicit DiffusionBodyImplicitComplex(FirstArg &&first_arg, OtherArgs &&...other_args)
+        : DiffusionBiCGSTAB<
+              ComplexInteraction<DiffusionLinearSystem<
+                                     Inner<KernelGradientType>, ContactInteractionTypes<ContactKernelGradientType>...>,
+                                 DiffusionType>>(first_arg, std::forward<OtherArgs>(other_args)...){};
+    virtual ~DiffusionBodyImplicitComplex() {};
+};
+} // namespace SPH
+#endif // DIFFUSION_IMPLICIT_DYNAMICS_H
@@ -0,0 +1,564 @@
+/**
+ * @file 	diffusion_implicit_dynamics.hpp
+ * @brief 	This is the implicit diffusion dynamics applicable for all type bodies
+ * @author	Xiangyu Hu
+ */
+
+#ifndef DIFFUSION_IMPLICIT_DYNAMICS_HPP
+#define DIFFUSION_IMPLICIT_DYNAMICS_HPP
+
+#include "diffusion_implicit_dynamics.h"
+
+namespace SPH
+{
+//=================================================================================================//
+template <class DataDelegationType, class DiffusionType>
+template <class BodyRelationType>
+DiffusionLinearSystem<DataDelegationType, DiffusionType>::
+    DiffusionLinearSystem(BodyRelationType &body_relation)
+    : LocalDynamics(body_relation.getSPHBody()), DataDelegationType(body_relation),
+      Vol_(this->particles_->template getVariableDataByName<Real>("VolumetricMeasure"))
+{
+    getDiffusions();
+
+    for (auto &diffusion : diffusions_)
+    {
+        std::string diffusion_species_name = diffusion->DiffusionSpeciesName();
+        if (diffusion->GradientSpeciesName() != diffusion_species_name)
+        {
+            std::cout << "\n Error: implicit diffusion requires the same diffusion and gradient species, "
+                      << "but " << diffusion_species_name << " and " << diffusion->GradientSpeciesName() << " are given!" << std::endl;
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            exit(1);
+        }
+        diffusion_species_.push_back(this->particles_->template registerStateVariable<Real>(diffusion_species_name));
+        this->particles_->template addEvolvingVariable<Real>(diffusion_species_name);
+        this->particles_->template addVariableToWrite<Real>(diffusion_species_name);
+
+        size_t particles_bound = this->particles_->ParticlesBound();
+        diagonal_.push_back(this->particles_->template registerDiscreteVariable<Real>(
+            diffusion_species_name + "ImplicitDiagonal", particles_bound));
+        rhs_.push_back(this->particles_->template registerDiscreteVariable<Real>(
+            diffusion_species_name + "ImplicitRightHandSide", particles_bound));
+    }
+}
+//=================================================================================================//
+template <class DataDelegationType, class DiffusionType>
+void DiffusionLinearSystem<DataDelegationType, DiffusionType>::getDiffusions()
+{
+    AbstractDiffusion &abstract_diffusion = DynamicCast<AbstractDiffusion>(this, this->sph_body_.getBaseMaterial());
+    StdVec<AbstractDiffusion *> all_diffusions = abstract_diffusion.AllDiffusions();
+    for (auto &diffusion : all_diffusions)
+    {
+        diffusions_.push_back(DynamicCast<DiffusionType>(this, diffusion));
+    }
+}
+//=================================================================================================//
+template <class DataDelegationType, class DiffusionType>
+void DiffusionLinearSystem<DataDelegationType, DiffusionType>::initialization(size_t index_i, Real dt)
+{
+    Real inv_dt = dt > 0.0 ? 1.0 / dt : 0.0;
+    for (size_t m = 0; m < diffusions_.size(); ++m)
+    {
+        diagonal_[m][index_i] = inv_dt;
+        rhs_[m][index_i] = inv_dt * diffusion_species_[m][index_i];
+    }
+}
+//=================================================================================================//
+template <class KernelGradientType, class DiffusionType>
+template <typename... Args>
+DiffusionLinearSystem<Inner<KernelGradientType>, DiffusionType>::
+    DiffusionLinearSystem(Args &&...args)
+    : DiffusionLinearSystem<DataDelegateInner, DiffusionType>(std::forward<Args>(args)...),
+      kernel_gradient_(this->particles_) {}
+//=================================================================================================//
+template <class KernelGradientType, class DiffusionType>
+Real DiffusionLinearSystem<Inner<KernelGradientType>, DiffusionType>::
+    offDiagonalCoefficient(size_t m, size_t index_i, Neighborhood &inner_neighborhood, size_t n)
+{
+    size_t index_j = inner_neighborhood.j_[n];
+    Real dW_ijV_j = inner_neighborhood.dW_ij_[n] * this->Vol_[index_j];
+    Vecd &e_ij = inner_neighborhood.e_ij_[n];
+
+    Real diff_coeff_ij = this->diffusions_[m]->getInterParticleDiffusionCoeff(index_i, index_j, e_ij);
+    const Vecd &grad_ijV_j = this->kernel_gradient_(index_i, index_j, dW_ijV_j, e_ij);
+    Real surface_area_ij = 2.0 * grad_ijV_j.dot(e_ij) / inner_neighborhood.r_ij_[n];
+    return -diff_coeff_ij * surface_area_ij;
+}
+//=================================================================================================//
+template <class KernelGradientType, class DiffusionType>
+void DiffusionLinearSystem<Inner<KernelGradientType>, DiffusionType>::interaction(size_t index_i, Real dt)
+{
+    Neighborhood &inner_neighborhood = this->inner_configuration_[index_i];
+    for (size_t m = 0; m < this->diffusions_.size(); ++m)
+    {
+        Real diagonal = 0.0;
+        for (size_t n = 0; n != inner_neighborhood.current_size_; ++n)
+        {
+            diagonal += offDiagonalCoefficient(m, index_i, inner_neighborhood, n);
+        }
+        this->diagonal_[m][index_i] += diagonal;
+    }
+}
+//=================================================================================================//
+template <class KernelGradientType, class DiffusionType>
+Real DiffusionLinearSystem<Inner<KernelGradientType>, DiffusionType>::
+    matrixProduct(size_t m, size_t index_i, Real *input)
+{
+    Real product = this->diagonal_[m][index_i] * input[index_i];
+    Neighborhood &inner_neighborhood = this->inner_configuration_[index_i];
+    for (size_t n = 0; n != inner_neighborhood.current_size_; ++n)
+    {
+        size_t index_j = inner_neighborhood.j_[n];
+        product -= offDiagonalCoefficient(m, index_i, inner_neighborhood, n) * input[index_j];
+    }
+    return product;
+}
+//=================================================================================================//
+template <class KernelGradientType, class DiffusionType>
+Real DiffusionLinearSystem<Inner<KernelGradientType>, DiffusionType>::rowSum(size_t m, size_t index_i)
+{
+    Real row_sum = this->diagonal_[m][index_i];
+    Neighborhood &inner_neighborhood = this->inner_configuration_[index_i];
+    for (size_t n = 0; n != inner_neighborhood.current_size_; ++n)
+    {
+        row_sum -= offDiagonalCoefficient(m, index_i, inner_neighborhood, n);
+    }
+    return row_sum;
+}
+//=================================================================================================//
+template <class ContactKernelGradientType, class DiffusionType>
+template <typename... Args>
+DiffusionLinearSystem<Contact<ContactKernelGradientType>, DiffusionType>::
+    DiffusionLinearSystem(Args &&...args)
+    : DiffusionLinearSystem<DataDelegateContact, DiffusionType>(std::forward<Args>(args)...)
+{
+    for (size_t k = 0; k != this->contact_particles_.size(); ++k)
+    {
+        BaseParticles *contact_particles_k = this->contact_particles_[k];
+        contact_kernel_gradients_.push_back(ContactKernelGradientType(this->particles_, contact_particles_k));
+        contact_Vol_.push_back(contact_particles_k->template registerStateVariable<Real>("VolumetricMeasure"));
+    }
+}
+//=================================================================================================//
+template <class ContactKernelGradientType, class DiffusionType>
+template <typename... Args>
+DiffusionLinearSystem<Dirichlet<ContactKernelGradientType>, DiffusionType>::
+    DiffusionLinearSystem(Args &&...args)
+    : DiffusionLinearSystem<Contact<ContactKernelGradientType>, DiffusionType>(std::forward<Args>(args)...)
+{
+    contact_gradient_species_.resize(this->contact_particles_.size());
+    for (size_t k = 0; k != this->contact_particles_.size(); ++k)
+    {
+        BaseParticles *contact_particles_k = this->contact_particles_[k];
+        for (auto &diffusion : this->diffusions_)
+        {
+            std::string gradient_species_name = diffusion->GradientSpeciesName();
+            contact_gradient_species_[k].push_back(
+                contact_particles_k->template registerStateVariable<Real>(gradient_species_name));
+            contact_particles_k->template addVariableToWrite<Real>(gradient_species_name);
+        }
+    }
+}
+//=================================================================================================//
+template <class ContactKernelGradientType, class DiffusionType>
+void DiffusionLinearSystem<Dirichlet<ContactKernelGradientType>, DiffusionType>::
+    interaction(size_t index_i, Real dt)
+{
+    for (size_t k = 0; k < this->contact_configuration_.size(); ++k)
+    {
+        StdVec<Real *> &gradient_species_k = this->contact_gradient_species_[k];
+        Real *wall_Vol_k = this->contact_Vol_[k];
+        Neighborhood &contact_neighborhood = (*this->contact_configuration_[k])[index_i];
+        for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
+        {
+            size_t index_j = contact_neighborhood.j_[n];
+            Real dW_ijV_j = contact_neighborhood.dW_ij_[n] * wall_Vol_k[index_j];
+            Vecd &e_ij = contact_neighborhood.e_ij_[n];
+
+            const Vecd &grad_ijV_j = this->contact_kernel_gradients_[k](index_i, index_j, dW_ijV_j, e_ij);
+            Real area_ij = 2.0 * grad_ijV_j.dot(e_ij) / contact_neighborhood.r_ij_[n];
+            for (size_t m = 0; m < this->diffusions_.size(); ++m)
+            {
+                Real diff_coeff_ij = this->diffusions_[m]->getInterParticleDiffusionCoeff(index_i, index_i, e_ij);
+                // the wall value is taken as known, which is doubled as in the explicit relaxation
+                Real coefficient = -2.0 * diff_coeff_ij * area_ij;
+                this->diagonal_[m][index_i] += coefficient;
+                this->rhs_[m][index_i] += coefficient * gradient_species_k[m][index_j];
+            }
+        }
+    }
+}
+//=================================================================================================//
+template <class ContactKernelGradientType, class DiffusionType>
+template <typename... Args>
+DiffusionLinearSystem<Neumann<ContactKernelGradientType>, DiffusionType>::
+    DiffusionLinearSystem(Args &&...args)
+    : DiffusionLinearSystem<Contact<ContactKernelGradientType>, DiffusionType>(std::forward<Args>(args)...),
+      n_(this->particles_->template getVariableDataByName<Vecd>("NormalDirection"))
+{
+    contact_diffusive_flux_.resize(this->contact_particles_.size());
+    for (size_t k = 0; k != this->contact_particles_.size(); ++k)
+    {
+        BaseParticles *contact_particles_k = this->contact_particles_[k];
+        contact_n_.push_back(contact_particles_k->template getVariableDataByName<Vecd>("NormalDirection"));
+
+        for (auto &diffusion : this->diffusions_)
+        {
+            std::string diffusion_species_name = diffusion->DiffusionSpeciesName();
+            contact_diffusive_flux_[k].push_back(
+                contact_particles_k->template registerStateVariable<Real>(diffusion_species_name + "Flux"));
+        }
+    }
+}
+//=================================================================================================//
+template <class ContactKernelGradientType, class DiffusionType>
+void DiffusionLinearSystem<Neumann<ContactKernelGradientType>, DiffusionType>::
+    interaction(size_t index_i, Real dt)
+{
+    for (size_t k = 0; k < this->contact_configuration_.size(); ++k)
+    {
+        StdVec<Real *> &diffusive_flux_k = contact_diffusive_flux_[k];
+        Vecd *n_k = contact_n_[k];
+        Real *Vol_k = this->contact_Vol_[k];
+        Neighborhood &contact_neighborhood = (*this->contact_configuration_[k])[index_i];
+        for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
+        {
+            size_t index_j = contact_neighborhood.j_[n];
+            Real dW_ijV_j = contact_neighborhood.dW_ij_[n] * Vol_k[index_j];
+            Vecd &e_ij = contact_neighborhood.e_ij_[n];
+
+            const Vecd &grad_ijV_j = this->contact_kernel_gradients_[k](index_i, index_j, dW_ijV_j, e_ij);
+            Real area_ij_Neumann = grad_ijV_j.dot(n_[index_i] - n_k[index_j]);
+            for (size_t m = 0; m < this->diffusions_.size(); ++m)
+            {
+                this->rhs_[m][index_i] += area_ij_Neumann * diffusive_flux_k[m][index_j];
+            }
+        }
+    }
+}
+//=================================================================================================//
+template <class ContactKernelGradientType, class DiffusionType>
+template <typename... Args>
+DiffusionLinearSystem<Robin<ContactKernelGradientType>, DiffusionType>::
+    DiffusionLinearSystem(Args &&...args)
+    : DiffusionLinearSystem<Contact<ContactKernelGradientType>, DiffusionType>(std::forward<Args>(args)...),
+      n_(this->particles_->template getVariableDataByName<Vecd>("NormalDirection"))
+{
+    contact_convection_.resize(this->contact_particles_.size());
+    contact_species_infinity_.resize(this->contact_particles_.size());
+
+    for (size_t k = 0; k != this->contact_particles_.size(); ++k)
+    {
+        BaseParticles *contact_particles_k = this->contact_particles_[k];
+        contact_n_.push_back(contact_particles_k->template getVariableDataByName<Vecd>("NormalDirection"));
+
+        for (auto &diffusion : this->diffusions_)
+        {
+            std::string diffusion_species_name = diffusion->DiffusionSpeciesName();
+            contact_convection_[k].push_back(
+                contact_particles_k->template registerStateVariable<Real>(diffusion_species_name + "Convection"));
+            contact_species_infinity_[k].push_back(
+                contact_particles_k->template registerSingularVariable<Real>(diffusion_species_name + "Infinity")->Data());
+        }
+    }
+}
+//=================================================================================================//
+template <class ContactKernelGradientType, class DiffusionType>
+void DiffusionLinearSystem<Robin<ContactKernelGradientType>, DiffusionType>::
+    interaction(size_t index_i, Real dt)
+{
+    for (size_t k = 0; k < this->contact_configuration_.size(); ++k)
+    {
+        Vecd *n_k = contact_n_[k];
+        Real *Vol_k = this->contact_Vol_[k];
+        StdVec<Real *> &convection_k = contact_convection_[k];
+        StdVec<Real *> &species_infinity_k = contact_species_infinity_[k];
+
+        Neighborhood &contact_neighborhood = (*this->contact_configuration_[k])[index_i];
+        for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
+        {
+            size_t index_j = contact_neighborhood.j_[n];
+            Real dW_ijV_j = contact_neighborhood.dW_ij_[n] * Vol_k[index_j];
+            Vecd &e_ij = contact_neighborhood.e_ij_[n];
+
+            const Vecd &grad_ijV_j = this->contact_kernel_gradients_[k](index_i, index_j, dW_ijV_j, e_ij);
+            Real area_ij_Robin = grad_ijV_j.dot(n_[index_i] - n_k[index_j]);
+            for (size_t m = 0; m < this->diffusions_.size(); ++m)
+            {
+                Real coefficient = convection_k[m][index_j] * area_ij_Robin;
+                this->diagonal_[m][index_i] += coefficient;
+                this->rhs_[m][index_i] += coefficient * (*species_infinity_k[m]);
+            }
+        }
+    }
+}
+//=================================================================================================//
+template <class LinearSystemType>
+template <typename FirstArg, typename... OtherArgs>
+DiffusionKrylovSolver<LinearSystemType>::
+    DiffusionKrylovSolver(FirstArg &first_arg, OtherArgs &&...other_args)
+    : BaseDynamics<void>(),
+      linear_system_(first_arg, std::forward<OtherArgs>(other_args)...),
+      particles_(linear_system_.getSPHBody().getBaseParticles()),
+      tolerance_(1.0e-6), max_iterations_(1000),
+      number_of_iterations_(0), relative_residual_(0.0) {}
+//=================================================================================================//
+template <class LinearSystemType>
+Real *DiffusionKrylovSolver<LinearSystemType>::
+    registerKrylovVector(size_t m, const std::string &vector_name)
+{
+    return particles_.registerDiscreteVariable<Real>(
+        linear_system_.SpeciesName(m) + vector_name, particles_.ParticlesBound());
+}
+//=================================================================================================//
+template <class LinearSystemType>
+Real DiffusionKrylovSolver<LinearSystemType>::dot(Real *a, Real *b)
+{
+    return particle_reduce(ParallelPolicy(), LoopRange(), Real(0), ReduceSum<Real>(),
+                           [&](size_t i) -> Real
+                           { return a[i] * b[i]; });
+}
+//=================================================================================================//
+template <class LinearSystemType>
+Real DiffusionKrylovSolver<LinearSystemType>::dot(Real *a, Real *b, Real *weight)
+{
+    return particle_reduce(ParallelPolicy(), LoopRange(), Real(0), ReduceSum<Real>(),
+                           [&](size_t i) -> Real
+                           { return weight[i] * a[i] * b[i]; });
+}
+//=================================================================================================//
+template <class LinearSystemType>
+void DiffusionKrylovSolver<LinearSystemType>::applyOperator(size_t m, Real *input, Real *output)
+{
+    particle_for(ParallelPolicy(), LoopRange(),
+                 [&](size_t i)
+                 { output[i] = linear_system_.matrixProduct(m, i, input); });
+}
+//=================================================================================================//
+template <class LinearSystemType>
+void DiffusionKrylovSolver<LinearSystemType>::precondition(size_t m, Real *input, Real *output)
+{
+    Real *diagonal = linear_system_.Diagonal(m);
+    particle_for(ParallelPolicy(), LoopRange(),
+                 [&](size_t i)
+                 { output[i] = diagonal[i] > TinyReal ? input[i] / diagonal[i] : input[i]; });
+}
+//=================================================================================================//
+template <class LinearSystemType>
+Real DiffusionKrylovSolver<LinearSystemType>::initializeResidual(size_t m, Real *residual)
+{
+    Real *species = linear_system_.DiffusionSpecies(m);
+    Real *rhs = linear_system_.RightHandSide(m);
+    applyOperator(m, species, residual);
+    Real rhs_norm = particle_reduce(ParallelPolicy(), LoopRange(), Real(0), ReduceSum<Real>(),
+                                    [&](size_t i) -> Real
+                                    {
+                                        residual[i] = rhs[i] - residual[i];
+                                        return rhs[i] * rhs[i];
+                                    });
+    return rhs_norm > TinyReal ? sqrt(rhs_norm) : 1.0;
+}
+//=================================================================================================//
+template <class LinearSystemType>
+bool DiffusionKrylovSolver<LinearSystemType>::isSteadyStateDetermined(size_t m)
+{
+    // the rows of the inner and Neumann terms sum to zero up to round-off
+    Real *diagonal = linear_system_.Diagonal(m);
+    Real max_relative_row_sum =
+        particle_reduce(ParallelPolicy(), LoopRange(), Real(0), ReduceMax(),
+                        [&](size_t i) -> Real
+                        {
+                            return diagonal[i] > TinyReal ? ABS(linear_system_.rowSum(m, i)) / diagonal[i] : 0.0;
+                        });
+    return max_relative_row_sum > SqrtEps;
+}
+//=================================================================================================//
+template <class LinearSystemType>
+void DiffusionKrylovSolver<LinearSystemType>::exec(Real dt)
+{
+    ProfilingScope profiling_scope(this->profilingRecord(linear_system_.getSPHBody()), particles_.TotalRealParticles());
+    this->setUpdated(linear_system_.getSPHBody());
+    linear_system_.exec(dt);
+
+    if (dt <= 0.0)
+    {
+        for (size_t m = 0; m < linear_system_.NumberOfSpecies(); ++m)
+        {
+            if (!isSteadyStateDetermined(m))
+            {
+                std::cout << "\n Error: the steady state of " << linear_system_.SpeciesName(m)
+                          << " is not determined without Dirichlet or Robin boundary conditions, "
+                          << "the linear system is singular!" << std::endl;
+                std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+                exit(1);
+            }
+        }
+    }
+
+    number_of_iterations_ = 0;
+    relative_residual_ = 0.0;
+    for (size_t m = 0; m < linear_system_.NumberOfSpecies(); ++m)
+    {
+        std::pair<size_t, Real> iterations_and_residual = solve(m);
+        number_of_iterations_ = SMAX(number_of_iterations_, iterations_and_residual.first);
+        relative_residual_ = SMAX(relative_residual_, iterations_and_residual.second);
+    }
+}
+//=================================================================================================//
+template <class LinearSystemType>
+template <typename... Args>
+DiffusionConjugateGradient<LinearSystemType>::DiffusionConjugateGradient(Args &&...args)
+    : DiffusionKrylovSolver<LinearSystemType>(std::forward<Args>(args)...)
+{
+    for (size_t m = 0; m < this->linear_system_.NumberOfSpecies(); ++m)
+    {
+        residual_.push_back(this->registerKrylovVector(m, "KrylovResidual"));
+        preconditioned_.push_back(this->registerKrylovVector(m, "KrylovPreconditioned"));
+        direction_.push_back(this->registerKrylovVector(m, "KrylovDirection"));
+        product_.push_back(this->registerKrylovVector(m, "KrylovProduct"));
+    }
+}
+//=================================================================================================//
+template <class LinearSystemType>
+std::pair<size_t, Real> DiffusionConjugateGradient<LinearSystemType>::solve(size_t m)
+{
+    Real *species = this->linear_system_.DiffusionSpecies(m);
+    Real *r = residual_[m];
+    Real *z = preconditioned_[m];
+    Real *p = direction_[m];
+    Real *q = product_[m];
+    Real *Vol = this->linear_system_.VolumetricMeasure();
+
+    Real rhs_norm = this->initializeResidual(m, r);
+    this->precondition(m, r, z);
+    particle_for(ParallelPolicy(), this->LoopRange(), [&](size_t i)
+                 { p[i] = z[i]; });
+    Real rz = this->dot(r, z, Vol);
+    Real relative_residual = sqrt(this->dot(r, r)) / rhs_norm;
+
+    size_t ite = 0;
+    while (relative_residual > this->tolerance_ && ite < this->max_iterations_)
+    {
+        this->applyOperator(m, p, q);
+        Real alpha = rz / (this->dot(p, q, Vol) + TinyReal);
+        Real residual_norm = particle_reduce(ParallelPolicy(), this->LoopRange(), Real(0), ReduceSum<Real>(),
+                                             [&](size_t i) -> Real
+                                             {
+                                                 species[i] += alpha * p[i];
+                                                 r[i] -= alpha * q[i];
+                                                 return r[i] * r[i];
+                                             });
+        relative_residual = sqrt(residual_norm) / rhs_norm;
+        ite++;
+
+        this->precondition(m, r, z);
+        Real rz_new = this->dot(r, z, Vol);
+        Real beta = rz_new / (rz + TinyReal);
+        particle_for(ParallelPolicy(), this->LoopRange(), [&](size_t i)
+                     { p[i] = z[i] + beta * p[i]; });
+        rz = rz_new;
+    }
+    return std::make_pair(ite, relative_residual);
+}
+//=================================================================================================//
+template <class LinearSystemType>
+template <typename... Args>
+DiffusionBiCGSTAB<LinearSystemType>::DiffusionBiCGSTAB(Args &&...args)
+    : DiffusionKrylovSolver<LinearSystemType>(std::forward<Args>(args)...)
+{
+    for (size_t m = 0; m < this->linear_system_.NumberOfSpecies(); ++m)
+    {
+        residual_.push_back(this->registerKrylovVector(m, "KrylovResidual"));
+        shadow_residual_.push_back(this->registerKrylovVector(m, "KrylovShadowResidual"));
+        direction_.push_back(this->registerKrylovVector(m, "KrylovDirection"));
+        preconditioned_direction_.push_back(this->registerKrylovVector(m, "KrylovPreconditionedDirection"));
+        direction_product_.push_back(this->registerKrylovVector(m, "KrylovDirectionProduct"));
+        intermediate_.push_back(this->registerKrylovVector(m, "KrylovIntermediate"));
+        preconditioned_intermediate_.push_back(this->registerKrylovVector(m, "KrylovPreconditionedIntermediate"));
+        intermediate_product_.push_back(this->registerKrylovVector(m, "KrylovIntermediateProduct"));
+    }
+}
+//=================================================================================================//
+template <class LinearSystemType>
+std::pair<size_t, Real> DiffusionBiCGSTAB<LinearSystemType>::solve(size_t m)
+{
+    Real *species = this->linear_system_.DiffusionSpecies(m);
+    Real *r = residual_[m];
+    Real *r_hat = shadow_residual_[m];
+    Real *p = direction_[m];
+    Real *p_hat = preconditioned_direction_[m];
+    Real *v = direction_product_[m];
+    Real *s = intermediate_[m];
+    Real *s_hat = preconditioned_intermediate_[m];
+    Real *t = intermediate_product_[m];
+
+    Real rhs_norm = this->initializeResidual(m, r);
+    Real residual_norm = particle_reduce(ParallelPolicy(), this->LoopRange(), Real(0), ReduceSum<Real>(),
+                                         [&](size_t i) -> Real
+                                         {
+                                             r_hat[i] = r[i];
+                                             p[i] = 0.0;
+                                             v[i] = 0.0;
+                                             return r[i] * r[i];
+                                         });
+    Real relative_residual = sqrt(residual_norm) / rhs_norm;
+    Real rho = 1.0, alpha = 1.0, omega = 1.0;
+
+    size_t ite = 0;
+    while (relative_residual > this->tolerance_ && ite < this->max_iterations_)
+    {
+        Real rho_new = this->dot(r_hat, r);
+        if (ABS(rho_new) < TinyReal * residual_norm || ABS(omega) < TinyReal)
+        {
+            // breakdown, restart with the current residual as the shadow residual
+            particle_for(ParallelPolicy(), this->LoopRange(), [&](size_t i)
+                         {
+                             r_hat[i] = r[i];
+                             p[i] = 0.0;
+                             v[i] = 0.0; });
+            rho = alpha = omega = 1.0;
+            rho_new = residual_norm;
+        }
+        Real beta = (rho_new / rho) * (alpha / omega);
+        particle_for(ParallelPolicy(), this->LoopRange(), [&](size_t i)
+                     { p[i] = r[i] + beta * (p[i] - omega * v[i]); });
+        this->precondition(m, p, p_hat);
+        this->applyOperator(m, p_hat, v);
+        alpha = rho_new / (this->dot(r_hat, v) + TinyReal);
+        Real intermediate_norm = particle_reduce(ParallelPolicy(), this->LoopRange(), Real(0), ReduceSum<Real>(),
+                                                 [&](size_t i) -> Real
+                                                 {
+                                                     s[i] = r[i] - alpha * v[i];
+                                                     return s[i] * s[i];
+                                                 });
+        ite++;
+
+        if (sqrt(intermediate_norm) / rhs_norm < this->tolerance_)
+        {
+            particle_for(ParallelPolicy(), this->LoopRange(), [&](size_t i)
+                         {
+                             species[i] += alpha * p_hat[i];
+                             r[i] = s[i]; });
+            relative_residual = sqrt(intermediate_norm) / rhs_norm;
+            break;
+        }
+
+        this->precondition(m, s, s_hat);
+        this->applyOperator(m, s_hat, t);
+        omega = this->dot(t, s) / (this->dot(t, t) + TinyReal);
+        residual_norm = particle_reduce(ParallelPolicy(), this->LoopRange(), Real(0), ReduceSum<Real>(),
+                                        [&](size_t i) -> Real
+                                        {
+                                            species[i] += alpha * p_hat[i] + omega * s_hat[i];
+                                            r[i] = s[i] - omega * t[i];
+                                            return r[i] * r[i];
+                                        });
+        relative_residual = sqrt(residual_norm) / rhs_norm;
+        rho = rho_new;
+    }
+    return std::make_pair(ite, relative_residual);
+}
+//=================================================================================================//
+} // namespace SPH
+#endif // DIFFUSION_IMPLICIT_DYNAMICS_HPP
@@ -112,6 +112,7 @@ class SimpleDynamics : public LocalDynamicsType, public BaseDynamics<void>
 
     virtual void exec(Real dt = 0.0) override
     {
+        ProfilingScope profiling_scope(this->profilingRecord(this->getSPHBody()), this->identifier_.SizeOfLoopRange());
         this->setUpdated(this->identifier_.getSPHBody());
         this->setupDynamics(dt);
         particle_for(ExecutionPolicy(),
@@ -139,6 +140,7 @@ class ReduceDynamics : public LocalDynamicsType,
 
     virtual ReturnType exec(Real dt = 0.0) override
     {
+        ProfilingScope profiling_scope(this->profilingRecord(this->getSPHBody()), this->identifier_.SizeOfLoopRange());
         this->setupDynamics(dt);
         ReturnType temp = particle_reduce(ExecutionPolicy(),
                                           this->identifier_.LoopRange(), this->Reference(), this->getOperation(),
@@ -182,6 +184,7 @@ class BaseInteractionDynamics : public LocalDynamicsType, public BaseDynamics<vo
 
     virtual void exec(Real dt = 0.0) override
     {
+        ProfilingScope profiling_scope(this->profilingRecord(this->getSPHBody()), this->identifier_.SizeOfLoopRange());
         this->setUpdated(this->identifier_.getSPHBody());
         this->setupDynamics(dt);
         runInteraction(dt);
@@ -276,6 +279,7 @@ class InteractionWithUpdate : public InteractionDynamics<LocalDynamicsType, Exec
 
     virtual void exec(Real dt = 0.0) override
     {
+        ProfilingScope profiling_scope(this->profilingRecord(this->getSPHBody()), this->identifier_.SizeOfLoopRange());
         InteractionDynamics<LocalDynamicsType, ExecutionPolicy>::exec(dt);
         particle_for(ExecutionPolicy(),
                      this->identifier_.LoopRange(),
@@ -302,6 +306,7 @@ class InteractionWithInitialization : public InteractionDynamics<LocalDynamicsTy
 
     virtual void exec(Real dt = 0.0) override
     {
+        ProfilingScope profiling_scope(this->profilingRecord(this->getSPHBody()), this->identifier_.SizeOfLoopRange());
         particle_for(ExecutionPolicy(),
                      this->identifier_.LoopRange(),
                      [&](size_t i) { this->initialization(i, dt); });
@@ -327,6 +332,7 @@ class Dynamics1Level : public InteractionDynamics<LocalDynamicsType, ExecutionPo
 
     virtual void exec(Real dt = 0.0) override
     {
+        ProfilingScope profiling_scope(this->profilingRecord(this->getSPHBody()), this->identifier_.SizeOfLoopRange());
         this->setUpdated(this->identifier_.getSPHBody());
         this->setupDynamics(dt);
 
@@ -30,6 +30,13 @@
 #ifndef EXECUTION_POLICY_H
 #define EXECUTION_POLICY_H
 
+/** Hint for vectorizing a loop whose iterations are independent, effective when SPHINXSYS_USE_SIMD is on. */
+#if SPHINXSYS_USE_SIMD && !defined(_MSC_VER)
+#define SPH_SIMD_LOOP _Pragma("omp simd")
+#else
+#define SPH_SIMD_LOOP
+#endif
+
 namespace SPH
 {
 namespace execution
@@ -104,5 +104,157 @@ void DisposerOutflowDeletion::update(size_t index_i, Real dt)
     }
     mutex_switch_to_buffer_.unlock();
 }
+//=================================================================================================//
+BatchedEmitterInflowInjection::
+    BatchedEmitterInflowInjection(AlignedBoxPartByParticle &aligned_box_part, ParticleBuffer<Base> &buffer)
+    : EmitterInflowInjection(aligned_box_part, buffer),
+      body_part_particles_(aligned_box_part.LoopRange()) {}
+//=================================================================================================//
+void BatchedEmitterInflowInjection::setupDynamics(Real dt)
+{
+    size_t number_of_part_particles = body_part_particles_.size();
+    if (number_of_part_particles == 0)
+    {
+        return;
+    }
+    is_crossing_.resize(number_of_part_particles);
+    new_particle_offset_.resize(number_of_part_particles);
+
+    particle_for(ParallelPolicy(), IndexRange(0, number_of_part_particles),
+                 [&](size_t k)
+                 {
+                     size_t sorted_index = sorted_id_[body_part_particles_[k]];
+                     is_crossing_[k] = aligned_box_.checkUpperBound(pos_[sorted_index]) ? 1 : 0;
+                 });
+
+    std::exclusive_scan(is_crossing_.begin(), is_crossing_.end(), new_particle_offset_.begin(), UnsignedInt(0));
+    UnsignedInt number_of_new_particles =
+        new_particle_offset_[number_of_part_particles - 1] + is_crossing_[number_of_part_particles - 1];
+    if (number_of_new_particles == 0)
+    {
+        return;
+    }
+    buffer_.checkEnoughBuffer(*particles_, number_of_new_particles);
+
+    UnsignedInt total_real_particles = particles_->TotalRealParticles();
+    particle_for(ParallelPolicy(), IndexRange(0, number_of_part_particles),
+                 [&](size_t k)
+                 {
+                     if (is_crossing_[k] != 0)
+                     {
+                         UnsignedInt new_original_id = total_real_particles + new_particle_offset_[k];
+                         original_id_[new_original_id] = new_original_id;
+                         particles_->copyFromAnotherParticle(new_original_id, sorted_id_[body_part_particles_[k]]);
+                     }
+                 });
+    particles_->incrementTotalRealParticles(number_of_new_particles);
+}
+//=================================================================================================//
+void BatchedEmitterInflowInjection::update(size_t original_index_i, Real dt)
+{
+    size_t sorted_index_i = sorted_id_[original_index_i];
+    if (aligned_box_.checkUpperBound(pos_[sorted_index_i]))
+    {
+        /** Periodic bounding. */
+        pos_[sorted_index_i] = aligned_box_.getUpperPeriodic(pos_[sorted_index_i]);
+        rho_[sorted_index_i] = fluid_.ReferenceDensity();
+        p_[sorted_index_i] = fluid_.getPressure(rho_[sorted_index_i]);
+    }
+}
+//=================================================================================================//
+BatchedDisposerOutflowDeletion::
+    BatchedDisposerOutflowDeletion(AlignedBoxPartByCell &aligned_box_part)
+    : DisposerOutflowDeletion(aligned_box_part),
+      body_part_cells_(aligned_box_part.LoopRange()),
+      original_id_(particles_->ParticleOriginalIds()),
+      sorted_id_(particles_->ParticleSortedIds()) {}
+//=================================================================================================//
+void BatchedDisposerOutflowDeletion::setupDynamics(Real dt)
+{
+    size_t number_of_cells = body_part_cells_.size();
+    if (number_of_cells == 0)
+    {
+        return;
+    }
+    UnsignedInt total_real_particles = particles_->TotalRealParticles();
+    if (is_deleted_.size() < particles_->ParticlesBound())
+    {
+        is_deleted_.resize(particles_->ParticlesBound(), 0);
+    }
+    deletion_offset_.resize(number_of_cells);
+
+    particle_for(ParallelPolicy(), IndexRange(0, number_of_cells),
+                 [&](size_t c)
+                 {
+                     UnsignedInt number_of_deleted = 0;
+                     ConcurrentIndexVector &particle_indexes = *body_part_cells_[c];
+                     for (size_t num = 0; num < particle_indexes.size(); ++num)
+                     {
+                         size_t index_i = particle_indexes[num];
+                         if (index_i < total_real_particles && aligned_box_.checkUpperBound(pos_[index_i]))
+                         {
+                             is_deleted_[index_i] = 1;
+                             number_of_deleted++;
+                         }
+                     }
+                     deletion_offset_[c] = number_of_deleted;
+                 });
+
+    UnsignedInt number_of_deleted_in_last_cell = deletion_offset_[number_of_cells - 1];
+    std::exclusive_scan(deletion_offset_.begin(), deletion_offset_.end(), deletion_offset_.begin(), UnsignedInt(0));
+    UnsignedInt number_of_deleted = deletion_offset_[number_of_cells - 1] + number_of_deleted_in_last_cell;
+    if (number_of_deleted == 0)
+    {
+        return;
+    }
+
+    deleted_particles_.resize(number_of_deleted);
+    particle_for(ParallelPolicy(), IndexRange(0, number_of_cells),
+                 [&](size_t c)
+                 {
+                     UnsignedInt position = deletion_offset_[c];
+                     ConcurrentIndexVector &particle_indexes = *body_part_cells_[c];
+                     for (size_t num = 0; num < particle_indexes.size(); ++num)
+                     {
+                         size_t index_i = particle_indexes[num];
+                         if (index_i < total_real_particles && is_deleted_[index_i] != 0)
+                         {
+                             deleted_particles_[position++] = index_i;
+                         }
+                     }
+                 });
+
+    // the vacancies in front of the new bound are filled by the remaining particles behind it,
+    // the numbers of both are equal and the same as that of the deleted particles behind the bound
+    UnsignedInt new_total_real_particles = total_real_particles - number_of_deleted;
+    vacancies_.clear();
+    for (UnsignedInt index_i : deleted_particles_)
+    {
+        if (index_i < new_total_real_particles)
+            vacancies_.push_back(index_i);
+    }
+    fillers_.clear();
+    for (UnsignedInt index_i = new_total_real_particles; index_i != total_real_particles; ++index_i)
+    {
+        if (is_deleted_[index_i] == 0)
+            fillers_.push_back(index_i);
+    }
+
+    particle_for(ParallelPolicy(), IndexRange(0, vacancies_.size()),
+                 [&](size_t k)
+                 {
+                     UnsignedInt vacancy = vacancies_[k];
+                     UnsignedInt filler = fillers_[k];
+                     particles_->copyFromAnotherParticle(vacancy, filler);
+                     // update original and sorted_id as well
+                     std::swap(original_id_[vacancy], original_id_[filler]);
+                     sorted_id_[original_id_[vacancy]] = vacancy;
+                 });
+
+    particle_for(ParallelPolicy(), IndexRange(0, number_of_deleted),
+                 [&](size_t k)
+                 { is_deleted_[deleted_particles_[k]] = 0; });
+    particles_->decrementTotalRealParticles(number_of_deleted);
+}
 } // namespace fluid_dynamics
 } // namespace SPH
@@ -34,6 +34,7 @@
 #include "particle_reserve.h"
 
 #include <mutex>
+#include <numeric>
 
 namespace SPH
 {
@@ -254,6 +255,58 @@ class DisposerOutflowDeletion : public BaseLocalDynamics<BodyPartByCell>
     Vecd *pos_;
     AlignedBox &aligned_box_;
 };
+
+/**
+ * @class BatchedEmitterInflowInjection
+ * @brief Inject particles in a batch without mutex exclusion.
+ * @details The crossing particles are marked in parallel,
+ * their new real particle indices are obtained by a prefix scan
+ * and the states are copied concurrently to the new real particles.
+ * The periodic bounding of the crossing particles is done in update.
+ */
+class BatchedEmitterInflowInjection : public EmitterInflowInjection
+{
+  public:
+    BatchedEmitterInflowInjection(AlignedBoxPartByParticle &aligned_box_part, ParticleBuffer<Base> &buffer);
+    virtual ~BatchedEmitterInflowInjection(){};
+
+    virtual void setupDynamics(Real dt = 0.0) override;
+    void update(size_t original_index_i, Real dt = 0.0);
+
+  protected:
+    IndexVector &body_part_particles_;
+    StdLargeVec<UnsignedInt> is_crossing_;
+    StdLargeVec<UnsignedInt> new_particle_offset_;
+};
+
+/**
+ * @class BatchedDisposerOutflowDeletion
+ * @brief Delete particles in a batch without mutex exclusion.
+ * @details The particles running out are marked and gathered in parallel
+ * with the offsets of the cells from a prefix scan.
+ * The deleted particles with indices smaller than the new total number of real particles
+ * are then filled concurrently by the remaining particles behind this number.
+ * All is done in setupDynamics, as the particle indices in the cell lists
+ * are not valid anymore after the deletion.
+ */
+class BatchedDisposerOutflowDeletion : public DisposerOutflowDeletion
+{
+  public:
+    BatchedDisposerOutflowDeletion(AlignedBoxPartByCell &aligned_box_part);
+    virtual ~BatchedDisposerOutflowDeletion(){};
+
+    virtual void setupDynamics(Real dt = 0.0) override;
+    void update(size_t index_i, Real dt = 0.0){};
+
+  protected:
+    ConcurrentCellLists &body_part_cells_;
+    UnsignedInt *original_id_;
+    UnsignedInt *sorted_id_;
+    StdLargeVec<UnsignedInt> deletion_offset_; /**< offsets of deleted particles in cells */
+    StdLargeVec<UnsignedInt> is_deleted_;      /**< flags for all particles */
+    StdLargeVec<UnsignedInt> deleted_particles_;
+    StdLargeVec<UnsignedInt> vacancies_, fillers_;
+};
 } // namespace fluid_dynamics
 } // namespace SPH
 #endif // FLUID_BOUNDARY_H
\ No newline at end of file
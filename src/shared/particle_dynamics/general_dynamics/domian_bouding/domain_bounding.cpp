@@ -1,5 +1,9 @@
 #include "domain_bounding.h"
 
+#include "tbb/parallel_sort.h"
+
+#include <numeric>
+
 namespace SPH
 {
 //=================================================================================================//
@@ -15,53 +19,75 @@ PeriodicConditionUsingCellLinkedList::PeriodicCellLinkedList::
     : PeriodicBounding(bound_cells_data, real_body, periodic_box),
       cell_linked_list_(real_body.getCellLinkedList()) {}
 //=================================================================================================//
-void PeriodicConditionUsingCellLinkedList::
-    PeriodicCellLinkedList::checkUpperBound(ListDataVector &cell_list_data, Real dt)
+void PeriodicConditionUsingCellLinkedList::PeriodicCellLinkedList::collectGhostEntries()
 {
-    for (size_t num = 0; num < cell_list_data.size(); ++num)
-    {
-        Vecd particle_position = std::get<1>(cell_list_data[num]);
-        if (particle_position[axis_] < bounding_bounds_.second_[axis_] &&
-            particle_position[axis_] > (bounding_bounds_.second_[axis_] - cut_off_radius_max_))
-        {
-            Vecd translated_position = particle_position - periodic_translation_;
-            /** insert ghost particle to cell linked list */
-            mutex_cell_list_entry_.lock();
-            cell_linked_list_.InsertListDataEntry(cell_list_data[num].first, translated_position);
-            mutex_cell_list_entry_.unlock();
-        }
-    }
+    size_t number_of_bound_cells = bound_cells_data_[0].second.size() + bound_cells_data_[1].second.size();
+    ghost_offsets_.resize(number_of_bound_cells + 1);
+    ghost_offsets_[number_of_bound_cells] = 0;
+
+    particle_for(execution::ParallelPolicy(), IndexRange(0, number_of_bound_cells),
+                 [&](size_t k)
+                 {
+                     UnsignedInt number_of_ghosts = 0;
+                     forEachGhostEntry(k, [&](size_t index_i, const Vecd &translated_position)
+                                       { number_of_ghosts++; });
+                     ghost_offsets_[k] = number_of_ghosts;
+                 });
+
+    std::exclusive_scan(ghost_offsets_.begin(), ghost_offsets_.end(), ghost_offsets_.begin(), UnsignedInt(0));
+    ghost_entries_.resize(ghost_offsets_[number_of_bound_cells]);
+
+    particle_for(execution::ParallelPolicy(), IndexRange(0, number_of_bound_cells),
+                 [&](size_t k)
+                 {
+                     UnsignedInt position = ghost_offsets_[k];
+                     forEachGhostEntry(k, [&](size_t index_i, const Vecd &translated_position)
+                                       {
+                                           UnsignedInt target_cell = cell_linked_list_.ListDataCellIndex(index_i, translated_position);
+                                           ghost_entries_[position++] = GhostEntry(target_cell, ListData(index_i, translated_position));
+                                       });
+                 });
 }
 //=================================================================================================//
-void PeriodicConditionUsingCellLinkedList::
-    PeriodicCellLinkedList::checkLowerBound(ListDataVector &cell_list_data, Real dt)
+void PeriodicConditionUsingCellLinkedList::PeriodicCellLinkedList::insertGhostEntries()
 {
-    for (size_t num = 0; num < cell_list_data.size(); ++num)
+    // sorting by the key of target cell and entry index keeps
+    // the order of the ghost entries in each target cell deterministic
+    sorted_ghost_indices_.resize(ghost_entries_.size());
+    std::iota(sorted_ghost_indices_.begin(), sorted_ghost_indices_.end(), UnsignedInt(0));
+    tbb::parallel_sort(sorted_ghost_indices_.begin(), sorted_ghost_indices_.end(),
+                       [&](UnsignedInt a, UnsignedInt b)
+                       {
+                           return ghost_entries_[a].first < ghost_entries_[b].first ||
+                                  (ghost_entries_[a].first == ghost_entries_[b].first && a < b);
+                       });
+
+    target_cell_starts_.clear();
+    for (size_t k = 0; k != sorted_ghost_indices_.size(); ++k)
     {
-        Vecd particle_position = std::get<1>(cell_list_data[num]);
-        if (particle_position[axis_] > bounding_bounds_.first_[axis_] &&
-            particle_position[axis_] < (bounding_bounds_.first_[axis_] + cut_off_radius_max_))
-        {
-            Vecd translated_position = particle_position + periodic_translation_;
-            /** insert ghost particle to cell linked list */
-            mutex_cell_list_entry_.lock();
-            cell_linked_list_.InsertListDataEntry(cell_list_data[num].first, translated_position);
-            mutex_cell_list_entry_.unlock();
-        }
+        if (k == 0 || ghost_entries_[sorted_ghost_indices_[k]].first !=
+                          ghost_entries_[sorted_ghost_indices_[k - 1]].first)
+            target_cell_starts_.push_back(k);
     }
+    target_cell_starts_.push_back(sorted_ghost_indices_.size());
+
+    particle_for(execution::ParallelPolicy(), IndexRange(0, target_cell_starts_.size() - 1),
+                 [&](size_t n)
+                 {
+                     ListDataVector &cell_list_data = cell_linked_list_.getCellDataList(
+                         ghost_entries_[sorted_ghost_indices_[target_cell_starts_[n]]].first);
+                     for (size_t k = target_cell_starts_[n]; k != target_cell_starts_[n + 1]; ++k)
+                     {
+                         cell_list_data.push_back(ghost_entries_[sorted_ghost_indices_[k]].second);
+                     }
+                 });
 }
 //=================================================================================================//
 void PeriodicConditionUsingCellLinkedList::PeriodicCellLinkedList::exec(Real dt)
 {
     setupDynamics(dt);
-
-    particle_for(execution::ParallelPolicy(), bound_cells_data_[0].second,
-                 [&](ListDataVector *cell_ist)
-                 { checkLowerBound(*cell_ist, dt); });
-
-    particle_for(execution::ParallelPolicy(), bound_cells_data_[1].second,
-                 [&](ListDataVector *cell_ist)
-                 { checkUpperBound(*cell_ist, dt); });
+    collectGhostEntries();
+    insertGhostEntries();
 }
 //=================================================================================================//
 } // namespace SPH
@@ -142,14 +142,58 @@ class BasePeriodicCondition
 class PeriodicConditionUsingCellLinkedList : public BasePeriodicCondition<execution::ParallelPolicy>
 {
   protected:
+    /**
+     * @class PeriodicCellLinkedList
+     * @brief Insert the ghost entries of the particles near the bounds to the opposite cells.
+     * @details The ghost entries are inserted in two phases without mutex exclusion.
+     * First, the ghost entries of each bound cell are counted, scanned for the offsets,
+     * and written with their target cells in parallel.
+     * Then, after grouped by the target cells with a parallel sort,
+     * each target cell list is appended by a single task.
+     */
     class PeriodicCellLinkedList : public PeriodicBounding
     {
       protected:
-        std::mutex mutex_cell_list_entry_; /**< mutex exclusion for memory conflict */
+        using GhostEntry = std::pair<UnsignedInt, ListData>; /**< target cell and list data */
         BaseCellLinkedList &cell_linked_list_;
+        StdLargeVec<UnsignedInt> ghost_offsets_; /**< offsets of the ghost entries of the bound cells */
+        StdLargeVec<GhostEntry> ghost_entries_;
+        StdLargeVec<UnsignedInt> sorted_ghost_indices_; /**< ghost entries sorted by target cells */
+        StdVec<size_t> target_cell_starts_;             /**< the first sorted ghost entry for each target cell */
+
+        bool isWithinLowerLayer(const Vecd &particle_position)
+        {
+            return particle_position[axis_] > bounding_bounds_.first_[axis_] &&
+                   particle_position[axis_] < (bounding_bounds_.first_[axis_] + cut_off_radius_max_);
+        };
+
+        bool isWithinUpperLayer(const Vecd &particle_position)
+        {
+            return particle_position[axis_] < bounding_bounds_.second_[axis_] &&
+                   particle_position[axis_] > (bounding_bounds_.second_[axis_] - cut_off_radius_max_);
+        };
+
+        /** the lower bound cells are followed by the upper ones */
+        template <typename FunctionOnGhost>
+        void forEachGhostEntry(size_t bound_cell, const FunctionOnGhost &function)
+        {
+            size_t number_of_lower_cells = bound_cells_data_[0].second.size();
+            bool is_lower = bound_cell < number_of_lower_cells;
+            ListDataVector &cell_list_data = is_lower ? *bound_cells_data_[0].second[bound_cell]
+                                                      : *bound_cells_data_[1].second[bound_cell - number_of_lower_cells];
+            for (size_t num = 0; num < cell_list_data.size(); ++num)
+            {
+                Vecd particle_position = std::get<1>(cell_list_data[num]);
+                if (is_lower ? isWithinLowerLayer(particle_position) : isWithinUpperLayer(particle_position))
+                {
+                    function(cell_list_data[num].first, is_lower ? Vecd(particle_position + periodic_translation_)
+                                                                 : Vecd(particle_position - periodic_translation_));
+                }
+            }
+        };
 
-        virtual void checkLowerBound(ListDataVector &cell_list_data, Real dt = 0.0);
-        virtual void checkUpperBound(ListDataVector &cell_list_data, Real dt = 0.0);
+        void collectGhostEntries();
+        void insertGhostEntries();
 
       public:
         PeriodicCellLinkedList(StdVec<CellLists> &bound_cells_data,
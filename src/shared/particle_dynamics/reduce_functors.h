@@ -144,5 +144,36 @@ struct ReduceReference<ReduceUpperBound>
     static inline const Vecd value = MinReal * Vecd::Ones();
 };
 
+/**
+ * @class ReduceTuple
+ * @brief Element-wise reduction of a tuple, each element with its own operation.
+ * Used for evaluating several reductions in a single loop with host execution policies only,
+ * since the tuple is not supported by device reductions.
+ */
+template <class... Operations>
+struct ReduceTuple : ReturnFunction<std::tuple<typename Operations::ReturnType...>>
+{
+    using ReturnType = std::tuple<typename Operations::ReturnType...>;
+    std::tuple<Operations...> operations_;
+
+    ReturnType operator()(const ReturnType &x, const ReturnType &y) const
+    {
+        return reduceElements(x, y, std::index_sequence_for<Operations...>{});
+    };
+
+  protected:
+    template <std::size_t... Is>
+    ReturnType reduceElements(const ReturnType &x, const ReturnType &y, std::index_sequence<Is...>) const
+    {
+        return ReturnType(std::get<Is>(operations_)(std::get<Is>(x), std::get<Is>(y))...);
+    };
+};
+
+template <class... Operations>
+struct ReduceReference<ReduceTuple<Operations...>>
+{
+    using ReturnType = std::tuple<typename Operations::ReturnType...>;
+    static inline const ReturnType value = ReturnType(ReduceReference<Operations>::value...);
+};
 } // namespace SPH
 #endif // REDUCE_FUNCTORS_H
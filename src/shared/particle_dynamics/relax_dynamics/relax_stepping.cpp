@@ -53,7 +53,7 @@ void RelaxationResidue<Contact<>>::interaction(size_t index_i, Real dt)
 RelaxationScaling::RelaxationScaling(SPHBody &sph_body)
     : LocalDynamicsReduce<ReduceMax>(sph_body),
       residue_(particles_->getVariableDataByName<Vecd>("ZeroOrderResidue")),
-      h_ref_(sph_body.getSPHAdaptation().ReferenceSmoothingLength()) {}
+      h_ref_(sph_body.getSPHAdaptation().ReferenceSmoothingLength()), max_residue_(MaxReal) {}
 //=================================================================================================//
 Real RelaxationScaling::reduce(size_t index_i, Real dt)
 {
@@ -62,6 +62,7 @@ Real RelaxationScaling::reduce(size_t index_i, Real dt)
 //=================================================================================================//
 Real RelaxationScaling::outputResult(Real reduced_value)
 {
+    max_residue_ = reduced_value;
     return 0.0625 * h_ref_ / (reduced_value + TinyReal);
 }
 //=================================================================================================//
@@ -113,6 +113,7 @@ class RelaxationResidue<Contact<>>
 /**
  * @class RelaxationScaling
  * @brief Obtain the scale for a particle relaxation step
+ * @details The maximum residue is kept for checking the convergence of the relaxation.
  */
 class RelaxationScaling : public LocalDynamicsReduce<ReduceMax>
 {
@@ -121,10 +122,13 @@ class RelaxationScaling : public LocalDynamicsReduce<ReduceMax>
     virtual ~RelaxationScaling() {};
     Real reduce(size_t index_i, Real dt = 0.0);
     virtual Real outputResult(Real reduced_value);
+    /** maximum residue of the last step scaled by the reference smoothing length */
+    Real DimensionlessResidue() { return max_residue_ * h_ref_; };
 
   protected:
     Vecd *residue_;
     Real h_ref_;
+    Real max_residue_;
 };
 
 /**
@@ -159,6 +163,15 @@ class UpdateSmoothingLengthRatioByShape : public LocalDynamics
     void update(size_t index_i, Real dt = 0.0);
 };
 
+/**
+ * @class RelaxationStep
+ * @brief A complete particle relaxation step.
+ * @details Besides running a given number of steps, the relaxation can be stopped
+ * when the dimensionless residue of the last step is below a tolerance.
+ * With relaxed particle caching enabled in the SPH system, the particles relaxed to convergence
+ * are saved in the reload folder, and a later run with the same geometry, resolution
+ * and relaxation parameters reads them back instead of relaxing again.
+ */
 template <class RelaxationResidueType>
 class RelaxationStep : public BaseDynamics<void>
 {
@@ -168,6 +181,15 @@ class RelaxationStep : public BaseDynamics<void>
     virtual ~RelaxationStep() {};
     SimpleDynamics<ShapeSurfaceBounding> &SurfaceBounding() { return surface_bounding_; };
     virtual void exec(Real dt = 0.0) override;
+    Real getResidue() { return relaxation_scaling_.DimensionlessResidue(); };
+    bool isConverged(Real tolerance) { return getResidue() < tolerance; };
+    /** returns the number of relaxation steps, which is zero if the particles are read from the cache */
+    size_t relaxToConvergence(Real tolerance, size_t max_steps);
+    /** the pre-step function, e.g. updating the smoothing length ratio, is called before each step */
+    template <typename PreStepFunction>
+    size_t relaxToConvergence(Real tolerance, size_t max_steps, const PreStepFunction &pre_step);
+    /** the key of the relaxation parameters, also for reloading the cached particles by a particle generator */
+    static std::string RelaxationKey(Real tolerance, size_t max_steps);
 
   protected:
     RealBody &real_body_;
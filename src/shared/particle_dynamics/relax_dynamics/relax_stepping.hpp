@@ -3,6 +3,10 @@
 
 #include "relax_stepping.h"
 
+#include "relaxed_particle_cache.h"
+
+#include <typeinfo>
+
 namespace SPH
 {
 namespace relax_dynamics
@@ -48,6 +52,52 @@ void RelaxationStep<RelaxationResidueType>::exec(Real dt)
     surface_bounding_.exec();
 }
 //=================================================================================================//
+template <class RelaxationResidueType>
+std::string RelaxationStep<RelaxationResidueType>::RelaxationKey(Real tolerance, size_t max_steps)
+{
+    std::stringstream key;
+    key << typeid(RelaxationResidueType).name() << ",tolerance:" << std::hexfloat << tolerance
+        << ",max_steps:" << max_steps;
+    return key.str();
+}
+//=================================================================================================//
+template <class RelaxationResidueType>
+size_t RelaxationStep<RelaxationResidueType>::relaxToConvergence(Real tolerance, size_t max_steps)
+{
+    return relaxToConvergence(tolerance, max_steps, [] {});
+}
+//=================================================================================================//
+template <class RelaxationResidueType>
+template <typename PreStepFunction>
+size_t RelaxationStep<RelaxationResidueType>::
+    relaxToConvergence(Real tolerance, size_t max_steps, const PreStepFunction &pre_step)
+{
+    RelaxedParticleCache relaxed_particle_cache(real_body_, real_body_.getName(), RelaxationKey(tolerance, max_steps));
+    BaseParticles &base_particles = real_body_.getBaseParticles();
+    if (relaxed_particle_cache.readParticles(base_particles))
+    {
+        return 0;
+    }
+
+    size_t step = 0;
+    while (step < max_steps)
+    {
+        pre_step();
+        exec();
+        step++;
+        if (isConverged(tolerance))
+        {
+            break;
+        }
+    }
+
+    if (relaxed_particle_cache.isCaching())
+    {
+        relaxed_particle_cache.writeParticles(base_particles);
+    }
+    return step;
+}
+//=================================================================================================//
 } // namespace relax_dynamics
 } // namespace SPH
 #endif // RELAX_STEPPING_HPP
@@ -104,13 +104,21 @@ class ParticleGenerator<ObserverParticles> : public ParticleGenerator<BasePartic
 };
 
 class Reload;
-template <typename ParticlesType> // generate particles by reloading dynamically relaxed particles
+/**
+ * Generate particles by reloading dynamically relaxed particles.
+ * With relaxed particle caching and a given relaxation key (see RelaxationStep::RelaxationKey),
+ * the particles relaxed for the same geometry, resolution and relaxation parameters
+ * are reloaded from the binary cache file, otherwise from the xml reload file.
+ */
+template <typename ParticlesType>
 class ParticleGenerator<ParticlesType, Reload> : public ParticleGenerator<ParticlesType>
 {
     std::string file_path_;
+    bool is_reload_from_cache_;
 
   public:
-    ParticleGenerator(SPHBody &sph_body, ParticlesType &particles, const std::string &reload_body_name);
+    ParticleGenerator(SPHBody &sph_body, ParticlesType &particles, const std::string &reload_body_name,
+                      const std::string &relaxation_key = "");
     virtual ~ParticleGenerator(){};
     virtual void prepareGeometricData() override;
     virtual void setAllParticleBounds() override;
@@ -5,13 +5,15 @@
 
 #include "base_body.h"
 #include "base_particles.hpp"
+#include "relaxed_particle_cache.h"
 
 namespace SPH
 {
 //=================================================================================================//
 template <typename ParticlesType>
 ParticleGenerator<ParticlesType, Reload>::
-    ParticleGenerator(SPHBody &sph_body, ParticlesType &particles, const std::string &reload_body_name)
+    ParticleGenerator(SPHBody &sph_body, ParticlesType &particles, const std::string &reload_body_name,
+                      const std::string &relaxation_key)
     : ParticleGenerator<ParticlesType>(sph_body, particles)
 {
     std::string reload_folder = sph_body.getSPHSystem().getIOEnvironment().reload_folder_;
@@ -22,19 +24,36 @@ ParticleGenerator<ParticlesType, Reload>::
         exit(1);
     }
 
-    file_path_ = reload_folder + "/" + reload_body_name + "_rld.xml";
+    RelaxedParticleCache relaxed_particle_cache(sph_body, reload_body_name, relaxation_key);
+    is_reload_from_cache_ = !relaxation_key.empty() && relaxed_particle_cache.isAvailable();
+    file_path_ = is_reload_from_cache_ ? relaxed_particle_cache.CacheFilePath()
+                                       : reload_folder + "/" + reload_body_name + "_rld.xml";
 }
 //=================================================================================================//
 template <typename ParticlesType>
 void ParticleGenerator<ParticlesType, Reload>::prepareGeometricData()
 {
-    this->base_particles_.readReloadXmlFile(file_path_);
+    if (is_reload_from_cache_)
+    {
+        this->base_particles_.readReloadBinaryFile(file_path_);
+    }
+    else
+    {
+        this->base_particles_.readReloadXmlFile(file_path_);
+    }
 }
 //=================================================================================================//
 template <typename ParticlesType>
 void ParticleGenerator<ParticlesType, Reload>::setAllParticleBounds()
 {
-    this->base_particles_.initializeAllParticlesBoundsFromReloadXml();
+    if (is_reload_from_cache_)
+    {
+        this->base_particles_.initializeAllParticlesBoundsFromReloadBinary();
+    }
+    else
+    {
+        this->base_particles_.initializeAllParticlesBoundsFromReloadXml();
+    }
 };
 //=================================================================================================//
 template <typename ParticlesType>
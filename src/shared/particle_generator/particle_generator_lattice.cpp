@@ -2,7 +2,9 @@
 
 #include "adaptation.h"
 #include "base_body.h"
+#include "base_mesh.h"
 #include "complex_geometry.h"
+#include "mesh_iterators.hpp"
 
 namespace SPH
 {
@@ -20,6 +22,59 @@ GeneratingMethod<Lattice>::GeneratingMethod(SPHBody &sph_body)
     }
 }
 //=================================================================================================//
+StdVec<StdVec<Vecd>> GeneratingMethod<Lattice>::findContainedLatticePositions(const Mesh &mesh)
+{
+    Arrayi number_of_lattices = mesh.AllCells();
+    Arrayi number_of_blocks = (number_of_lattices + (block_size_ - 1) * Arrayi::Ones()) / block_size_;
+
+    // 1 for blocks inside, -1 for blocks outside and 0 for blocks near the surface
+    StdVec<int> block_containment(number_of_blocks.prod(), 0);
+    mesh_parallel_for(
+        MeshRange(Arrayi::Zero(), number_of_blocks),
+        [&](const Arrayi &block_index)
+        {
+            Arrayi first_cell = block_index * block_size_;
+            Arrayi last_cell = (first_cell + (block_size_ - 1) * Arrayi::Ones()).min(number_of_lattices - Arrayi::Ones());
+            Vecd first_position = mesh.CellPositionFromIndex(first_cell);
+            Vecd last_position = mesh.CellPositionFromIndex(last_cell);
+            Real block_radius = 0.5 * (last_position - first_position).norm() + lattice_spacing_;
+            Real signed_distance = initial_shape_.findSignedDistance(0.5 * (first_position + last_position));
+            if (ABS(signed_distance) > block_radius)
+            {
+                block_containment[mesh.transferMeshIndexTo1D(number_of_blocks, block_index)] =
+                    signed_distance < 0.0 ? 1 : -1;
+            }
+        });
+
+    // each slab of cells with the same first index is collected separately
+    StdVec<StdVec<Vecd>> slab_positions(number_of_lattices[0]);
+    parallel_for(
+        IndexRange(0, number_of_lattices[0]),
+        [&](const IndexRange &r)
+        {
+            for (size_t i = r.begin(); i != r.end(); ++i)
+            {
+                Arrayi slab_lower = Arrayi::Zero();
+                slab_lower[0] = i;
+                Arrayi slab_upper = number_of_lattices;
+                slab_upper[0] = i + 1;
+                mesh_for(MeshRange(slab_lower, slab_upper),
+                         [&](const Arrayi &cell_index)
+                         {
+                             int containment =
+                                 block_containment[mesh.transferMeshIndexTo1D(number_of_blocks, cell_index / block_size_)];
+                             Vecd position = mesh.CellPositionFromIndex(cell_index);
+                             if (containment == 1 || (containment == 0 && initial_shape_.checkContain(position)))
+                             {
+                                 slab_positions[i].push_back(position);
+                             }
+                         });
+            }
+        });
+
+    return slab_positions;
+}
+//=================================================================================================//
 ParticleGenerator<BaseParticles, Lattice>::
     ParticleGenerator(SPHBody &sph_body, BaseParticles &base_particles)
     : ParticleGenerator<BaseParticles>(sph_body, base_particles),
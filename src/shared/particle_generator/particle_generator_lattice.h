@@ -36,6 +36,7 @@ namespace SPH
 {
 
 class Shape;
+class Mesh;
 class ParticleRefinementByShape;
 class SurfaceParticles;
 
@@ -50,6 +51,19 @@ class GeneratingMethod<Lattice>
     Real lattice_spacing_;      /**< Initial particle spacing. */
     BoundingBox domain_bounds_; /**< Domain bounds. */
     Shape &initial_shape_;      /**< Geometry shape for body. */
+    /** number of lattice cells along each direction of a block classified together */
+    static constexpr int block_size_ = 8;
+
+    /**
+     * Find the positions of the lattice cells contained by the initial shape in parallel.
+     * A block of cells far from the surface is found inside or outside from the signed distance of its center,
+     * only the cells of the blocks near the surface are checked individually.
+     * Therefore, the containment queries of the shape are carried out concurrently,
+     * which are read only for all shapes, including level set shapes once their level sets are published.
+     * The positions are given in slabs of the first lattice index, which are not merged to avoid copying,
+     * so that looping over the slabs in turn gives the same order as a sequential loop over the lattice.
+     */
+    StdVec<StdVec<Vecd>> findContainedLatticePositions(const Mesh &mesh);
 };
 
 template <>
@@ -0,0 +1,83 @@
+#include "relaxed_particle_cache.h"
+
+#include "base_body.h"
+#include "base_particles.h"
+#include "geometry_key.h"
+#include "sph_system.h"
+
+#include <filesystem>
+namespace fs = std::filesystem;
+
+namespace SPH
+{
+//=================================================================================================//
+RelaxedParticleCache::RelaxedParticleCache(SPHBody &sph_body, const std::string &body_name,
+                                           const std::string &relaxation_key)
+    : cache_folder_(sph_body.getSPHSystem().RelaxedParticleCaching()
+                        ? sph_body.getSPHSystem().getIOEnvironment().reload_folder_
+                        : ""),
+      body_name_(body_name), relaxation_key_(relaxation_key)
+{
+    if (isCaching())
+    {
+        SPHAdaptation &sph_adaptation = sph_body.getSPHAdaptation();
+        geometry_key_ = generateGeometryKey(sph_body.getInitialShape(), sph_adaptation, sph_adaptation.MinimumSpacing());
+    }
+}
+//=================================================================================================//
+std::string RelaxedParticleCache::CacheFilePath()
+{
+    FNVHash key_hash;
+    key_hash.add(FullKey());
+    return cache_folder_ + "/" + body_name_ + "_" + key_hash.HexValue() + "_rld.bin";
+}
+//=================================================================================================//
+bool RelaxedParticleCache::loadCacheFile(BinaryColumnFile &binary_file)
+{
+    if (!isCaching() || !fs::exists(CacheFilePath()))
+    {
+        return false;
+    }
+
+    binary_file.loadFile(CacheFilePath());
+    BinaryColumnFile::Column *key = binary_file.findColumn("Key");
+    if (key == nullptr)
+    {
+        return false;
+    }
+    return std::string(key->data_, key->number_of_values_) == FullKey();
+}
+//=================================================================================================//
+bool RelaxedParticleCache::isAvailable()
+{
+    BinaryColumnFile binary_file;
+    return loadCacheFile(binary_file);
+}
+//=================================================================================================//
+bool RelaxedParticleCache::readParticles(BaseParticles &base_particles)
+{
+    BinaryColumnFile binary_file;
+    if (!loadCacheFile(binary_file))
+    {
+        return false;
+    }
+
+    BinaryColumnFile::Column *position = binary_file.findColumn("Position");
+    if (position == nullptr || position->number_of_values_ != base_particles.TotalRealParticles())
+    {
+        return false;
+    }
+    base_particles.readParticlesFromBinaryForRestart(CacheFilePath());
+    return true;
+}
+//=================================================================================================//
+void RelaxedParticleCache::writeParticles(BaseParticles &base_particles)
+{
+    if (!fs::exists(cache_folder_))
+    {
+        fs::create_directory(cache_folder_);
+    }
+    base_particles.writeParticlesToBinaryForReload(CacheFilePath(), FullKey());
+}
+//=================================================================================================//
+} // namespace SPH
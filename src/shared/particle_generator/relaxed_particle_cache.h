@@ -0,0 +1,72 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file relaxed_particle_cache.h
+ * @brief Binary cache of relaxed particles in the reload folder.
+ * @details The cache file is identified by a key from the body shape, the adaptation and the kernel (see geometry_key.h),
+ * which gives the particles generated for the same geometry with the same resolution.
+ * The relaxation parameters are appended to the key, which identifies the cache file and is saved in it,
+ * so that the particles relaxed with other parameters are neither reloaded nor overwritten.
+ * @author Xiangyu Hu
+ */
+
+#ifndef RELAXED_PARTICLE_CACHE_H
+#define RELAXED_PARTICLE_CACHE_H
+
+#include "base_data_package.h"
+#include "binary_column_file.h"
+#include "sphinxsys_containers.h"
+
+#include <string>
+
+namespace SPH
+{
+class SPHBody;
+class BaseParticles;
+
+class RelaxedParticleCache
+{
+  public:
+    RelaxedParticleCache(SPHBody &sph_body, const std::string &body_name, const std::string &relaxation_key);
+    ~RelaxedParticleCache(){};
+
+    /** caching is enabled in the SPH system */
+    bool isCaching() { return !cache_folder_.empty(); };
+    std::string CacheFilePath();
+    /** the cache file exists for the same geometry, resolution and relaxation parameters */
+    bool isAvailable();
+    /** read the particles only if available and of the same total number */
+    bool readParticles(BaseParticles &base_particles);
+    void writeParticles(BaseParticles &base_particles);
+
+  protected:
+    std::string cache_folder_; /**< empty if the relaxed particles are not cached */
+    std::string body_name_;
+    std::string geometry_key_;
+    std::string relaxation_key_;
+
+    std::string FullKey() { return geometry_key_ + ";relaxation:" + relaxation_key_; };
+    bool loadCacheFile(BinaryColumnFile &binary_file);
+};
+} // namespace SPH
+#endif // RELAXED_PARTICLE_CACHE_H
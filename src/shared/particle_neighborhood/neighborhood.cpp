@@ -22,6 +22,121 @@ void Neighborhood::removeANeighbor(size_t neighbor_n)
     e_ij_[neighbor_n] = e_ij_[current_size_];
 }
 //=================================================================================================//
+void Neighborhood::viewNeighbors(size_t neighbor_size, size_t *j, Real *W_ij,
+                                 Real *dW_ij, Real *r_ij, Vecd *e_ij)
+{
+    current_size_ = neighbor_size;
+    allocated_size_ = neighbor_size;
+    j_.view(j, neighbor_size);
+    W_ij_.view(W_ij, neighbor_size);
+    dW_ij_.view(dW_ij, neighbor_size);
+    r_ij_.view(r_ij, neighbor_size);
+    e_ij_.view(e_ij, neighbor_size);
+}
+//=================================================================================================//
+void Neighborhood::releaseNeighbors()
+{
+    current_size_ = 0;
+    if (j_.isView())
+    {
+        allocated_size_ = 0;
+        j_.releaseView();
+        W_ij_.releaseView();
+        dW_ij_.releaseView();
+        r_ij_.releaseView();
+        e_ij_.releaseView();
+    }
+}
+//=================================================================================================//
+void CompactParticleConfiguration::resize(size_t particles_bound)
+{
+    neighbor_size_.resize(particles_bound, 0);
+    offset_.resize(particles_bound + 1, 0);
+    size_t number_of_blocks = (particles_bound + block_size_ - 1) / block_size_;
+    block_buffers_.resize(number_of_blocks);
+    block_offset_.resize(number_of_blocks + 1, 0);
+}
+//=================================================================================================//
+void CompactParticleConfiguration::resetBlockBuffers(size_t total_real_particles)
+{
+    size_t number_of_blocks = (total_real_particles + block_size_ - 1) / block_size_;
+    for (size_t k = 0; k != number_of_blocks; ++k)
+    {
+        block_buffers_[k].current_size_ = 0;
+    }
+}
+//=================================================================================================//
+void CompactParticleConfiguration::packBlockBuffers(size_t total_real_particles)
+{
+    size_t number_of_blocks = (total_real_particles + block_size_ - 1) / block_size_;
+    block_offset_[0] = 0;
+    for (size_t k = 0; k != number_of_blocks; ++k)
+    {
+        block_offset_[k + 1] = block_offset_[k] + block_buffers_[k].current_size_;
+    }
+    total_neighbors_ = block_offset_[number_of_blocks];
+
+    if (j_.size() < total_neighbors_)
+    {
+        j_.resize(total_neighbors_);
+        W_ij_.resize(total_neighbors_);
+        dW_ij_.resize(total_neighbors_);
+        r_ij_.resize(total_neighbors_);
+        e_ij_.resize(total_neighbors_);
+    }
+
+    parallel_for(
+        IndexRange(0, number_of_blocks),
+        [&](const IndexRange &r)
+        {
+            for (size_t k = r.begin(); k != r.end(); ++k)
+            {
+                Neighborhood &buffer = block_buffers_[k];
+                size_t block_begin = block_offset_[k];
+                std::copy(buffer.j_.data(), buffer.j_.data() + buffer.current_size_, j_.begin() + block_begin);
+                std::copy(buffer.W_ij_.data(), buffer.W_ij_.data() + buffer.current_size_, W_ij_.begin() + block_begin);
+                std::copy(buffer.dW_ij_.data(), buffer.dW_ij_.data() + buffer.current_size_, dW_ij_.begin() + block_begin);
+                std::copy(buffer.r_ij_.data(), buffer.r_ij_.data() + buffer.current_size_, r_ij_.begin() + block_begin);
+                std::copy(buffer.e_ij_.data(), buffer.e_ij_.data() + buffer.current_size_, e_ij_.begin() + block_begin);
+
+                size_t particle_end = SMIN((k + 1) * block_size_, total_real_particles);
+                size_t running_offset = block_begin;
+                for (size_t i = k * block_size_; i != particle_end; ++i)
+                {
+                    offset_[i] = running_offset;
+                    running_offset += neighbor_size_[i];
+                }
+            }
+        },
+        ap);
+    offset_[total_real_particles] = total_neighbors_;
+}
+//=================================================================================================//
+void CompactParticleConfiguration::
+    viewNeighborhoods(ParticleConfiguration &particle_configuration, size_t total_real_particles)
+{
+    parallel_for(
+        IndexRange(0, particle_configuration.size()),
+        [&](const IndexRange &r)
+        {
+            for (size_t i = r.begin(); i != r.end(); ++i)
+            {
+                if (i < total_real_particles)
+                {
+                    size_t begin = offset_[i];
+                    particle_configuration[i].viewNeighbors(
+                        neighbor_size_[i], j_.data() + begin, W_ij_.data() + begin,
+                        dW_ij_.data() + begin, r_ij_.data() + begin, e_ij_.data() + begin);
+                }
+                else
+                {
+                    particle_configuration[i].releaseNeighbors();
+                }
+            }
+        },
+        ap);
+}
+//=================================================================================================//
 void NeighborBuilder::createNeighbor(Neighborhood &neighborhood, const Real &distance,
                                      const Vecd &displacement, size_t index_j)
 {
@@ -0,0 +1,121 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	neighborhood.hpp
+ * @brief 	Here, Functions defined in neighborhood.h are detailed.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef NEIGHBORHOOD_HPP
+#define NEIGHBORHOOD_HPP
+
+#include "neighborhood.h"
+
+#include "base_body.h"
+#include "kernel_cubic_B_spline_ck.h"
+#include "kernel_hyperbolic_ck.h"
+#include "kernel_laguerre_gauss_ck.h"
+#include "kernel_wendland_c2_ck.h"
+
+namespace SPH
+{
+//=================================================================================================//
+template <class KernelType>
+Kernel &NeighborBuilderKernel<KernelType>::checkKernel(Kernel *kernel)
+{
+    if (kernel->Name() != KernelType::OriginalKernelName())
+    {
+        std::cout << "\n Error: the kernel " << kernel->Name() << " does not match the neighbor builder kernel "
+                  << KernelType::OriginalKernelName() << "!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+    return *kernel;
+}
+//=================================================================================================//
+template <class KernelType>
+void NeighborBuilderKernel<KernelType>::createNeighbor(Neighborhood &neighborhood, const Real &distance,
+                                                       const Vecd &displacement, size_t index_j)
+{
+    neighborhood.j_.push_back(index_j);
+    neighborhood.W_ij_.push_back(kernel_.W(displacement));
+    neighborhood.dW_ij_.push_back(kernel_.dW(displacement));
+    neighborhood.r_ij_.push_back(distance);
+    neighborhood.e_ij_.push_back(kernel_.e(distance, displacement));
+    neighborhood.allocated_size_++;
+}
+//=================================================================================================//
+template <class KernelType>
+void NeighborBuilderKernel<KernelType>::initializeNeighbor(Neighborhood &neighborhood, const Real &distance,
+                                                           const Vecd &displacement, size_t index_j)
+{
+    size_t current_size = neighborhood.current_size_;
+    neighborhood.j_[current_size] = index_j;
+    neighborhood.W_ij_[current_size] = kernel_.W(displacement);
+    neighborhood.dW_ij_[current_size] = kernel_.dW(displacement);
+    neighborhood.r_ij_[current_size] = distance;
+    neighborhood.e_ij_[current_size] = kernel_.e(distance, displacement);
+}
+//=================================================================================================//
+template <class KernelType>
+NeighborBuilderInnerKernel<KernelType>::NeighborBuilderInnerKernel(SPHBody &body)
+    : NeighborBuilderKernel<KernelType>(body.getSPHAdaptation().getKernel()) {}
+//=================================================================================================//
+template <class KernelType>
+void NeighborBuilderInnerKernel<KernelType>::operator()(Neighborhood &neighborhood,
+                                                        const Vecd &pos_i, size_t index_i, const ListData &list_data_j)
+{
+    size_t index_j = list_data_j.first;
+    Vecd displacement = pos_i - list_data_j.second;
+    if (this->kernel_.checkIfWithinCutOffRadius(displacement) && index_i != index_j)
+    {
+        Real distance = displacement.norm();
+        neighborhood.current_size_ >= neighborhood.allocated_size_
+            ? this->createNeighbor(neighborhood, distance, displacement, index_j)
+            : this->initializeNeighbor(neighborhood, distance, displacement, index_j);
+        neighborhood.current_size_++;
+    }
+}
+//=================================================================================================//
+template <class KernelType>
+NeighborBuilderContactKernel<KernelType>::NeighborBuilderContactKernel(SPHBody &body, SPHBody &contact_body)
+    : NeighborBuilderKernel<KernelType>(NeighborBuilder::chooseKernel(body, contact_body)) {}
+//=================================================================================================//
+template <class KernelType>
+void NeighborBuilderContactKernel<KernelType>::operator()(Neighborhood &neighborhood,
+                                                          const Vecd &pos_i, size_t index_i, const ListData &list_data_j)
+{
+    size_t index_j = list_data_j.first;
+    Vecd displacement = pos_i - list_data_j.second;
+    if (this->kernel_.checkIfWithinCutOffRadius(displacement))
+    {
+        Real distance = displacement.norm();
+        neighborhood.current_size_ >= neighborhood.allocated_size_
+            ? this->createNeighbor(neighborhood, distance, displacement, index_j)
+            : this->initializeNeighbor(neighborhood, distance, displacement, index_j);
+        neighborhood.current_size_++;
+    }
+}
+//=================================================================================================//
+} // namespace SPH
+#endif // NEIGHBORHOOD_HPP
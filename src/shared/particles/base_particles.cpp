@@ -16,7 +16,8 @@ BaseParticles::BaseParticles(SPHBody &sph_body, BaseMaterial *base_material)
       sph_body_(sph_body), body_name_(sph_body.getName()),
       base_material_(*base_material),
       restart_xml_parser_("xml_restart", "particles"),
-      reload_xml_parser_("xml_particle_reload", "particles")
+      reload_xml_parser_("xml_particle_reload", "particles"),
+      is_reload_from_binary_(false)
 {
     sph_body.assignBaseParticles(this);
     sv_total_real_particles_ = registerSingularVariable<UnsignedInt>("TotalRealParticles");
@@ -70,6 +71,18 @@ void BaseParticles::initializeAllParticlesBoundsFromReloadXml()
     initializeAllParticlesBounds(reload_xml_parser_.Size(reload_xml_parser_.first_element_));
 }
 //=================================================================================================//
+void BaseParticles::initializeAllParticlesBoundsFromReloadBinary()
+{
+    BinaryColumnFile::Column *position = reload_binary_file_.findColumn("Position");
+    if (position == nullptr)
+    {
+        std::cout << "\n Error: the particle position is missing in the binary reload file!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+    initializeAllParticlesBounds(position->number_of_values_);
+}
+//=================================================================================================//
 void BaseParticles::increaseParticlesBounds(size_t extra_size)
 {
     particles_bound_ += extra_size;
@@ -142,6 +155,20 @@ void BaseParticles::readParticlesFromXmlForRestart(const std::string &filefullpa
     read_restart_variable_from_xml_(evolving_variables_, this, restart_xml_parser_);
 }
 //=================================================================================================//
+void BaseParticles::writeParticlesToBinaryForRestart(const std::string &filefullpath)
+{
+    BinaryColumnFile binary_file;
+    add_restart_variable_to_binary_(evolving_variables_, binary_file, TotalRealParticles());
+    binary_file.writeToFile(filefullpath);
+}
+//=================================================================================================//
+void BaseParticles::readParticlesFromBinaryForRestart(const std::string &filefullpath)
+{
+    BinaryColumnFile binary_file;
+    binary_file.loadFile(filefullpath);
+    read_restart_variable_from_binary_(evolving_variables_, this, binary_file);
+}
+//=================================================================================================//
 void BaseParticles::writeParticlesToXmlForReload(const std::string &filefullpath)
 {
     resizeXmlDocForParticles(reload_xml_parser_);
@@ -154,4 +181,18 @@ void BaseParticles::readReloadXmlFile(const std::string &filefullpath)
     reload_xml_parser_.loadXmlFile(filefullpath);
 }
 //=================================================================================================//
+void BaseParticles::writeParticlesToBinaryForReload(const std::string &filefullpath, const std::string &key)
+{
+    BinaryColumnFile binary_file;
+    binary_file.addColumn("Key", key.data(), key.size());
+    add_restart_variable_to_binary_(evolving_variables_, binary_file, TotalRealParticles());
+    binary_file.writeToFile(filefullpath);
+}
+//=================================================================================================//
+void BaseParticles::readReloadBinaryFile(const std::string &filefullpath)
+{
+    reload_binary_file_.loadFile(filefullpath);
+    is_reload_from_binary_ = true;
+}
+//=================================================================================================//
 } // namespace SPH
@@ -34,6 +34,7 @@
 #define BASE_PARTICLES_H
 
 #include "base_data_package.h"
+#include "binary_column_file.h"
 #include "sphinxsys_containers.h"
 #include "sphinxsys_variable.h"
 #include "sphinxsys_variable_array.h"
@@ -115,6 +116,7 @@ class BaseParticles
     UnsignedInt ParticlesBound() { return particles_bound_; };
     void initializeAllParticlesBounds(size_t total_real_particles);
     void initializeAllParticlesBoundsFromReloadXml();
+    void initializeAllParticlesBoundsFromReloadBinary();
     void increaseParticlesBounds(size_t extra_size);
     void copyFromAnotherParticle(size_t index, size_t another_index);
     size_t allocateGhostParticles(size_t ghost_size);
@@ -167,6 +169,9 @@ class BaseParticles
     DiscreteVariable<DataType> *registerStateVariableOnlyFrom(const std::string &name, const StdLargeVec<DataType> &geometric_data);
     template <typename DataType>
     DiscreteVariable<DataType> *registerStateVariableOnlyFromReload(const std::string &name);
+    /** read from the binary reload file if loaded, otherwise from the xml one */
+    template <typename DataType>
+    void readReloadData(const std::string &name, DataType *data_field);
     template <typename DataType>
     StdVec<DiscreteVariable<DataType> *> registerStateVariables(const StdVec<std::string> &names, const std::string &suffix);
     template <typename DataType>
@@ -215,8 +220,14 @@ class BaseParticles
     void resizeXmlDocForParticles(XmlParser &xml_parser);
     void writeParticlesToXmlForRestart(const std::string &filefullpath);
     void readParticlesFromXmlForRestart(const std::string &filefullpath);
+    /** Raw column data of the evolving variables, read back through memory mapping. */
+    void writeParticlesToBinaryForRestart(const std::string &filefullpath);
+    void readParticlesFromBinaryForRestart(const std::string &filefullpath);
     void writeParticlesToXmlForReload(const std::string &filefullpath);
     void readReloadXmlFile(const std::string &filefullpath);
+    /** The key identifying the reload data is saved as a column of characters. */
+    void writeParticlesToBinaryForReload(const std::string &filefullpath, const std::string &key);
+    void readReloadBinaryFile(const std::string &filefullpath);
     //----------------------------------------------------------------------
     // Function related to geometric variables and their relations
     //----------------------------------------------------------------------
@@ -239,6 +250,8 @@ class BaseParticles
     BaseMaterial &base_material_;
     XmlParser restart_xml_parser_;
     XmlParser reload_xml_parser_;
+    BinaryColumnFile reload_binary_file_;
+    bool is_reload_from_binary_;
     ParticleData all_state_data_; /**< all discrete variable data except those on particle IDs  */
     ParticleVariables all_discrete_variables_;
     SingularVariables all_singular_variables_;
@@ -267,9 +280,25 @@ class BaseParticles
         void operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables, BaseParticles *base_particles, XmlParser &xml_parser);
     };
 
+    struct AddAParticleVariableToBinary
+    {
+        template <typename DataType>
+        void operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables,
+                        BinaryColumnFile &binary_file, size_t total_real_particles);
+    };
+
+    struct ReadAParticleVariableFromBinary
+    {
+        template <typename DataType>
+        void operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables,
+                        BaseParticles *base_particles, BinaryColumnFile &binary_file);
+    };
+
     OperationOnDataAssemble<ParticleData, CopyParticleState> copy_particle_state_;
     OperationOnDataAssemble<ParticleVariables, WriteAParticleVariableToXml> write_restart_variable_to_xml_, write_reload_variable_to_xml_;
     OperationOnDataAssemble<ParticleVariables, ReadAParticleVariableFromXml> read_restart_variable_from_xml_;
+    OperationOnDataAssemble<ParticleVariables, AddAParticleVariableToBinary> add_restart_variable_to_binary_;
+    OperationOnDataAssemble<ParticleVariables, ReadAParticleVariableFromBinary> read_restart_variable_from_binary_;
 };
 } // namespace SPH
 #endif // BASE_PARTICLES_H
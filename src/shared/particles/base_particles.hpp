@@ -3,6 +3,8 @@
 
 #include "base_particles.h"
 
+#include <cstring>
+
 namespace SPH
 {
 //=================================================================================================//
@@ -176,14 +178,7 @@ template <typename DataType>
 DataType *BaseParticles::registerStateVariableFromReload(const std::string &name)
 {
     DataType *data_field = registerStateVariable<DataType>(name);
-
-    size_t index = 0;
-    for (auto child = reload_xml_parser_.first_element_->FirstChildElement(); child; child = child->NextSiblingElement())
-    {
-        reload_xml_parser_.queryAttributeValue(child, name, data_field[index]);
-        index++;
-    }
-
+    readReloadData(name, data_field);
     return data_field;
 }
 //=================================================================================================//
@@ -222,7 +217,20 @@ template <typename DataType>
 DiscreteVariable<DataType> *BaseParticles::registerStateVariableOnlyFromReload(const std::string &name)
 {
     DiscreteVariable<DataType> *new_variable = registerStateVariableOnly<DataType>(name);
-    DataType *data_field = new_variable->Data();
+    readReloadData(name, new_variable->Data());
+    return new_variable;
+}
+//=================================================================================================//
+template <typename DataType>
+void BaseParticles::readReloadData(const std::string &name, DataType *data_field)
+{
+    if (is_reload_from_binary_)
+    {
+        size_t total_real_particles = TotalRealParticles();
+        const DataType *reload_data = reload_binary_file_.getColumnData<DataType>(name, total_real_particles);
+        std::memcpy(static_cast<void *>(data_field), reload_data, total_real_particles * sizeof(DataType));
+        return;
+    }
 
     size_t index = 0;
     for (auto child = reload_xml_parser_.first_element_->FirstChildElement(); child; child = child->NextSiblingElement())
@@ -230,8 +238,6 @@ DiscreteVariable<DataType> *BaseParticles::registerStateVariableOnlyFromReload(c
         reload_xml_parser_.queryAttributeValue(child, name, data_field[index]);
         index++;
     }
-
-    return new_variable;
 }
 //=================================================================================================//
 template <typename DataType>
@@ -447,5 +453,41 @@ operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables,
     }
 }
 //=================================================================================================//
+template <typename DataType>
+void BaseParticles::AddAParticleVariableToBinary::
+operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables,
+           BinaryColumnFile &binary_file, size_t total_real_particles)
+{
+    for (size_t i = 0; i != variables.size(); ++i)
+    {
+        binary_file.addColumn(variables[i]->Name(), variables[i]->Data(), total_real_particles);
+    }
+}
+//=================================================================================================//
+template <typename DataType>
+void BaseParticles::ReadAParticleVariableFromBinary::
+operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables,
+           BaseParticles *base_particles, BinaryColumnFile &binary_file)
+{
+    for (size_t i = 0; i != variables.size(); ++i)
+    {
+        BinaryColumnFile::Column *column = binary_file.findColumn(variables[i]->Name());
+        if (column == nullptr ||
+            column->type_index_ != uint64_t(DataTypeIndex<DataType>::value) ||
+            column->type_size_ != sizeof(DataType) ||
+            column->number_of_values_ > variables[i]->getDataSize())
+        {
+            std::cout << "\n Error: the variable " << variables[i]->Name()
+                      << " is missing or not matching in the binary restart file!" << std::endl;
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            exit(1);
+        }
+        DataType *data_field = variables[i]->Data() != nullptr
+                                   ? variables[i]->Data()
+                                   : base_particles->initializeVariable<DataType>(variables[i]);
+        std::memcpy(static_cast<void *>(data_field), column->data_, column->number_of_values_ * sizeof(DataType));
+    }
+}
+//=================================================================================================//
 } // namespace SPH
 #endif // BASE_PARTICLES_HPP
@@ -19,9 +19,9 @@ void ParticleReserve::checkParticlesReserved()
     };
 }
 //=================================================================================================//
-void ParticleBuffer<Base>::checkEnoughBuffer(BaseParticles &base_particles)
+void ParticleBuffer<Base>::checkEnoughBuffer(BaseParticles &base_particles, size_t number_of_new_real_particles)
 {
-    if (base_particles.TotalRealParticles() >= base_particles.ParticlesBound())
+    if (base_particles.TotalRealParticles() + number_of_new_real_particles > base_particles.ParticlesBound())
     {
         std::cout << "\n ERROR: Not enough buffer particles have been reserved!" << std::endl;
         std::cout << "\n You may need to increase the particle reserve." << std::endl;
@@ -68,7 +68,8 @@ class ParticleBuffer<Base> : public ParticleReserve
   public:
     ParticleBuffer() : ParticleReserve(){};
     virtual ~ParticleBuffer(){};
-    void checkEnoughBuffer(BaseParticles &base_particles);
+    /** check whether the buffer particles are enough for realizing a given number of them */
+    void checkEnoughBuffer(BaseParticles &base_particles, size_t number_of_new_real_particles = 1);
     void allocateBufferParticles(BaseParticles &base_particles, size_t buffer_size);
 };
 
@@ -12,7 +12,10 @@ Relation<Inner<>>::Relation(RealBody &real_body)
     : Relation<Base>(real_body), real_body_(&real_body),
       cell_linked_list_(DynamicCast<CellLinkedList>(this, real_body.getCellLinkedList())),
       dv_neighbor_index_(addRelationVariable<UnsignedInt>("NeighborIndex", offset_list_size_)),
-      dv_particle_offset_(addRelationVariable<UnsignedInt>("ParticleOffset", offset_list_size_)) {}
+      dv_particle_offset_(addRelationVariable<UnsignedInt>("ParticleOffset", offset_list_size_)),
+      dv_half_neighbor_index_(nullptr), dv_half_particle_offset_(nullptr),
+      dv_reverse_neighbor_index_(nullptr), dv_reverse_pair_index_(nullptr),
+      dv_reverse_pair_offset_(nullptr) {}
 //=================================================================================================//
 void Relation<Inner<>>::registerComputingKernel(execution::Implementation<Base> *implementation)
 {
@@ -27,4 +30,17 @@ void Relation<Inner<>>::resetComputingKernelUpdated()
     }
 }
 //=================================================================================================//
+void Relation<Inner<>>::requireHalfNeighborList()
+{
+    if (!isHalfNeighborListRequired())
+    {
+        // the lists are also used as temporary storage of the pair counts before the scans
+        dv_half_neighbor_index_ = addRelationVariable<UnsignedInt>("HalfNeighborIndex", offset_list_size_);
+        dv_half_particle_offset_ = addRelationVariable<UnsignedInt>("HalfParticleOffset", offset_list_size_);
+        dv_reverse_neighbor_index_ = addRelationVariable<UnsignedInt>("ReverseNeighborIndex", offset_list_size_);
+        dv_reverse_pair_index_ = addRelationVariable<UnsignedInt>("ReversePairIndex", offset_list_size_);
+        dv_reverse_pair_offset_ = addRelationVariable<UnsignedInt>("ReversePairOffset", offset_list_size_);
+    }
+}
+//=================================================================================================//
 } // namespace SPH
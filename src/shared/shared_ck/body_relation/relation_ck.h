@@ -70,6 +70,22 @@ class Relation<Inner<>> : public Relation<Base>
     DiscreteVariable<UnsignedInt> *getParticleOffset() { return dv_particle_offset_; };
     void registerComputingKernel(execution::Implementation<Base> *implementation);
     void resetComputingKernelUpdated();
+    /** The half neighbor list, i.e. only the neighbors j > i of particle i, and the reverse pairs,
+     *  i.e. the pairs in which a particle is the neighbor, are built together with the neighbor list
+     *  only if they are required by a symmetric interaction. */
+    void requireHalfNeighborList();
+    bool isHalfNeighborListRequired() { return dv_half_neighbor_index_ != nullptr; };
+    DiscreteVariable<UnsignedInt> *getHalfNeighborIndex() { return dv_half_neighbor_index_; };
+    DiscreteVariable<UnsignedInt> *getHalfParticleOffset() { return dv_half_particle_offset_; };
+    DiscreteVariable<UnsignedInt> *getReverseNeighborIndex() { return dv_reverse_neighbor_index_; };
+    DiscreteVariable<UnsignedInt> *getReversePairIndex() { return dv_reverse_pair_index_; };
+    DiscreteVariable<UnsignedInt> *getReversePairOffset() { return dv_reverse_pair_offset_; };
+    /** Variable with a value for each pair in the half neighbor list. */
+    template <class DataType>
+    DiscreteVariable<DataType> *addPairVariable(const std::string &name);
+    /** Reallocate the pair lists and the pair variables, their data are not kept. */
+    template <class ExecutionPolicy>
+    void reallocateHalfNeighborList(const ExecutionPolicy &ex_policy, UnsignedInt pair_list_size);
 
   protected:
     RealBody *real_body_;
@@ -77,6 +93,27 @@ class Relation<Inner<>> : public Relation<Base>
     DiscreteVariable<UnsignedInt> *dv_neighbor_index_;
     DiscreteVariable<UnsignedInt> *dv_particle_offset_;
     StdVec<execution::Implementation<Base> *> all_inner_computing_kernels_;
+    DiscreteVariable<UnsignedInt> *dv_half_neighbor_index_;
+    DiscreteVariable<UnsignedInt> *dv_half_particle_offset_;
+    DiscreteVariable<UnsignedInt> *dv_reverse_neighbor_index_;
+    DiscreteVariable<UnsignedInt> *dv_reverse_pair_index_;
+    DiscreteVariable<UnsignedInt> *dv_reverse_pair_offset_;
+    DataContainerAddressAssemble<DiscreteVariable> pair_variables_;
+
+    struct ReallocatePairVariables
+    {
+        template <typename DataType, class ExecutionPolicy>
+        void operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables,
+                        const ExecutionPolicy &ex_policy, UnsignedInt pair_list_size)
+        {
+            for (size_t k = 0; k != variables.size(); ++k)
+            {
+                variables[k]->reallocateData(ex_policy, pair_list_size);
+            }
+        };
+    };
+    OperationOnDataAssemble<DataContainerAddressAssemble<DiscreteVariable>, ReallocatePairVariables>
+        reallocate_pair_variables_;
 };
 
 template <class SourceIdentifier, class TargetIdentifier>
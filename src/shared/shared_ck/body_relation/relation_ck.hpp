@@ -13,6 +13,29 @@ DiscreteVariable<DataType> *Relation<Base>::
     return relation_variable_ptrs_.createPtr<DiscreteVariable<DataType>>(name, data_size);
 }
 //=================================================================================================//
+template <class DataType>
+DiscreteVariable<DataType> *Relation<Inner<>>::addPairVariable(const std::string &name)
+{
+    requireHalfNeighborList();
+    DiscreteVariable<DataType> *variable = findVariableByName<DataType>(pair_variables_, name);
+    if (variable == nullptr)
+    {
+        variable = addRelationVariable<DataType>(name, dv_half_neighbor_index_->getDataSize());
+        constexpr int type_index = DataTypeIndex<DataType>::value;
+        std::get<type_index>(pair_variables_).push_back(variable);
+    }
+    return variable;
+}
+//=================================================================================================//
+template <class ExecutionPolicy>
+void Relation<Inner<>>::reallocateHalfNeighborList(const ExecutionPolicy &ex_policy, UnsignedInt pair_list_size)
+{
+    dv_half_neighbor_index_->reallocateData(ex_policy, pair_list_size);
+    dv_reverse_neighbor_index_->reallocateData(ex_policy, pair_list_size);
+    dv_reverse_pair_index_->reallocateData(ex_policy, pair_list_size);
+    reallocate_pair_variables_(pair_variables_, ex_policy, pair_list_size);
+}
+//=================================================================================================//
 template <class DynamicsIdentifier, class TargetIdentifier>
 Relation<Contact<DynamicsIdentifier, TargetIdentifier>>::
     Relation(DynamicsIdentifier &source_identifier, StdVec<TargetIdentifier *> contact_identifiers)
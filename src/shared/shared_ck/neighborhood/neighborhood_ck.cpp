@@ -3,8 +3,8 @@
 namespace SPH
 {
 //=================================================================================================//
-Neighbor<>::NeighborCriterion::NeighborCriterion(Neighbor<> &neighbor)
+Neighbor<>::NeighborCriterion::NeighborCriterion(Neighbor<> &neighbor, Real skin)
     : source_pos_(neighbor.source_pos_), target_pos_(neighbor.target_pos_),
-      cut_radius_square_(neighbor.getKernel().CutOffRadiusSqr()) {}
+      cut_radius_square_(pow(neighbor.getKernel().CutOffRadius() + skin, 2)) {}
 //=================================================================================================//
 } // namespace SPH
@@ -43,6 +43,10 @@ template <>
 class Neighbor<>
 {
   public:
+    using KernelType = KernelWendlandC2CK;
+    /** number of neighbors evaluated together, given by the kernel in use */
+    static constexpr UnsignedInt BatchSize = KernelType::BatchSize;
+
     template <class ExecutionPolicy>
     Neighbor(const ExecutionPolicy &ex_policy, SPHAdaptation *sph_adaptation, DiscreteVariable<Vecd> *dv_pos);
 
@@ -50,7 +54,7 @@ class Neighbor<>
     Neighbor(const ExecutionPolicy &ex_policy, SPHAdaptation *sph_adaptation, SPHAdaptation *contact_adaptation,
              DiscreteVariable<Vecd> *dv_pos, DiscreteVariable<Vecd> *dv_target_pos);
 
-    KernelWendlandC2CK &getKernel() { return kernel_; }
+    KernelType &getKernel() { return kernel_; }
 
     inline Vecd vec_r_ij(size_t i, size_t j) const { return source_pos_[i] - target_pos_[j]; };
     inline Real W_ij(size_t i, size_t j) const { return kernel_.W(vec_r_ij(i, j)); }
@@ -62,11 +66,66 @@ class Neighbor<>
         return displacement / (displacement.norm() + TinyReal);
     }
 
+    /**
+     * Apply function(j, dW_ij, e_ij) to the neighbors listed in [first, last).
+     * With SPHINXSYS_USE_SIMD, the displacements are gathered for a batch of neighbors
+     * and the kernel gradients and the unit vectors are evaluated with vectorized loops.
+     */
+    template <class NeighborFunction>
+    inline void forEachNeighbor(size_t i, const UnsignedInt *neighbor_index,
+                                UnsignedInt first, UnsignedInt last, const NeighborFunction &function) const
+    {
+#if SPHINXSYS_USE_SIMD
+        forEachNeighborInBatches(i, neighbor_index, first, last, function);
+#else
+        forEachNeighborOneByOne(i, neighbor_index, first, last, function);
+#endif
+    };
+
+    template <class NeighborFunction>
+    inline void forEachNeighborInBatches(size_t i, const UnsignedInt *neighbor_index,
+                                         UnsignedInt first, UnsignedInt last, const NeighborFunction &function) const
+    {
+        Real displacement[Dimensions][BatchSize];
+        Real dW_batch[BatchSize];
+        Real e_batch[Dimensions][BatchSize];
+        for (UnsignedInt n = first; n < last; n += BatchSize)
+        {
+            UnsignedInt count = SMIN(BatchSize, last - n);
+            for (UnsignedInt k = 0; k != BatchSize; ++k)
+            {
+                // padding entries have zero displacement and are not used
+                Vecd r_ij = k < count ? vec_r_ij(i, neighbor_index[n + k]) : Vecd::Zero();
+                for (int d = 0; d != Dimensions; ++d)
+                    displacement[d][k] = r_ij[d];
+            }
+            kernel_.dW_e(displacement, dW_batch, e_batch);
+            for (UnsignedInt k = 0; k != count; ++k)
+            {
+                Vecd e_ij;
+                for (int d = 0; d != Dimensions; ++d)
+                    e_ij[d] = e_batch[d][k];
+                function(neighbor_index[n + k], dW_batch[k], e_ij);
+            }
+        }
+    };
+
+    template <class NeighborFunction>
+    inline void forEachNeighborOneByOne(size_t i, const UnsignedInt *neighbor_index,
+                                        UnsignedInt first, UnsignedInt last, const NeighborFunction &function) const
+    {
+        for (UnsignedInt n = first; n != last; ++n)
+        {
+            UnsignedInt j = neighbor_index[n];
+            function(j, dW_ij(i, j), e_ij(i, j));
+        }
+    };
+
     class NeighborCriterion
     {
       public:
-        NeighborCriterion(Neighbor<> &neighbor);
-        bool operator()(UnsignedInt target_index, UnsignedInt source_index)
+        NeighborCriterion(Neighbor<> &neighbor, Real skin = 0.0);
+        bool operator()(UnsignedInt target_index, UnsignedInt source_index) const
         {
             return (source_pos_[source_index] - target_pos_[target_index]).squaredNorm() < cut_radius_square_;
         };
@@ -78,7 +137,7 @@ class Neighbor<>
     };
 
   protected:
-    KernelWendlandC2CK kernel_;
+    KernelType kernel_;
     Vecd *source_pos_;
     Vecd *target_pos_;
 };
@@ -97,5 +156,38 @@ class NeighborList
     inline UnsignedInt FirstNeighbor(UnsignedInt i) { return particle_offset_[i]; };
     inline UnsignedInt LastNeighbor(UnsignedInt i) { return particle_offset_[i + 1]; };
 };
+
+/**
+ * @class HalfNeighborList
+ * @brief The list with each pair saved once, i.e. with the neighbors j > i of particle i.
+ * @details The pair index n is the location of the pair in the list.
+ * The reverse pairs of particle j are those in which j is the neighbor,
+ * given by the particle i having the pair and the pair index.
+ * A symmetric interaction computes the pair values for the half neighbor list first
+ * and then collects those of the half neighbor list and the reverse pairs for each particle,
+ * so that each pair is evaluated once and no two threads write the same data.
+ */
+class HalfNeighborList
+{
+  public:
+    template <class ExecutionPolicy>
+    HalfNeighborList(const ExecutionPolicy &ex_policy,
+                     DiscreteVariable<UnsignedInt> *dv_half_neighbor_index,
+                     DiscreteVariable<UnsignedInt> *dv_half_particle_offset,
+                     DiscreteVariable<UnsignedInt> *dv_reverse_neighbor_index,
+                     DiscreteVariable<UnsignedInt> *dv_reverse_pair_index,
+                     DiscreteVariable<UnsignedInt> *dv_reverse_pair_offset);
+
+  protected:
+    UnsignedInt *half_neighbor_index_;
+    UnsignedInt *half_particle_offset_;
+    UnsignedInt *reverse_neighbor_index_;
+    UnsignedInt *reverse_pair_index_;
+    UnsignedInt *reverse_pair_offset_;
+    inline UnsignedInt FirstHalfNeighbor(UnsignedInt i) { return half_particle_offset_[i]; };
+    inline UnsignedInt LastHalfNeighbor(UnsignedInt i) { return half_particle_offset_[i + 1]; };
+    inline UnsignedInt FirstReversePair(UnsignedInt j) { return reverse_pair_offset_[j]; };
+    inline UnsignedInt LastReversePair(UnsignedInt j) { return reverse_pair_offset_[j + 1]; };
+};
 } // namespace SPH
 #endif // NEIGHBORHOOD_CK_H
\ No newline at end of file
@@ -21,7 +21,7 @@ Neighbor<>::Neighbor(const ExecutionPolicy &ex_policy,
       source_pos_(dv_pos->DelegatedData(ex_policy)),
       target_pos_(dv_contact_pos->DelegatedData(ex_policy))
 {
-    KernelWendlandC2CK contact_kernel(*contact_adaptation->getKernel());
+    KernelType contact_kernel(*contact_adaptation->getKernel());
     if (kernel_.CutOffRadius() < contact_kernel.CutOffRadius())
     {
         kernel_ = contact_kernel;
@@ -35,5 +35,18 @@ NeighborList::NeighborList(const ExecutionPolicy &ex_policy,
     : neighbor_index_(dv_neighbor_index->DelegatedData(ex_policy)),
       particle_offset_(dv_particle_offset->DelegatedData(ex_policy)) {}
 //=================================================================================================//
+template <class ExecutionPolicy>
+HalfNeighborList::HalfNeighborList(const ExecutionPolicy &ex_policy,
+                                   DiscreteVariable<UnsignedInt> *dv_half_neighbor_index,
+                                   DiscreteVariable<UnsignedInt> *dv_half_particle_offset,
+                                   DiscreteVariable<UnsignedInt> *dv_reverse_neighbor_index,
+                                   DiscreteVariable<UnsignedInt> *dv_reverse_pair_index,
+                                   DiscreteVariable<UnsignedInt> *dv_reverse_pair_offset)
+    : half_neighbor_index_(dv_half_neighbor_index->DelegatedData(ex_policy)),
+      half_particle_offset_(dv_half_particle_offset->DelegatedData(ex_policy)),
+      reverse_neighbor_index_(dv_reverse_neighbor_index->DelegatedData(ex_policy)),
+      reverse_pair_index_(dv_reverse_pair_index->DelegatedData(ex_policy)),
+      reverse_pair_offset_(dv_reverse_pair_offset->DelegatedData(ex_policy)) {}
+//=================================================================================================//
 } // namespace SPH
 #endif // NEIGHBORHOOD_CK_HPP
@@ -3,12 +3,6 @@
 namespace SPH
 {
 //=================================================================================================//
-UpdateSortableVariables::UpdateSortableVariables(BaseParticles *particles)
-    : initialize_temp_variables_()
-{
-    initialize_temp_variables_(temp_variables_, particles->ParticlesBound());
-}
-//=================================================================================================//
 QuickSort::SwapParticleIndex::SwapParticleIndex(UnsignedInt *sequence, UnsignedInt *index_permutation)
     : sequence_(sequence), index_permutation_(index_permutation) {}
 //=================================================================================================//
@@ -36,28 +36,6 @@
  */
 namespace SPH
 {
-class UpdateSortableVariables
-{
-    typedef DataAssemble<UniquePtr, DiscreteVariable> TemporaryVariables;
-
-    struct InitializeTemporaryVariables
-    {
-        template <typename DataType>
-        void operator()(UniquePtr<DiscreteVariable<DataType>> &variable_ptr, UnsignedInt data_size);
-    };
-
-    TemporaryVariables temp_variables_;
-    OperationOnDataAssemble<TemporaryVariables, InitializeTemporaryVariables> initialize_temp_variables_;
-
-  public:
-    UpdateSortableVariables(BaseParticles *particles);
-
-    template <class ExecutionPolicy, typename DataType>
-    void operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables,
-                    ExecutionPolicy &ex_policy, UnsignedInt total_real_particles,
-                    DiscreteVariable<UnsignedInt> *dv_index_permutation);
-};
-
 class QuickSort
 {
     class SwapParticleIndex
@@ -92,7 +70,11 @@ class QuickSort
         quick_sort_particle_body_;
 };
 
-template <class ExecutionPolicy, class SortMethodType>
+/**
+ * @class ParticleSortCK
+ * @brief Sort particles along a space-filling curve, MortonOrder (default) or HilbertOrder.
+ */
+template <class ExecutionPolicy, class SortMethodType, class SequenceOrder = MortonOrder>
 class ParticleSortCK : public LocalDynamics, public BaseDynamics<void>
 {
   public:
@@ -103,7 +85,7 @@ class ParticleSortCK : public LocalDynamics, public BaseDynamics<void>
     {
       public:
         ComputingKernel(const ExecutionPolicy &ex_policy,
-                        ParticleSortCK<ExecutionPolicy, SortMethodType> &encloser);
+                        ParticleSortCK<ExecutionPolicy, SortMethodType, SequenceOrder> &encloser);
         void prepareSequence(UnsignedInt index_i);
         void updateSortedID(UnsignedInt index_i);
 
@@ -131,7 +113,7 @@ class ParticleSortCK : public LocalDynamics, public BaseDynamics<void>
     };
 
     virtual void exec(Real dt = 0.0) override;
-    typedef ParticleSortCK<ExecutionPolicy, SortMethodType> LocalDynamicsType;
+    typedef ParticleSortCK<ExecutionPolicy, SortMethodType, SequenceOrder> LocalDynamicsType;
 
   protected:
     ExecutionPolicy ex_policy_;
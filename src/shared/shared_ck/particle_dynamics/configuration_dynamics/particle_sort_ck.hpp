@@ -2,40 +2,11 @@
 #define PARTICLE_SORT_HPP
 
 #include "particle_sort_ck.h"
+#include "particle_sorting.hpp"
 
 namespace SPH
 {
 //=================================================================================================//
-template <typename DataType>
-void UpdateSortableVariables::InitializeTemporaryVariables::operator()(
-    UniquePtr<DiscreteVariable<DataType>> &variable_ptr, UnsignedInt data_size)
-{
-    variable_ptr = makeUnique<DiscreteVariable<DataType>>("Temporary", data_size);
-}
-//=================================================================================================//
-template <class ExecutionPolicy, typename DataType>
-void UpdateSortableVariables::operator()(
-    DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables,
-    ExecutionPolicy &ex_policy, UnsignedInt total_real_particles,
-    DiscreteVariable<UnsignedInt> *dv_index_permutation)
-{
-    constexpr int type_index = DataTypeIndex<DataType>::value;
-    DataType *temp_data_field = std::get<type_index>(temp_variables_)->DelegatedData(ex_policy);
-
-    UnsignedInt *index_permutation = dv_index_permutation->DelegatedData(ex_policy);
-
-    for (size_t k = 0; k != variables.size(); ++k)
-    {
-        DataType *sorted_data_field = variables[k]->DelegatedData(ex_policy);
-        particle_for(ex_policy, IndexRange(0, total_real_particles),
-                     [=](size_t i)
-                     { temp_data_field[i] = sorted_data_field[i]; });
-        particle_for(ex_policy, IndexRange(0, total_real_particles),
-                     [=](size_t i)
-                     { sorted_data_field[i] = temp_data_field[index_permutation[i]]; });
-    }
-}
-//=================================================================================================//
 template <class ExecutionPolicy>
 QuickSort::QuickSort(const ExecutionPolicy &ex_policy,
                      DiscreteVariable<UnsignedInt> *dv_sequence,
@@ -46,8 +17,8 @@ QuickSort::QuickSort(const ExecutionPolicy &ex_policy,
       quick_sort_particle_range_(sequence_, 0, compare_, swap_particle_index_),
       quick_sort_particle_body_() {}
 //=================================================================================================//
-template <class ExecutionPolicy, class SortMethodType>
-ParticleSortCK<ExecutionPolicy, SortMethodType>::ParticleSortCK(RealBody &real_body)
+template <class ExecutionPolicy, class SortMethodType, class SequenceOrder>
+ParticleSortCK<ExecutionPolicy, SortMethodType, SequenceOrder>::ParticleSortCK(RealBody &real_body)
     : LocalDynamics(real_body), BaseDynamics<void>(),
       ex_policy_(ExecutionPolicy{}),
       cell_linked_list_(DynamicCast<CellLinkedList>(this, real_body.getCellLinkedList())),
@@ -85,35 +56,36 @@ ParticleSortCK<ExecutionPolicy, SortMethodType>::ParticleSortCK(RealBody &real_b
     }
 }
 //=================================================================================================//
-template <class ExecutionPolicy, class SortMethodType>
-ParticleSortCK<ExecutionPolicy, SortMethodType>::ComputingKernel::
+template <class ExecutionPolicy, class SortMethodType, class SequenceOrder>
+ParticleSortCK<ExecutionPolicy, SortMethodType, SequenceOrder>::ComputingKernel::
     ComputingKernel(const ExecutionPolicy &ex_policy,
-                    ParticleSortCK<ExecutionPolicy, SortMethodType> &encloser)
+                    ParticleSortCK<ExecutionPolicy, SortMethodType, SequenceOrder> &encloser)
     : mesh_(encloser.mesh_), pos_(encloser.dv_pos_->DelegatedData(ex_policy)),
       sequence_(encloser.dv_sequence_->DelegatedData(ex_policy)),
       index_permutation_(encloser.dv_index_permutation_->DelegatedData(ex_policy)),
       original_id_(encloser.dv_original_id_->DelegatedData(ex_policy)),
       sorted_id_(encloser.dv_sorted_id_->DelegatedData(ex_policy)) {}
 //=================================================================================================//
-template <class ExecutionPolicy, class SortMethodType>
-void ParticleSortCK<ExecutionPolicy, SortMethodType>::ComputingKernel::
+template <class ExecutionPolicy, class SortMethodType, class SequenceOrder>
+void ParticleSortCK<ExecutionPolicy, SortMethodType, SequenceOrder>::ComputingKernel::
     prepareSequence(UnsignedInt index_i)
 {
-    sequence_[index_i] = mesh_.transferMeshIndexToMortonOrder(mesh_.CellIndexFromPosition(pos_[index_i]));
+    sequence_[index_i] = mesh_.transferMeshIndexToSequence(SequenceOrder{}, mesh_.CellIndexFromPosition(pos_[index_i]));
     index_permutation_[index_i] = index_i;
 }
 //=================================================================================================//
-template <class ExecutionPolicy, class SortMethodType>
-void ParticleSortCK<ExecutionPolicy, SortMethodType>::ComputingKernel::
+template <class ExecutionPolicy, class SortMethodType, class SequenceOrder>
+void ParticleSortCK<ExecutionPolicy, SortMethodType, SequenceOrder>::ComputingKernel::
     updateSortedID(UnsignedInt index_i)
 {
     sorted_id_[original_id_[index_i]] = index_i;
 }
 //=================================================================================================//
-template <class ExecutionPolicy, class SortMethodType>
-void ParticleSortCK<ExecutionPolicy, SortMethodType>::exec(Real dt)
+template <class ExecutionPolicy, class SortMethodType, class SequenceOrder>
+void ParticleSortCK<ExecutionPolicy, SortMethodType, SequenceOrder>::exec(Real dt)
 {
     UnsignedInt total_real_particles = particles_->TotalRealParticles();
+    ProfilingScope profiling_scope(ExecutionPolicy{}, this->profilingRecord(this->getSPHBody()), total_real_particles);
     ComputingKernel *computing_kernel = kernel_implementation_.getComputingKernel();
 
     particle_for(ex_policy_, IndexRange(0, total_real_particles),
@@ -139,17 +111,17 @@ void ParticleSortCK<ExecutionPolicy, SortMethodType>::exec(Real dt)
     }
 }
 //=================================================================================================//
-template <class ExecutionPolicy, class SortMethodType>
+template <class ExecutionPolicy, class SortMethodType, class SequenceOrder>
 template <class EncloserType>
-ParticleSortCK<ExecutionPolicy, SortMethodType>::UpdateBodyPartByParticle::
+ParticleSortCK<ExecutionPolicy, SortMethodType, SequenceOrder>::UpdateBodyPartByParticle::
     UpdateBodyPartByParticle(const ExecutionPolicy &ex_policy,
                              EncloserType &encloser, UnsignedInt body_part_i)
     : index_list_(encloser.dv_index_lists_[body_part_i]->DelegatedData(ex_policy)),
       original_id_list_(encloser.dv_original_id_lists_[body_part_i]->DelegatedData(ex_policy)),
       sorted_id_(encloser.dv_sorted_id_->DelegatedData(ex_policy)) {}
 //=================================================================================================//
-template <class ExecutionPolicy, class SortMethodType>
-void ParticleSortCK<ExecutionPolicy, SortMethodType>::UpdateBodyPartByParticle::
+template <class ExecutionPolicy, class SortMethodType, class SequenceOrder>
+void ParticleSortCK<ExecutionPolicy, SortMethodType, SequenceOrder>::UpdateBodyPartByParticle::
     update(UnsignedInt index_i)
 {
     index_list_[index_i] = sorted_id_[original_id_list_[index_i]];
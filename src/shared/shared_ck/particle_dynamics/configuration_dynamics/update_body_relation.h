@@ -38,6 +38,101 @@
 
 namespace SPH
 {
+/**
+ * @class NeighborSkin
+ * @brief Bookkeeping for neighbor lists built with a skin (Verlet list).
+ * @details The lists are built with cut radius plus skin and are valid as long as
+ * no pair has approached by more than the skin since the last build.
+ * The largest particle displacement since the last build is obtained by a reduction.
+ * Particle sorting, injection or deletion changes the original ids at given indexes,
+ * which is detected in the same reduction and enforces a rebuild.
+ * Between builds, the pairs within the cut radius are filtered from the list built with skin,
+ * so that the kernel functions are never evaluated beyond the cut radius.
+ */
+template <class ExecutionPolicy>
+class NeighborSkin
+{
+    UniquePtrsKeeper<Entity> skin_variable_ptrs_;
+
+  public:
+    explicit NeighborSkin(SPHBody &sph_body);
+    void setSkin(Real skin);
+    Real Skin() { return skin_; };
+    bool isActive() { return skin_ > 0.0; };
+    /** The largest displacement since last build, or MaxReal if the particles have been rearranged. */
+    Real MaxDisplacement();
+    void recordBuild();
+    size_t NumberOfBuilds() { return number_of_builds_; };
+
+  protected:
+    SPHBody &sph_body_;
+    BaseParticles &particles_;
+    Real skin_;
+    bool is_built_;
+    size_t number_of_builds_;
+    UnsignedInt total_real_particles_at_build_;
+    DiscreteVariable<Vecd> *dv_pos_;
+    DiscreteVariable<UnsignedInt> *dv_original_id_;
+    DiscreteVariable<Vecd> *dv_pos_at_build_;
+    DiscreteVariable<UnsignedInt> *dv_original_id_at_build_;
+};
+
+/**
+ * @class SkinNeighborList
+ * @brief Copy of a neighbor list built with a skin.
+ * @details The list in use is filtered from the copy by the pairs within the cut radius,
+ * by counting, scanning for the offsets and filling, as for building the list.
+ * The filtered list is a subset of the copy and fits into the allocated neighbor list.
+ */
+template <class ExecutionPolicy>
+class SkinNeighborList
+{
+    UniquePtrsKeeper<Entity> list_variable_ptrs_;
+
+  public:
+    SkinNeighborList() : dv_skin_neighbor_index_(nullptr), dv_skin_particle_offset_(nullptr) {};
+    void saveList(DiscreteVariable<UnsignedInt> *dv_neighbor_index,
+                  DiscreteVariable<UnsignedInt> *dv_particle_offset, UnsignedInt total_real_particles);
+    /** The function is_within_cut_radius(index_i, index_j) is evaluated for the pairs in the copy. */
+    template <class CriterionFunction>
+    void filterList(DiscreteVariable<UnsignedInt> *dv_neighbor_index,
+                    DiscreteVariable<UnsignedInt> *dv_particle_offset, UnsignedInt total_real_particles,
+                    const CriterionFunction &is_within_cut_radius);
+
+  protected:
+    DiscreteVariable<UnsignedInt> *dv_skin_neighbor_index_;
+    DiscreteVariable<UnsignedInt> *dv_skin_particle_offset_;
+};
+
+/**
+ * @class NeighborListBlocks
+ * @brief Host buffers for building neighbor lists with a single neighbor search.
+ * @details The particles are split into consecutive blocks. The neighbors of a block
+ * are collected into its own buffer while the neighbor sizes are kept in the offset list.
+ * After the total size is known, the offsets are obtained block-wise
+ * and each buffer is copied into the contiguous neighbor index list.
+ * The buffers are cleared but keep their capacity for the next build,
+ * and are only trimmed when their capacity is far above the last used size.
+ */
+class NeighborListBlocks
+{
+  public:
+    static constexpr UnsignedInt block_size_ = 1024;
+    NeighborListBlocks() {};
+    /** Returns the total number of neighbors. */
+    template <class PolicyType, class CollectFunction>
+    UnsignedInt collectNeighbors(const PolicyType &ex_policy, UnsignedInt total_particles,
+                                 UnsignedInt *neighbor_size, const CollectFunction &collect_neighbors);
+    /** Neighbor sizes in particle_offset are overwritten by the offsets and the buffers are cleared. */
+    template <class PolicyType>
+    void packNeighbors(const PolicyType &ex_policy, UnsignedInt total_particles,
+                       UnsignedInt *particle_offset, UnsignedInt *neighbor_index);
+
+  protected:
+    StdVec<StdVec<UnsignedInt>> block_buffers_;
+    StdVec<UnsignedInt> block_offset_;
+};
+
 template <typename... T>
 class UpdateRelation;
 
@@ -45,10 +140,15 @@ template <class ExecutionPolicy, typename... Parameters>
 class UpdateRelation<ExecutionPolicy, Inner<Parameters...>>
     : public Interaction<Inner<Parameters...>>, public BaseDynamics<void>
 {
+    using NeighborCriterion = typename Interaction<Inner<Parameters...>>::InteractKernel::NeighborCriterion;
+
   public:
     UpdateRelation(Relation<Inner<Parameters...>> &inner_relation);
     virtual ~UpdateRelation() {};
     virtual void exec(Real dt = 0.0) override;
+    /** Build the neighbor list with a skin and rebuild only when the largest displacement exceeds half skin. */
+    void setNeighborSkin(Real skin);
+    NeighborSkin<ExecutionPolicy> &getNeighborSkin() { return neighbor_skin_; };
 
   protected:
     class InteractKernel
@@ -59,17 +159,39 @@ class UpdateRelation<ExecutionPolicy, Inner<Parameters...>>
         InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
         void incrementNeighborSize(UnsignedInt index_i);
         void updateNeighborList(UnsignedInt index_i);
+        template <class BufferType>
+        void collectNeighbors(UnsignedInt index_i, BufferType &buffer);
+        bool isWithinCutRadius(UnsignedInt index_i, UnsignedInt index_j) const
+        {
+            return neighbor_criterion_(index_j, index_i);
+        };
 
       protected:
         NeighborSearch neighbor_search_;
-        Real grid_spacing_squared_;
+        Real search_radius_squared_;
+        NeighborCriterion neighbor_criterion_;
     };
     typedef UpdateRelation<ExecutionPolicy, Inner<Parameters...>> LocalDynamicsType;
     using KernelImplementation = Implementation<ExecutionPolicy, LocalDynamicsType, InteractKernel>;
 
     ExecutionPolicy ex_policy_;
     CellLinkedList &cell_linked_list_;
+    NeighborSkin<ExecutionPolicy> neighbor_skin_;
     Implementation<ExecutionPolicy, LocalDynamicsType, InteractKernel> kernel_implementation_;
+    SkinNeighborList<ExecutionPolicy> skin_neighbor_list_;
+    NeighborListBlocks neighbor_list_blocks_;
+    bool is_half_neighbor_list_built_;
+    int searchDepth();
+    /** Build the half neighbor list and the reverse pairs from the neighbor list. */
+    void buildHalfNeighborList(UnsignedInt total_real_particles);
+    /** Counting and then filling the list, used for device execution. */
+    template <class PolicyType>
+    void buildNeighborList(const PolicyType &ex_policy, UnsignedInt total_real_particles);
+    /** Single search pass with block buffers for host execution. */
+    void buildNeighborList(const SequencedPolicy &seq, UnsignedInt total_real_particles);
+    void buildNeighborList(const ParallelPolicy &par, UnsignedInt total_real_particles);
+    template <class PolicyType>
+    void buildNeighborListByBlocks(const PolicyType &ex_policy, UnsignedInt total_real_particles);
 };
 
 template <class ExecutionPolicy, typename... Parameters>
@@ -86,6 +208,10 @@ class UpdateRelation<ExecutionPolicy, Contact<Parameters...>>
     UpdateRelation(Relation<Contact<Parameters...>> &contact_relation);
     virtual ~UpdateRelation() {};
     virtual void exec(Real dt = 0.0) override;
+    /** Build the neighbor lists with a skin and rebuild only when source and target
+     *  particles together have moved more than the skin. */
+    void setNeighborSkin(Real skin);
+    NeighborSkin<ExecutionPolicy> &getNeighborSkin() { return neighbor_skin_; };
 
   protected:
     class InteractKernel
@@ -96,18 +222,43 @@ class UpdateRelation<ExecutionPolicy, Contact<Parameters...>>
         InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser, UnsignedInt contact_index);
         void incrementNeighborSize(UnsignedInt source_index);
         void updateNeighborList(UnsignedInt source_index);
+        template <class BufferType>
+        void collectNeighbors(UnsignedInt source_index, BufferType &buffer);
+        bool isWithinCutRadius(UnsignedInt source_index, UnsignedInt target_index) const
+        {
+            return neighbor_criterion_(target_index, source_index);
+        };
 
       protected:
         MaskedCriterion masked_criterion_;
         NeighborSearch neighbor_search_;
+        NeighborCriterion neighbor_criterion_;
     };
 
     typedef UpdateRelation<ExecutionPolicy, Contact<Parameters...>> LocalDynamicsType;
     using KernelImplementation = Implementation<ExecutionPolicy, LocalDynamicsType, InteractKernel>;
     UniquePtrsKeeper<KernelImplementation> contact_kernel_implementation_ptrs_;
+    UniquePtrsKeeper<NeighborSkin<ExecutionPolicy>> contact_skin_ptrs_;
+    UniquePtrsKeeper<SkinNeighborList<ExecutionPolicy>> skin_neighbor_list_ptrs_;
     ExecutionPolicy ex_policy_;
     StdVec<CellLinkedList *> contact_cell_linked_list_;
     StdVec<KernelImplementation *> contact_kernel_implementation_;
+    NeighborSkin<ExecutionPolicy> neighbor_skin_;
+    StdVec<NeighborSkin<ExecutionPolicy> *> contact_neighbor_skin_;
+    StdVec<SkinNeighborList<ExecutionPolicy> *> contact_skin_neighbor_list_;
+    NeighborListBlocks neighbor_list_blocks_;
+    int searchDepth(UnsignedInt contact_index);
+    bool isRebuildRequired();
+    template <class PolicyType>
+    void buildNeighborList(const PolicyType &ex_policy, UnsignedInt contact_index,
+                           UnsignedInt total_real_particles);
+    void buildNeighborList(const SequencedPolicy &seq, UnsignedInt contact_index,
+                           UnsignedInt total_real_particles);
+    void buildNeighborList(const ParallelPolicy &par, UnsignedInt contact_index,
+                           UnsignedInt total_real_particles);
+    template <class PolicyType>
+    void buildNeighborListByBlocks(const PolicyType &ex_policy, UnsignedInt contact_index,
+                                   UnsignedInt total_real_particles);
 };
 
 template <class ExecutionPolicy>
@@ -116,6 +267,7 @@ class UpdateRelation<ExecutionPolicy>
   public:
     UpdateRelation() {};
     void exec(Real dt = 0.0) {};
+    void setNeighborSkin(Real skin) {};
 };
 
 template <class ExecutionPolicy, class FirstRelation, class... Others>
@@ -130,6 +282,7 @@ class UpdateRelation<ExecutionPolicy, FirstRelation, Others...>
     explicit UpdateRelation(
         FirstParameterSet &&first_parameter_set, OtherParameterSets &&...other_parameter_sets);
     virtual void exec(Real dt = 0.0) override;
+    void setNeighborSkin(Real skin);
 };
 } // namespace SPH
 #endif // UPDATE_BODY_RELATION_H
@@ -9,22 +9,228 @@
 namespace SPH
 {
 //=================================================================================================//
+template <class PolicyType, class CollectFunction>
+UnsignedInt NeighborListBlocks::collectNeighbors(
+    const PolicyType &ex_policy, UnsignedInt total_particles,
+    UnsignedInt *neighbor_size, const CollectFunction &collect_neighbors)
+{
+    UnsignedInt number_of_blocks = (total_particles + block_size_ - 1) / block_size_;
+    if (block_buffers_.size() < number_of_blocks)
+        block_buffers_.resize(number_of_blocks);
+    block_offset_.resize(number_of_blocks + 1);
+
+    particle_for(ex_policy, IndexRange(0, number_of_blocks),
+                 [&](size_t block)
+                 {
+                     StdVec<UnsignedInt> &buffer = block_buffers_[block];
+                     buffer.clear();
+                     UnsignedInt end = SMIN(UnsignedInt((block + 1) * block_size_), total_particles);
+                     for (UnsignedInt i = block * block_size_; i != end; ++i)
+                     {
+                         size_t previous_size = buffer.size();
+                         collect_neighbors(i, buffer);
+                         neighbor_size[i] = buffer.size() - previous_size;
+                     }
+                 });
+
+    block_offset_[0] = 0;
+    for (UnsignedInt block = 0; block != number_of_blocks; ++block)
+    {
+        block_offset_[block + 1] = block_offset_[block] + block_buffers_[block].size();
+    }
+    return block_offset_[number_of_blocks];
+}
+//=================================================================================================//
+template <class PolicyType>
+void NeighborListBlocks::packNeighbors(
+    const PolicyType &ex_policy, UnsignedInt total_particles,
+    UnsignedInt *particle_offset, UnsignedInt *neighbor_index)
+{
+    UnsignedInt number_of_blocks = block_offset_.size() - 1;
+    particle_for(ex_policy, IndexRange(0, number_of_blocks),
+                 [&](size_t block)
+                 {
+                     UnsignedInt offset = block_offset_[block];
+                     UnsignedInt end = SMIN(UnsignedInt((block + 1) * block_size_), total_particles);
+                     for (UnsignedInt i = block * block_size_; i != end; ++i)
+                     {
+                         UnsignedInt neighbor_size = particle_offset[i];
+                         particle_offset[i] = offset;
+                         offset += neighbor_size;
+                     }
+                     StdVec<UnsignedInt> &buffer = block_buffers_[block];
+                     std::copy(buffer.begin(), buffer.end(), neighbor_index + block_offset_[block]);
+                     if (buffer.capacity() > 4 * buffer.size() + block_size_)
+                         buffer.shrink_to_fit(); // only trim a buffer grown far beyond its use
+                     buffer.clear();
+                 });
+    particle_offset[total_particles] = block_offset_[number_of_blocks];
+}
+//=================================================================================================//
+template <class ExecutionPolicy>
+NeighborSkin<ExecutionPolicy>::NeighborSkin(SPHBody &sph_body)
+    : sph_body_(sph_body), particles_(sph_body.getBaseParticles()),
+      skin_(0.0), is_built_(false), number_of_builds_(0), total_real_particles_at_build_(0),
+      dv_pos_(particles_.getVariableByName<Vecd>("Position")),
+      dv_original_id_(particles_.getVariableByName<UnsignedInt>("OriginalID")),
+      dv_pos_at_build_(nullptr), dv_original_id_at_build_(nullptr) {}
+//=================================================================================================//
+template <class ExecutionPolicy>
+void NeighborSkin<ExecutionPolicy>::setSkin(Real skin)
+{
+    skin_ = skin;
+    is_built_ = false;
+    if (dv_pos_at_build_ == nullptr)
+    {
+        dv_pos_at_build_ = skin_variable_ptrs_.createPtr<DiscreteVariable<Vecd>>(
+            "PositionAtNeighborBuild", particles_.ParticlesBound());
+        dv_original_id_at_build_ = skin_variable_ptrs_.createPtr<DiscreteVariable<UnsignedInt>>(
+            "OriginalIDAtNeighborBuild", particles_.ParticlesBound());
+    }
+}
+//=================================================================================================//
+template <class ExecutionPolicy>
+Real NeighborSkin<ExecutionPolicy>::MaxDisplacement()
+{
+    if (!is_built_ || particles_.TotalRealParticles() != total_real_particles_at_build_)
+        return MaxReal;
+
+    Vecd *pos = dv_pos_->DelegatedData(ExecutionPolicy{});
+    UnsignedInt *original_id = dv_original_id_->DelegatedData(ExecutionPolicy{});
+    Vecd *pos_at_build = dv_pos_at_build_->DelegatedData(ExecutionPolicy{});
+    UnsignedInt *original_id_at_build = dv_original_id_at_build_->DelegatedData(ExecutionPolicy{});
+    Real max_displacement_sqr = particle_reduce<ReduceMax>(
+        LoopRangeCK<ExecutionPolicy, SPHBody>(sph_body_), Real(0),
+        [=](size_t i) -> Real
+        {
+            return original_id[i] == original_id_at_build[i]
+                       ? (pos[i] - pos_at_build[i]).squaredNorm()
+                       : MaxReal;
+        });
+    return sqrt(max_displacement_sqr);
+}
+//=================================================================================================//
+template <class ExecutionPolicy>
+void NeighborSkin<ExecutionPolicy>::recordBuild()
+{
+    Vecd *pos = dv_pos_->DelegatedData(ExecutionPolicy{});
+    UnsignedInt *original_id = dv_original_id_->DelegatedData(ExecutionPolicy{});
+    Vecd *pos_at_build = dv_pos_at_build_->DelegatedData(ExecutionPolicy{});
+    UnsignedInt *original_id_at_build = dv_original_id_at_build_->DelegatedData(ExecutionPolicy{});
+    total_real_particles_at_build_ = particles_.TotalRealParticles();
+    particle_for(ExecutionPolicy{}, IndexRange(0, total_real_particles_at_build_),
+                 [=](size_t i)
+                 {
+                     pos_at_build[i] = pos[i];
+                     original_id_at_build[i] = original_id[i];
+                 });
+    is_built_ = true;
+    number_of_builds_++;
+}
+//=================================================================================================//
+template <class ExecutionPolicy>
+void SkinNeighborList<ExecutionPolicy>::saveList(
+    DiscreteVariable<UnsignedInt> *dv_neighbor_index,
+    DiscreteVariable<UnsignedInt> *dv_particle_offset, UnsignedInt total_real_particles)
+{
+    ExecutionPolicy ex_policy;
+    if (dv_skin_neighbor_index_ == nullptr)
+    {
+        dv_skin_neighbor_index_ = list_variable_ptrs_.createPtr<DiscreteVariable<UnsignedInt>>(
+            "SkinNeighborIndex", dv_neighbor_index->getDataSize());
+        dv_skin_particle_offset_ = list_variable_ptrs_.createPtr<DiscreteVariable<UnsignedInt>>(
+            "SkinParticleOffset", dv_particle_offset->getDataSize());
+    }
+    dv_skin_neighbor_index_->reallocateData(ex_policy, dv_neighbor_index->getDataSize());
+    dv_skin_particle_offset_->reallocateData(ex_policy, dv_particle_offset->getDataSize());
+
+    UnsignedInt *neighbor_index = dv_neighbor_index->DelegatedData(ex_policy);
+    UnsignedInt *particle_offset = dv_particle_offset->DelegatedData(ex_policy);
+    UnsignedInt *skin_neighbor_index = dv_skin_neighbor_index_->DelegatedData(ex_policy);
+    UnsignedInt *skin_particle_offset = dv_skin_particle_offset_->DelegatedData(ex_policy);
+    particle_for(ex_policy, IndexRange(0, total_real_particles + 1),
+                 [=](size_t i)
+                 {
+                     skin_particle_offset[i] = particle_offset[i];
+                     if (i != total_real_particles)
+                     {
+                         for (UnsignedInt n = particle_offset[i]; n != particle_offset[i + 1]; ++n)
+                             skin_neighbor_index[n] = neighbor_index[n];
+                     }
+                 });
+}
+//=================================================================================================//
+template <class ExecutionPolicy>
+template <class CriterionFunction>
+void SkinNeighborList<ExecutionPolicy>::filterList(
+    DiscreteVariable<UnsignedInt> *dv_neighbor_index,
+    DiscreteVariable<UnsignedInt> *dv_particle_offset, UnsignedInt total_real_particles,
+    const CriterionFunction &is_within_cut_radius)
+{
+    ExecutionPolicy ex_policy;
+    UnsignedInt *neighbor_index = dv_neighbor_index->DelegatedData(ex_policy);
+    UnsignedInt *particle_offset = dv_particle_offset->DelegatedData(ex_policy);
+    UnsignedInt *skin_neighbor_index = dv_skin_neighbor_index_->DelegatedData(ex_policy);
+    UnsignedInt *skin_particle_offset = dv_skin_particle_offset_->DelegatedData(ex_policy);
+    // Here, neighbor_index takes role of temporary storage for neighbor size list.
+    particle_for(ex_policy, IndexRange(0, total_real_particles),
+                 [=](size_t i)
+                 {
+                     UnsignedInt neighbor_count = 0;
+                     for (UnsignedInt n = skin_particle_offset[i]; n != skin_particle_offset[i + 1]; ++n)
+                     {
+                         if (is_within_cut_radius(i, skin_neighbor_index[n]))
+                             neighbor_count++;
+                     }
+                     neighbor_index[i] = neighbor_count;
+                 });
+
+    exclusive_scan(ex_policy, neighbor_index, particle_offset, total_real_particles + 1,
+                   typename PlusUnsignedInt<ExecutionPolicy>::type());
+
+    particle_for(ex_policy, IndexRange(0, total_real_particles),
+                 [=](size_t i)
+                 {
+                     UnsignedInt neighbor_count = particle_offset[i];
+                     for (UnsignedInt n = skin_particle_offset[i]; n != skin_particle_offset[i + 1]; ++n)
+                     {
+                         if (is_within_cut_radius(i, skin_neighbor_index[n]))
+                             neighbor_index[neighbor_count++] = skin_neighbor_index[n];
+                     }
+                 });
+}
+//=================================================================================================//
 template <class ExecutionPolicy, typename... Parameters>
 UpdateRelation<ExecutionPolicy, Inner<Parameters...>>::
     UpdateRelation(Relation<Inner<Parameters...>> &inner_relation)
     : Interaction<Inner<Parameters...>>(inner_relation),
       BaseDynamics<void>(), ex_policy_(ExecutionPolicy{}),
       cell_linked_list_(inner_relation.getCellLinkedList()),
-      kernel_implementation_(*this) {}
+      neighbor_skin_(inner_relation.getSPHBody()),
+      kernel_implementation_(*this), is_half_neighbor_list_built_(false) {}
+//=================================================================================================//
+template <class ExecutionPolicy, typename... Parameters>
+void UpdateRelation<ExecutionPolicy, Inner<Parameters...>>::setNeighborSkin(Real skin)
+{
+    neighbor_skin_.setSkin(skin);
+    kernel_implementation_.resetUpdated();
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename... Parameters>
+int UpdateRelation<ExecutionPolicy, Inner<Parameters...>>::searchDepth()
+{
+    return 1 + (int)ceil(neighbor_skin_.Skin() / cell_linked_list_.getMesh().GridSpacing());
+}
 //=================================================================================================//
 template <class ExecutionPolicy, typename... Parameters>
 template <class EncloserType>
 UpdateRelation<ExecutionPolicy, Inner<Parameters...>>::InteractKernel::InteractKernel(
     const ExecutionPolicy &ex_policy, EncloserType &encloser)
     : Interaction<Inner<Parameters...>>::InteractKernel(ex_policy, encloser),
-      neighbor_search_(encloser.cell_linked_list_.createNeighborSearch(ex_policy)),
-      grid_spacing_squared_(
-          pow(encloser.cell_linked_list_.getMesh().GridSpacing(), 2)) {}
+      neighbor_search_(encloser.cell_linked_list_.createNeighborSearch(ex_policy, encloser.searchDepth())),
+      search_radius_squared_(
+          pow(encloser.cell_linked_list_.getMesh().GridSpacing() + encloser.neighbor_skin_.Skin(), 2)),
+      neighbor_criterion_(*this) {}
 //=================================================================================================//
 template <class ExecutionPolicy, typename... Parameters>
 void UpdateRelation<ExecutionPolicy, Inner<Parameters...>>::
@@ -39,7 +245,7 @@ void UpdateRelation<ExecutionPolicy, Inner<Parameters...>>::
             if (index_i != index_j)
             {
                 if ((this->source_pos_[index_i] - this->target_pos_[index_j])
-                        .squaredNorm() < grid_spacing_squared_)
+                        .squaredNorm() < search_radius_squared_)
                     neighbor_count++;
             }
         });
@@ -58,7 +264,7 @@ void UpdateRelation<ExecutionPolicy, Inner<Parameters...>>::
             if (index_i != index_j)
             {
                 if ((this->source_pos_[index_i] - this->target_pos_[index_j])
-                        .squaredNorm() < grid_spacing_squared_)
+                        .squaredNorm() < search_radius_squared_)
                 {
                     this->neighbor_index_[this->particle_offset_[index_i] + neighbor_count] = index_j;
                     neighbor_count++;
@@ -68,9 +274,197 @@ void UpdateRelation<ExecutionPolicy, Inner<Parameters...>>::
 }
 //=================================================================================================//
 template <class ExecutionPolicy, typename... Parameters>
+template <class BufferType>
+void UpdateRelation<ExecutionPolicy, Inner<Parameters...>>::
+    InteractKernel::collectNeighbors(UnsignedInt index_i, BufferType &buffer)
+{
+    neighbor_search_.forEachSearch(
+        index_i, this->source_pos_,
+        [&](size_t index_j)
+        {
+            if (index_i != index_j)
+            {
+                if ((this->source_pos_[index_i] - this->target_pos_[index_j])
+                        .squaredNorm() < search_radius_squared_)
+                    buffer.push_back(index_j);
+            }
+        });
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename... Parameters>
 void UpdateRelation<ExecutionPolicy, Inner<Parameters...>>::exec(Real dt)
 {
+    ProfilingScope profiling_scope(ExecutionPolicy{}, this->profilingRecord(this->getSPHBody()), this->particles_->TotalRealParticles());
+    bool is_rebuild_required =
+        !neighbor_skin_.isActive() || neighbor_skin_.MaxDisplacement() >= 0.5 * neighbor_skin_.Skin();
+
     UnsignedInt total_real_particles = this->particles_->TotalRealParticles();
+
+    if (is_rebuild_required)
+    {
+        buildNeighborList(ex_policy_, total_real_particles);
+
+        if (neighbor_skin_.isActive())
+        {
+            neighbor_skin_.recordBuild();
+            skin_neighbor_list_.saveList(this->dv_neighbor_index_, this->dv_particle_offset_, total_real_particles);
+        }
+    }
+
+    if (neighbor_skin_.isActive())
+    {
+        InteractKernel *computing_kernel = kernel_implementation_.getComputingKernel();
+        skin_neighbor_list_.filterList(
+            this->dv_neighbor_index_, this->dv_particle_offset_, total_real_particles,
+            [=](UnsignedInt i, UnsignedInt j)
+            { return computing_kernel->isWithinCutRadius(i, j); });
+    }
+
+    // a symmetric interaction may be created after the neighbor list is built with a skin
+    if (this->inner_relation_.isHalfNeighborListRequired() &&
+        (is_rebuild_required || neighbor_skin_.isActive() || !is_half_neighbor_list_built_))
+    {
+        buildHalfNeighborList(this->particles_->TotalRealParticles());
+        is_half_neighbor_list_built_ = true;
+    }
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename... Parameters>
+void UpdateRelation<ExecutionPolicy, Inner<Parameters...>>::
+    buildHalfNeighborList(UnsignedInt total_real_particles)
+{
+    Relation<Inner<Parameters...>> &inner_relation = this->inner_relation_;
+    UnsignedInt *neighbor_index = this->dv_neighbor_index_->DelegatedData(ex_policy_);
+    UnsignedInt *particle_offset = this->dv_particle_offset_->DelegatedData(ex_policy_);
+    // Here, the half neighbor and reverse pair lists take role of temporary storage for the sizes.
+    UnsignedInt *half_neighbor_size = inner_relation.getHalfNeighborIndex()->DelegatedData(ex_policy_);
+    UnsignedInt *reverse_pair_size = inner_relation.getReversePairIndex()->DelegatedData(ex_policy_);
+    particle_for(ex_policy_,
+                 IndexRange(0, total_real_particles),
+                 [=](size_t i)
+                 {
+                     UnsignedInt half_neighbor_count = 0;
+                     UnsignedInt reverse_pair_count = 0;
+                     for (UnsignedInt n = particle_offset[i]; n != particle_offset[i + 1]; ++n)
+                     {
+                         // the neighbor list is symmetric for real particles and
+                         // buffer particles, if any, are indexed after all real particles
+                         if (neighbor_index[n] > i)
+                             half_neighbor_count++;
+                         else
+                             reverse_pair_count++;
+                     }
+                     half_neighbor_size[i] = half_neighbor_count;
+                     reverse_pair_size[i] = reverse_pair_count;
+                 });
+
+    UnsignedInt *half_particle_offset = inner_relation.getHalfParticleOffset()->DelegatedData(ex_policy_);
+    UnsignedInt *reverse_pair_offset = inner_relation.getReversePairOffset()->DelegatedData(ex_policy_);
+    UnsignedInt current_offset_list_size = total_real_particles + 1;
+    UnsignedInt current_half_neighbor_index_size =
+        exclusive_scan(ex_policy_, half_neighbor_size, half_particle_offset, current_offset_list_size,
+                       typename PlusUnsignedInt<ExecutionPolicy>::type());
+    exclusive_scan(ex_policy_, reverse_pair_size, reverse_pair_offset, current_offset_list_size,
+                   typename PlusUnsignedInt<ExecutionPolicy>::type());
+
+    if (current_half_neighbor_index_size > inner_relation.getHalfNeighborIndex()->getDataSize())
+    {
+        inner_relation.reallocateHalfNeighborList(ex_policy_, current_half_neighbor_index_size);
+        inner_relation.resetComputingKernelUpdated();
+    }
+
+    UnsignedInt *half_neighbor_index = inner_relation.getHalfNeighborIndex()->DelegatedData(ex_policy_);
+    particle_for(ex_policy_,
+                 IndexRange(0, total_real_particles),
+                 [=](size_t i)
+                 {
+                     UnsignedInt half_neighbor_count = half_particle_offset[i];
+                     for (UnsignedInt n = particle_offset[i]; n != particle_offset[i + 1]; ++n)
+                     {
+                         if (neighbor_index[n] > i)
+                             half_neighbor_index[half_neighbor_count++] = neighbor_index[n];
+                     }
+                 });
+
+    UnsignedInt *reverse_neighbor_index = inner_relation.getReverseNeighborIndex()->DelegatedData(ex_policy_);
+    UnsignedInt *reverse_pair_index = inner_relation.getReversePairIndex()->DelegatedData(ex_policy_);
+    // the pairs which are not found in the half neighbor lists are counted to fail loudly
+    UnsignedInt number_of_missing_pairs =
+        particle_reduce(ex_policy_, IndexRange(0, total_real_particles), UnsignedInt(0), ReduceSum<UnsignedInt>(),
+                        [=](size_t j)
+                        {
+                            UnsignedInt missing_pairs = 0;
+                            UnsignedInt reverse_pair_count = reverse_pair_offset[j];
+                            for (UnsignedInt n = particle_offset[j]; n != particle_offset[j + 1]; ++n)
+                            {
+                                UnsignedInt i = neighbor_index[n];
+                                if (i < j)
+                                {
+                                    // the pair is located in the half neighbor list of particle i
+                                    UnsignedInt pair_index = half_particle_offset[i];
+                                    UnsignedInt last_pair_index = half_particle_offset[i + 1];
+                                    while (pair_index != last_pair_index && half_neighbor_index[pair_index] != j)
+                                        pair_index++;
+                                    missing_pairs += pair_index == last_pair_index ? 1 : 0;
+                                    reverse_neighbor_index[reverse_pair_count] = i;
+                                    reverse_pair_index[reverse_pair_count] = pair_index;
+                                    reverse_pair_count++;
+                                }
+                            }
+                            return missing_pairs;
+                        });
+
+    if (number_of_missing_pairs != 0)
+    {
+        std::cout << "\n Error: " << number_of_missing_pairs
+                  << " neighbor pairs are not found in the half neighbor lists, the neighbor list is not symmetric!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename... Parameters>
+void UpdateRelation<ExecutionPolicy, Inner<Parameters...>>::
+    buildNeighborList(const SequencedPolicy &seq, UnsignedInt total_real_particles)
+{
+    buildNeighborListByBlocks(seq, total_real_particles);
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename... Parameters>
+void UpdateRelation<ExecutionPolicy, Inner<Parameters...>>::
+    buildNeighborList(const ParallelPolicy &par, UnsignedInt total_real_particles)
+{
+    buildNeighborListByBlocks(par, total_real_particles);
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename... Parameters>
+template <class PolicyType>
+void UpdateRelation<ExecutionPolicy, Inner<Parameters...>>::
+    buildNeighborListByBlocks(const PolicyType &ex_policy, UnsignedInt total_real_particles)
+{
+    InteractKernel *computing_kernel = kernel_implementation_.getComputingKernel();
+    UnsignedInt *particle_offset = this->dv_particle_offset_->DelegatedData(ex_policy_);
+    UnsignedInt current_neighbor_index_size = neighbor_list_blocks_.collectNeighbors(
+        ex_policy, total_real_particles, particle_offset,
+        [&](UnsignedInt i, StdVec<UnsignedInt> &buffer)
+        { computing_kernel->collectNeighbors(i, buffer); });
+
+    if (current_neighbor_index_size > this->dv_neighbor_index_->getDataSize())
+    {
+        this->dv_neighbor_index_->reallocateData(ex_policy_, current_neighbor_index_size);
+        this->inner_relation_.resetComputingKernelUpdated();
+        kernel_implementation_.overwriteComputingKernel();
+    }
+
+    UnsignedInt *neighbor_index = this->dv_neighbor_index_->DelegatedData(ex_policy_);
+    neighbor_list_blocks_.packNeighbors(ex_policy, total_real_particles, particle_offset, neighbor_index);
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename... Parameters>
+template <class PolicyType>
+void UpdateRelation<ExecutionPolicy, Inner<Parameters...>>::
+    buildNeighborList(const PolicyType &ex_policy, UnsignedInt total_real_particles)
+{
     InteractKernel *computing_kernel = kernel_implementation_.getComputingKernel();
     particle_for(ex_policy_,
                  IndexRange(0, total_real_particles),
@@ -102,13 +496,51 @@ UpdateRelation<ExecutionPolicy, Contact<Parameters...>>::
     UpdateRelation(Relation<Contact<Parameters...>> &contact_relation)
     : Interaction<Contact<Parameters...>>(contact_relation),
       BaseDynamics<void>(), ex_policy_(ExecutionPolicy{}),
-      contact_cell_linked_list_(contact_relation.getContactCellLinkedList())
+      contact_cell_linked_list_(contact_relation.getContactCellLinkedList()),
+      neighbor_skin_(contact_relation.getSPHBody())
 {
     for (size_t k = 0; k != this->contact_bodies_.size(); ++k)
     {
         contact_kernel_implementation_.push_back(
             contact_kernel_implementation_ptrs_.template createPtr<KernelImplementation>(*this));
+        contact_neighbor_skin_.push_back(
+            contact_skin_ptrs_.template createPtr<NeighborSkin<ExecutionPolicy>>(*this->contact_bodies_[k]));
+        contact_skin_neighbor_list_.push_back(
+            skin_neighbor_list_ptrs_.template createPtr<SkinNeighborList<ExecutionPolicy>>());
+    }
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename... Parameters>
+void UpdateRelation<ExecutionPolicy, Contact<Parameters...>>::setNeighborSkin(Real skin)
+{
+    neighbor_skin_.setSkin(skin);
+    for (size_t k = 0; k != this->contact_bodies_.size(); ++k)
+    {
+        contact_neighbor_skin_[k]->setSkin(skin);
+        contact_kernel_implementation_[k]->resetUpdated();
+    }
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename... Parameters>
+int UpdateRelation<ExecutionPolicy, Contact<Parameters...>>::searchDepth(UnsignedInt contact_index)
+{
+    Real grid_spacing = contact_cell_linked_list_[contact_index]->getMesh().GridSpacing();
+    return 1 + (int)ceil(neighbor_skin_.Skin() / grid_spacing);
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename... Parameters>
+bool UpdateRelation<ExecutionPolicy, Contact<Parameters...>>::isRebuildRequired()
+{
+    if (!neighbor_skin_.isActive())
+        return true;
+
+    Real source_displacement = neighbor_skin_.MaxDisplacement();
+    for (size_t k = 0; k != this->contact_bodies_.size(); ++k)
+    {
+        if (source_displacement + contact_neighbor_skin_[k]->MaxDisplacement() > neighbor_skin_.Skin())
+            return true;
     }
+    return false;
 }
 //=================================================================================================//
 template <class ExecutionPolicy, typename... Parameters>
@@ -118,9 +550,12 @@ UpdateRelation<ExecutionPolicy, Contact<Parameters...>>::
         const ExecutionPolicy &ex_policy, EncloserType &encloser, UnsignedInt contact_index)
     : Interaction<Contact<Parameters...>>::InteractKernel(ex_policy, encloser, contact_index),
       masked_criterion_(
-          ex_policy, encloser.contact_relation_.getContactIdentifier(contact_index), *this),
+          ex_policy, encloser.contact_relation_.getContactIdentifier(contact_index), *this,
+          encloser.neighbor_skin_.Skin()),
       neighbor_search_(
-          encloser.contact_cell_linked_list_[contact_index]->createNeighborSearch(ex_policy)) {}
+          encloser.contact_cell_linked_list_[contact_index]->createNeighborSearch(
+              ex_policy, encloser.searchDepth(contact_index))),
+      neighbor_criterion_(*this) {}
 //=================================================================================================//
 template <class ExecutionPolicy, typename... Parameters>
 void UpdateRelation<ExecutionPolicy, Contact<Parameters...>>::
@@ -156,36 +591,127 @@ void UpdateRelation<ExecutionPolicy, Contact<Parameters...>>::
 }
 //=================================================================================================//
 template <class ExecutionPolicy, typename... Parameters>
-void UpdateRelation<ExecutionPolicy, Contact<Parameters...>>::exec(Real dt)
+template <class BufferType>
+void UpdateRelation<ExecutionPolicy, Contact<Parameters...>>::
+    InteractKernel::collectNeighbors(UnsignedInt source_index, BufferType &buffer)
 {
-    UnsignedInt total_real_particles = this->particles_->TotalRealParticles();
+    neighbor_search_.forEachSearch(
+        source_index, this->source_pos_,
+        [&](size_t target_index)
+        {
+            if (masked_criterion_(target_index, source_index))
+                buffer.push_back(target_index);
+        });
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename... Parameters>
+void UpdateRelation<ExecutionPolicy, Contact<Parameters...>>::
+    buildNeighborList(const SequencedPolicy &seq, UnsignedInt contact_index,
+                      UnsignedInt total_real_particles)
+{
+    buildNeighborListByBlocks(seq, contact_index, total_real_particles);
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename... Parameters>
+void UpdateRelation<ExecutionPolicy, Contact<Parameters...>>::
+    buildNeighborList(const ParallelPolicy &par, UnsignedInt contact_index,
+                      UnsignedInt total_real_particles)
+{
+    buildNeighborListByBlocks(par, contact_index, total_real_particles);
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename... Parameters>
+template <class PolicyType>
+void UpdateRelation<ExecutionPolicy, Contact<Parameters...>>::
+    buildNeighborListByBlocks(const PolicyType &ex_policy, UnsignedInt contact_index,
+                              UnsignedInt total_real_particles)
+{
+    UnsignedInt k = contact_index;
+    InteractKernel *computing_kernel = contact_kernel_implementation_[k]->getComputingKernel(k);
+    UnsignedInt *particle_offset = this->dv_contact_particle_offset_[k]->DelegatedData(ex_policy_);
+    UnsignedInt current_neighbor_index_size = neighbor_list_blocks_.collectNeighbors(
+        ex_policy, total_real_particles, particle_offset,
+        [&](UnsignedInt i, StdVec<UnsignedInt> &buffer)
+        { computing_kernel->collectNeighbors(i, buffer); });
 
-    for (size_t k = 0; k != this->contact_bodies_.size(); ++k)
+    if (current_neighbor_index_size > this->dv_contact_neighbor_index_[k]->getDataSize())
+    {
+        this->dv_contact_neighbor_index_[k]->reallocateData(ex_policy_, current_neighbor_index_size);
+        this->contact_relation_.resetComputingKernelUpdated(k);
+        contact_kernel_implementation_[k]->overwriteComputingKernel(k);
+    }
+
+    UnsignedInt *neighbor_index = this->dv_contact_neighbor_index_[k]->DelegatedData(ex_policy_);
+    neighbor_list_blocks_.packNeighbors(ex_policy, total_real_particles, particle_offset, neighbor_index);
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename... Parameters>
+template <class PolicyType>
+void UpdateRelation<ExecutionPolicy, Contact<Parameters...>>::
+    buildNeighborList(const PolicyType &ex_policy, UnsignedInt contact_index,
+                      UnsignedInt total_real_particles)
+{
+    UnsignedInt k = contact_index;
+    InteractKernel *computing_kernel = contact_kernel_implementation_[k]->getComputingKernel(k);
+    particle_for(ex_policy_,
+                 IndexRange(0, total_real_particles),
+                 [=](size_t i)
+                 { computing_kernel->incrementNeighborSize(i); });
+
+    UnsignedInt *neighbor_index = this->dv_contact_neighbor_index_[k]->DelegatedData(ex_policy_);
+    UnsignedInt *particle_offset = this->dv_contact_particle_offset_[k]->DelegatedData(ex_policy_);
+    UnsignedInt current_offset_list_size = total_real_particles + 1;
+    UnsignedInt current_neighbor_index_size =
+        exclusive_scan(ex_policy_, neighbor_index, particle_offset, current_offset_list_size,
+                       typename PlusUnsignedInt<ExecutionPolicy>::type());
+
+    if (current_neighbor_index_size > this->dv_contact_neighbor_index_[k]->getDataSize())
     {
-        InteractKernel *computing_kernel = contact_kernel_implementation_[k]->getComputingKernel(k);
-        particle_for(ex_policy_,
-                     IndexRange(0, total_real_particles),
-                     [=](size_t i)
-                     { computing_kernel->incrementNeighborSize(i); });
+        this->dv_contact_neighbor_index_[k]->reallocateData(ex_policy_, current_neighbor_index_size);
+        this->contact_relation_.resetComputingKernelUpdated(k);
+        contact_kernel_implementation_[k]->overwriteComputingKernel(k);
+    }
 
-        UnsignedInt *neighbor_index = this->dv_contact_neighbor_index_[k]->DelegatedData(ex_policy_);
-        UnsignedInt *particle_offset = this->dv_contact_particle_offset_[k]->DelegatedData(ex_policy_);
-        UnsignedInt current_offset_list_size = total_real_particles + 1;
-        UnsignedInt current_neighbor_index_size =
-            exclusive_scan(ex_policy_, neighbor_index, particle_offset, current_offset_list_size,
-                           typename PlusUnsignedInt<ExecutionPolicy>::type());
+    particle_for(ex_policy_,
+                 IndexRange(0, total_real_particles),
+                 [=](size_t i)
+                 { computing_kernel->updateNeighborList(i); });
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename... Parameters>
+void UpdateRelation<ExecutionPolicy, Contact<Parameters...>>::exec(Real dt)
+{
+    ProfilingScope profiling_scope(ExecutionPolicy{}, this->profilingRecord(this->getSPHBody()), this->particles_->TotalRealParticles());
+    UnsignedInt total_real_particles = this->particles_->TotalRealParticles();
+    if (isRebuildRequired())
+    {
+        for (size_t k = 0; k != this->contact_bodies_.size(); ++k)
+        {
+            buildNeighborList(ex_policy_, k, total_real_particles);
+        }
 
-        if (current_neighbor_index_size > this->dv_contact_neighbor_index_[k]->getDataSize())
+        if (neighbor_skin_.isActive())
         {
-            this->dv_contact_neighbor_index_[k]->reallocateData(ex_policy_, current_neighbor_index_size);
-            this->contact_relation_.resetComputingKernelUpdated(k);
-            contact_kernel_implementation_[k]->overwriteComputingKernel(k);
+            neighbor_skin_.recordBuild();
+            for (size_t k = 0; k != this->contact_bodies_.size(); ++k)
+            {
+                contact_neighbor_skin_[k]->recordBuild();
+                contact_skin_neighbor_list_[k]->saveList(
+                    this->dv_contact_neighbor_index_[k], this->dv_contact_particle_offset_[k], total_real_particles);
+            }
         }
+    }
 
-        particle_for(ex_policy_,
-                     IndexRange(0, total_real_particles),
-                     [=](size_t i)
-                     { computing_kernel->updateNeighborList(i); });
+    if (neighbor_skin_.isActive())
+    {
+        for (size_t k = 0; k != this->contact_bodies_.size(); ++k)
+        {
+            InteractKernel *computing_kernel = contact_kernel_implementation_[k]->getComputingKernel(k);
+            contact_skin_neighbor_list_[k]->filterList(
+                this->dv_contact_neighbor_index_[k], this->dv_contact_particle_offset_[k], total_real_particles,
+                [=](UnsignedInt i, UnsignedInt j)
+                { return computing_kernel->isWithinCutRadius(i, j); });
+        }
     }
 }
 //=================================================================================================//
@@ -199,9 +725,17 @@ UpdateRelation<ExecutionPolicy, FirstRelation, Others...>::UpdateRelation(
 template <class ExecutionPolicy, class FirstRelation, class... Others>
 void UpdateRelation<ExecutionPolicy, FirstRelation, Others...>::exec(Real dt)
 {
+    ProfilingScope profiling_scope(ExecutionPolicy{}, this->profilingRecord(this->getSPHBody()), this->particles_->TotalRealParticles());
     UpdateRelation<ExecutionPolicy, FirstRelation>::exec(dt);
     other_interactions_.exec(dt);
 }
 //=================================================================================================//
+template <class ExecutionPolicy, class FirstRelation, class... Others>
+void UpdateRelation<ExecutionPolicy, FirstRelation, Others...>::setNeighborSkin(Real skin)
+{
+    UpdateRelation<ExecutionPolicy, FirstRelation>::setNeighborSkin(skin);
+    other_interactions_.setNeighborSkin(skin);
+}
+//=================================================================================================//
 } // namespace SPH
 #endif // UPDATE_BODY_RELATION_HPP
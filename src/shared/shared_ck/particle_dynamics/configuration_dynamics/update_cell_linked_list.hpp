@@ -69,6 +69,13 @@ template <class ExecutionPolicy, class CellLinkedListType>
 void UpdateCellLinkedList<ExecutionPolicy, CellLinkedListType>::exec(Real dt)
 {
     UnsignedInt total_real_particles = this->particles_->TotalRealParticles();
+    ProfilingScope profiling_scope(ExecutionPolicy{}, this->profilingRecord(this->getSPHBody()), total_real_particles);
+    buildCellLists(total_real_particles);
+}
+//=================================================================================================//
+template <class ExecutionPolicy, class CellLinkedListType>
+void UpdateCellLinkedList<ExecutionPolicy, CellLinkedListType>::buildCellLists(UnsignedInt total_real_particles)
+{
     ComputingKernel *computing_kernel = kernel_implementation_.getComputingKernel();
 
     particle_for(ex_policy_,
@@ -93,5 +100,186 @@ void UpdateCellLinkedList<ExecutionPolicy, CellLinkedListType>::exec(Real dt)
                  { computing_kernel->updateCellList(i); });
 }
 //=================================================================================================//
+template <class ExecutionPolicy, typename CellLinkedListType>
+UpdateCellLinkedListIncrementally<ExecutionPolicy, CellLinkedListType>::
+    UpdateCellLinkedListIncrementally(RealBody &real_body, Real rebuild_ratio)
+    : BaseDynamicsType(real_body),
+      dv_particle_cell_(DiscreteVariable<UnsignedInt>("ParticleCell", this->particles_->ParticlesBound())),
+      dv_previous_particle_index_(DiscreteVariable<UnsignedInt>(
+          "PreviousParticleIndex", this->dv_particle_index_->getDataSize())),
+      dv_previous_cell_offset_(DiscreteVariable<UnsignedInt>(
+          "PreviousCellOffset", this->cell_offset_list_size_)),
+      dv_incoming_cell_size_(DiscreteVariable<UnsignedInt>(
+          "IncomingCellSize", this->cell_offset_list_size_)),
+      rebuild_ratio_(rebuild_ratio), is_built_(false),
+      indexed_particles_(0), number_of_moved_particles_(0),
+      incremental_kernel_implementation_(*this) {}
+//=================================================================================================//
+template <class ExecutionPolicy, typename CellLinkedListType>
+UpdateCellLinkedListIncrementally<ExecutionPolicy, CellLinkedListType>::ComputingKernel::
+    ComputingKernel(const ExecutionPolicy &ex_policy,
+                    UpdateCellLinkedListIncrementally<ExecutionPolicy, CellLinkedListType> &encloser)
+    : BaseDynamicsType::ComputingKernel(ex_policy, encloser),
+      particle_cell_(encloser.dv_particle_cell_.DelegatedData(ex_policy)),
+      previous_particle_index_(encloser.dv_previous_particle_index_.DelegatedData(ex_policy)),
+      previous_cell_offset_(encloser.dv_previous_cell_offset_.DelegatedData(ex_policy)),
+      incoming_cell_size_(encloser.dv_incoming_cell_size_.DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <class ExecutionPolicy, typename CellLinkedListType>
+void UpdateCellLinkedListIncrementally<ExecutionPolicy, CellLinkedListType>::ComputingKernel::
+    setParticleCell(UnsignedInt index_i)
+{
+    particle_cell_[index_i] = this->mesh_.LinearCellIndexFromPosition(this->pos_[index_i]);
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename CellLinkedListType>
+UnsignedInt UpdateCellLinkedListIncrementally<ExecutionPolicy, CellLinkedListType>::ComputingKernel::
+    updateParticleCell(UnsignedInt index_i)
+{
+    const UnsignedInt linear_index = this->mesh_.LinearCellIndexFromPosition(this->pos_[index_i]);
+    const UnsignedInt previous_linear_index = particle_cell_[index_i];
+    if (linear_index == previous_linear_index)
+    {
+        return 0;
+    }
+
+    // only the moved particles need atomic operation, current_cell_size_ becomes the new cell sizes
+    typename AtomicUnsignedIntRef<ExecutionPolicy>::type
+        atomic_previous_cell_size(this->current_cell_size_[previous_linear_index]);
+    --atomic_previous_cell_size;
+    typename AtomicUnsignedIntRef<ExecutionPolicy>::type
+        atomic_cell_size(this->current_cell_size_[linear_index]);
+    ++atomic_cell_size;
+    typename AtomicUnsignedIntRef<ExecutionPolicy>::type
+        atomic_incoming_cell_size(incoming_cell_size_[linear_index]);
+    ++atomic_incoming_cell_size;
+    particle_cell_[index_i] = linear_index;
+    return 1;
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename CellLinkedListType>
+void UpdateCellLinkedListIncrementally<ExecutionPolicy, CellLinkedListType>::ComputingKernel::
+    clearIncomingCellSize(UnsignedInt cell_index)
+{
+    incoming_cell_size_[cell_index] = 0;
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename CellLinkedListType>
+void UpdateCellLinkedListIncrementally<ExecutionPolicy, CellLinkedListType>::ComputingKernel::
+    savePreviousParticleIndex(UnsignedInt index_i)
+{
+    previous_particle_index_[index_i] = this->particle_index_[index_i];
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename CellLinkedListType>
+UnsignedInt UpdateCellLinkedListIncrementally<ExecutionPolicy, CellLinkedListType>::ComputingKernel::
+    savePreviousCellOffset(UnsignedInt cell_index)
+{
+    previous_cell_offset_[cell_index] = this->cell_offset_[cell_index];
+    if (cell_index + 1 == this->cell_offset_list_size_)
+    {
+        return 0;
+    }
+    const UnsignedInt previous_cell_size = this->cell_offset_[cell_index + 1] - this->cell_offset_[cell_index];
+    return this->current_cell_size_[cell_index] != previous_cell_size ? 1 : 0;
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename CellLinkedListType>
+void UpdateCellLinkedListIncrementally<ExecutionPolicy, CellLinkedListType>::ComputingKernel::
+    patchCellList(UnsignedInt cell_index)
+{
+    // The remaining particles fill the front of the new cell range in their previous order.
+    // The moved ones fill the back of their new cell ranges, which has incoming_cell_size_ slots,
+    // and the incoming sizes are counted down to zero for the next update.
+    UnsignedInt position = this->cell_offset_[cell_index];
+    for (UnsignedInt n = previous_cell_offset_[cell_index]; n < previous_cell_offset_[cell_index + 1]; ++n)
+    {
+        const UnsignedInt index_i = previous_particle_index_[n];
+        const UnsignedInt new_cell_index = particle_cell_[index_i];
+        if (new_cell_index == cell_index)
+        {
+            this->particle_index_[position++] = index_i;
+        }
+        else
+        {
+            typename AtomicUnsignedIntRef<ExecutionPolicy>::type
+                atomic_incoming_cell_size(incoming_cell_size_[new_cell_index]);
+            const UnsignedInt new_cell_end = this->cell_offset_[new_cell_index] + this->current_cell_size_[new_cell_index];
+            this->particle_index_[new_cell_end - atomic_incoming_cell_size--] = index_i;
+        }
+    }
+}
+//=================================================================================================//
+template <class ExecutionPolicy, class CellLinkedListType>
+void UpdateCellLinkedListIncrementally<ExecutionPolicy, CellLinkedListType>::
+    rebuildCellLists(UnsignedInt total_real_particles)
+{
+    ComputingKernel *computing_kernel = incremental_kernel_implementation_.getComputingKernel();
+    this->buildCellLists(total_real_particles);
+    particle_for(this->ex_policy_, IndexRange(0, this->cell_offset_list_size_),
+                 [=](size_t i)
+                 { computing_kernel->clearIncomingCellSize(i); });
+    is_built_ = true;
+    indexed_particles_ = total_real_particles;
+}
+//=================================================================================================//
+template <class ExecutionPolicy, class CellLinkedListType>
+void UpdateCellLinkedListIncrementally<ExecutionPolicy, CellLinkedListType>::exec(Real dt)
+{
+    UnsignedInt total_real_particles = this->particles_->TotalRealParticles();
+    ProfilingScope profiling_scope(ExecutionPolicy{}, this->profilingRecord(this->getSPHBody()), total_real_particles);
+    ComputingKernel *computing_kernel = incremental_kernel_implementation_.getComputingKernel();
+    IndexRange particle_range(0, total_real_particles);
+
+    if (!is_built_ || total_real_particles != indexed_particles_)
+    {
+        particle_for(this->ex_policy_, particle_range,
+                     [=](size_t i)
+                     { computing_kernel->setParticleCell(i); });
+        number_of_moved_particles_ = total_real_particles;
+        rebuildCellLists(total_real_particles);
+        return;
+    }
+
+    number_of_moved_particles_ =
+        particle_reduce(this->ex_policy_, particle_range, UnsignedInt(0), ReduceSum<UnsignedInt>(),
+                        [=](size_t i)
+                        { return computing_kernel->updateParticleCell(i); });
+
+    if (Real(number_of_moved_particles_) > rebuild_ratio_ * Real(total_real_particles))
+    {
+        rebuildCellLists(total_real_particles);
+        return;
+    }
+
+    if (number_of_moved_particles_ == 0)
+    {
+        return;
+    }
+
+    particle_for(this->ex_policy_, particle_range,
+                 [=](size_t i)
+                 { computing_kernel->savePreviousParticleIndex(i); });
+    UnsignedInt number_of_resized_cells =
+        particle_reduce(this->ex_policy_, IndexRange(0, this->cell_offset_list_size_),
+                        UnsignedInt(0), ReduceSum<UnsignedInt>(),
+                        [=](size_t i)
+                        { return computing_kernel->savePreviousCellOffset(i); });
+
+    // the offsets are kept when each cell has the same size, i.e. the moves are balanced
+    if (number_of_resized_cells != 0)
+    {
+        UnsignedInt *current_cell_size = this->dv_current_cell_size_.DelegatedData(this->ex_policy_);
+        UnsignedInt *cell_offset = this->dv_cell_offset_->DelegatedData(this->ex_policy_);
+        exclusive_scan(this->ex_policy_, current_cell_size, cell_offset,
+                       this->cell_offset_list_size_,
+                       typename PlusUnsignedInt<ExecutionPolicy>::type());
+    }
+
+    particle_for(this->ex_policy_, IndexRange(0, this->cell_offset_list_size_ - 1),
+                 [=](size_t i)
+                 { computing_kernel->patchCellList(i); });
+}
+//=================================================================================================//
 } // namespace SPH
 #endif // UPDATE_CELL_LINKED_LIST_HPP
@@ -78,15 +78,16 @@ void PlasticAcousticStep1stHalf<Inner<OneLevel, RiemannSolverType, KernelCorrect
     Real rho_dissipation(0);
     Real rho_i = rho_[index_i];
     Matd stress_tensor_i = degradeToMatd(stress_tensor_3D_[index_i]);
-    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
-    {
-        UnsignedInt index_j = this->neighbor_index_[n];
-        Real dW_ijV_j = this->dW_ij(index_i, index_j) * Vol_[index_j];
-        Vecd nablaW_ijV_j = this->dW_ij(index_i, index_j) * Vol_[index_j] * this->e_ij(index_i, index_j);
-        Matd stress_tensor_j = degradeToMatd(stress_tensor_3D_[index_j]);
-        force += mass_[index_i] * rho_[index_j] * ((stress_tensor_i + stress_tensor_j) / (rho_i * rho_[index_j])) * nablaW_ijV_j;
-        rho_dissipation += riemann_solver_.DissipativeUJump(p_[index_i] - p_[index_j]) * dW_ijV_j;
-    }
+    this->forEachNeighbor(
+        index_i, this->neighbor_index_, this->FirstNeighbor(index_i), this->LastNeighbor(index_i),
+        [&](UnsignedInt index_j, Real dW_ij, const Vecd &e_ij)
+        {
+            Real dW_ijV_j = dW_ij * Vol_[index_j];
+            Vecd nablaW_ijV_j = dW_ij * Vol_[index_j] * e_ij;
+            Matd stress_tensor_j = degradeToMatd(stress_tensor_3D_[index_j]);
+            force += mass_[index_i] * rho_[index_j] * ((stress_tensor_i + stress_tensor_j) / (rho_i * rho_[index_j])) * nablaW_ijV_j;
+            rho_dissipation += riemann_solver_.DissipativeUJump(p_[index_i] - p_[index_j]) * dW_ijV_j;
+        });
     force_[index_i] += force;
     drho_dt_[index_i] = rho_dissipation * rho_[index_i];
 }
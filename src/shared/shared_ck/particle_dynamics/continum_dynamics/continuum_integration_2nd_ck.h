@@ -47,6 +47,8 @@ class PlasticAcousticStep2ndHalf<Inner<OneLevel, RiemannSolverType, KernelCorrec
     using BaseInteraction = PlasticAcousticStep<Interaction<Inner<Parameters...>>>;
 
   public:
+    /** the update changes only the particle's own data not read by the interactions of other particles */
+    static constexpr bool allows_fused_update_ = true;
     explicit PlasticAcousticStep2ndHalf(Relation<Inner<Parameters...>> &inner_relation);
     virtual ~PlasticAcousticStep2ndHalf(){};
 
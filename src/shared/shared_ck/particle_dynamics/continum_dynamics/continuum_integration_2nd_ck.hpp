@@ -53,17 +53,18 @@ void PlasticAcousticStep2ndHalf<Inner<OneLevel, RiemannSolverType, KernelCorrect
     Real density_change_rate(0);
     Vecd p_dissipation = Vecd::Zero();
     Matd velocity_gradient = Matd::Zero();
-    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
-    {
-        UnsignedInt index_j = this->neighbor_index_[n];
-        Vecd e_ij = correction_(index_i) * this->e_ij(index_i, index_j);
-        Real dW_ijV_j = this->dW_ij(index_i, index_j) * Vol_[index_j];
+    this->forEachNeighbor(
+        index_i, this->neighbor_index_, this->FirstNeighbor(index_i), this->LastNeighbor(index_i),
+        [&](UnsignedInt index_j, Real dW_ij, const Vecd &e_ij)
+        {
+            Vecd corrected_e_ij = correction_(index_i) * e_ij;
+            Real dW_ijV_j = dW_ij * Vol_[index_j];
 
-        Real u_jump = (vel_[index_i] - vel_[index_j]).dot(e_ij);
-        density_change_rate += u_jump * dW_ijV_j;
-        p_dissipation += riemann_solver_.DissipativePJump(u_jump) * dW_ijV_j * e_ij;
-        velocity_gradient -= (vel_[index_i] - vel_[index_j]) * dW_ijV_j * e_ij.transpose();
-    }
+            Real u_jump = (vel_[index_i] - vel_[index_j]).dot(corrected_e_ij);
+            density_change_rate += u_jump * dW_ijV_j;
+            p_dissipation += riemann_solver_.DissipativePJump(u_jump) * dW_ijV_j * corrected_e_ij;
+            velocity_gradient -= (vel_[index_i] - vel_[index_j]) * dW_ijV_j * corrected_e_ij.transpose();
+        });
     drho_dt_[index_i] += density_change_rate * rho_[index_i];
     force_[index_i] = p_dissipation * Vol_[index_i];
     velocity_gradient_[index_i] = velocity_gradient;
@@ -129,17 +130,17 @@ void PlasticAcousticStep2ndHalf<Contact<Wall, RiemannSolverType, KernelCorrectio
     Vecd p_dissipation = Vecd::Zero();
     Vecd vel_i = vel_[index_i];
     Matd velocity_gradient = Matd::Zero();
-    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
-    {
-        UnsignedInt index_j = this->neighbor_index_[n];
-        Vecd e_ij = this->e_ij(index_i, index_j);
-        Real dW_ijV_j = this->dW_ij(index_i, index_j) * wall_Vol_[index_j];
-        Vecd vel_in_wall = 2.0 * wall_vel_ave_[index_j] - vel_[index_i];
-        density_change_rate += (vel_i- vel_in_wall).dot(e_ij) * dW_ijV_j;
-        Real u_jump = 2.0 * (vel_i- wall_vel_ave_[index_j]).dot(wall_n_[index_j]);
-        p_dissipation += riemann_solver_.DissipativePJump(u_jump) * dW_ijV_j * wall_n_[index_j];
-        velocity_gradient -= (vel_i - vel_in_wall) * dW_ijV_j * e_ij.transpose();
-    }
+    this->forEachNeighbor(
+        index_i, this->neighbor_index_, this->FirstNeighbor(index_i), this->LastNeighbor(index_i),
+        [&](UnsignedInt index_j, Real dW_ij, const Vecd &e_ij)
+        {
+            Real dW_ijV_j = dW_ij * wall_Vol_[index_j];
+            Vecd vel_in_wall = 2.0 * wall_vel_ave_[index_j] - vel_[index_i];
+            density_change_rate += (vel_i- vel_in_wall).dot(e_ij) * dW_ijV_j;
+            Real u_jump = 2.0 * (vel_i- wall_vel_ave_[index_j]).dot(wall_n_[index_j]);
+            p_dissipation += riemann_solver_.DissipativePJump(u_jump) * dW_ijV_j * wall_n_[index_j];
+            velocity_gradient -= (vel_i - vel_in_wall) * dW_ijV_j * e_ij.transpose();
+        });
     drho_dt_[index_i] += density_change_rate * rho_[index_i];
     force_[index_i] += p_dissipation * Vol_[index_i];
     velocity_gradient_[index_i] += velocity_gradient;
@@ -114,6 +114,44 @@ class AcousticStep1stHalf<Inner<OneLevel, RiemannSolverType, KernelCorrectionTyp
     RiemannSolverType riemann_solver_;
 };
 
+/**
+ * The symmetric form evaluates each pair once with the half neighbor list.
+ * The pressure force and the density dissipation are antisymmetric for a pair,
+ * so that the pair values are applied with opposite signs to the two particles.
+ */
+template <class RiemannSolverType, class KernelCorrectionType, typename... Parameters>
+class AcousticStep1stHalf<Inner<OneLevel, Symmetric, RiemannSolverType, KernelCorrectionType, Parameters...>>
+    : public AcousticStep1stHalf<Inner<OneLevel, RiemannSolverType, KernelCorrectionType, Parameters...>>
+{
+    using BaseInteraction = AcousticStep<Interaction<Inner<Parameters...>>>;
+    using CorrectionKernel = typename KernelCorrectionType::ComputingKernel;
+
+  public:
+    explicit AcousticStep1stHalf(Relation<Inner<Parameters...>> &inner_relation);
+    virtual ~AcousticStep1stHalf() {};
+
+    class InteractKernel : public BaseInteraction::SymmetricInteractKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void interactPair(size_t index_i);
+        void interact(size_t index_i, Real dt = 0.0);
+
+      protected:
+        CorrectionKernel correction_;
+        RiemannSolverType riemann_solver_;
+        Real *Vol_, *rho_, *p_, *drho_dt_;
+        Vecd *force_;
+        Vecd *pair_force_;
+        Real *pair_dissipation_;
+    };
+
+  protected:
+    DiscreteVariable<Vecd> *dv_pair_force_;
+    DiscreteVariable<Real> *dv_pair_dissipation_;
+};
+
 template <class RiemannSolverType, class KernelCorrectionType, typename... Parameters>
 class AcousticStep1stHalf<Contact<Wall, RiemannSolverType, KernelCorrectionType, Parameters...>>
     : public AcousticStep<Interaction<Contact<Wall, Parameters...>>>
@@ -152,6 +190,9 @@ using AcousticStep1stHalfWithWallRiemannCK =
 using AcousticStep1stHalfWithWallRiemannCorrectionCK =
     AcousticStep1stHalf<Inner<OneLevel, AcousticRiemannSolver, LinearCorrectionCK>,
                         Contact<Wall, AcousticRiemannSolver, LinearCorrectionCK>>;
+using AcousticStep1stHalfWithWallRiemannSymmetricCK =
+    AcousticStep1stHalf<Inner<OneLevel, Symmetric, AcousticRiemannSolver, NoKernelCorrectionCK>,
+                        Contact<Wall, AcousticRiemannSolver, NoKernelCorrectionCK>>;
 } // namespace fluid_dynamics
 } // namespace SPH
 #endif // ACOUSTIC_STEP_1ST_HALF_H
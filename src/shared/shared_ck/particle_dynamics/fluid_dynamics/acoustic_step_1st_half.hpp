@@ -88,15 +88,15 @@ void AcousticStep1stHalf<Inner<OneLevel, RiemannSolverType, KernelCorrectionType
 {
     Vecd force = Vecd::Zero();
     Real rho_dissipation(0);
-    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
-    {
-        UnsignedInt index_j = this->neighbor_index_[n];
-        Real dW_ijV_j = this->dW_ij(index_i, index_j) * Vol_[index_j];
-        Vecd e_ij = this->e_ij(index_i, index_j);
+    this->forEachNeighbor(
+        index_i, this->neighbor_index_, this->FirstNeighbor(index_i), this->LastNeighbor(index_i),
+        [&](UnsignedInt index_j, Real dW_ij, const Vecd &e_ij)
+        {
+            Real dW_ijV_j = dW_ij * Vol_[index_j];
 
-        force -= (p_[index_i] * correction_(index_j) + p_[index_j] * correction_(index_i)) * dW_ijV_j * e_ij;
-        rho_dissipation += riemann_solver_.DissipativeUJump(p_[index_i] - p_[index_j]) * dW_ijV_j;
-    }
+            force -= (p_[index_i] * correction_(index_j) + p_[index_j] * correction_(index_i)) * dW_ijV_j * e_ij;
+            rho_dissipation += riemann_solver_.DissipativeUJump(p_[index_i] - p_[index_j]) * dW_ijV_j;
+        });
     force_[index_i] += force * Vol_[index_i];
     drho_dt_[index_i] = rho_dissipation * rho_[index_i];
 }
@@ -118,6 +118,65 @@ void AcousticStep1stHalf<Inner<OneLevel, RiemannSolverType, KernelCorrectionType
 }
 //=================================================================================================//
 template <class RiemannSolverType, class KernelCorrectionType, typename... Parameters>
+AcousticStep1stHalf<Inner<OneLevel, Symmetric, RiemannSolverType, KernelCorrectionType, Parameters...>>::
+    AcousticStep1stHalf(Relation<Inner<Parameters...>> &inner_relation)
+    : AcousticStep1stHalf<Inner<OneLevel, RiemannSolverType, KernelCorrectionType, Parameters...>>(inner_relation),
+      dv_pair_force_(inner_relation.template addPairVariable<Vecd>("AcousticPairForce")),
+      dv_pair_dissipation_(inner_relation.template addPairVariable<Real>("AcousticPairDissipation")) {}
+//=================================================================================================//
+template <class RiemannSolverType, class KernelCorrectionType, typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+AcousticStep1stHalf<Inner<OneLevel, Symmetric, RiemannSolverType, KernelCorrectionType, Parameters...>>::
+    InteractKernel::InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : BaseInteraction::SymmetricInteractKernel(ex_policy, encloser),
+      correction_(ex_policy, encloser.kernel_correction_),
+      riemann_solver_(encloser.riemann_solver_),
+      Vol_(encloser.dv_Vol_->DelegatedData(ex_policy)),
+      rho_(encloser.dv_rho_->DelegatedData(ex_policy)),
+      p_(encloser.dv_p_->DelegatedData(ex_policy)),
+      drho_dt_(encloser.dv_drho_dt_->DelegatedData(ex_policy)),
+      force_(encloser.dv_force_->DelegatedData(ex_policy)),
+      pair_force_(encloser.dv_pair_force_->DelegatedData(ex_policy)),
+      pair_dissipation_(encloser.dv_pair_dissipation_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <class RiemannSolverType, class KernelCorrectionType, typename... Parameters>
+void AcousticStep1stHalf<Inner<OneLevel, Symmetric, RiemannSolverType, KernelCorrectionType, Parameters...>>::
+    InteractKernel::interactPair(size_t index_i)
+{
+    UnsignedInt pair_index = this->FirstHalfNeighbor(index_i);
+    this->forEachNeighbor(
+        index_i, this->half_neighbor_index_, this->FirstHalfNeighbor(index_i), this->LastHalfNeighbor(index_i),
+        [&](UnsignedInt index_j, Real dW_ij, const Vecd &e_ij)
+        {
+            pair_force_[pair_index] = -(p_[index_i] * correction_(index_j) + p_[index_j] * correction_(index_i)) *
+                                      dW_ij * Vol_[index_i] * Vol_[index_j] * e_ij;
+            pair_dissipation_[pair_index] = riemann_solver_.DissipativeUJump(p_[index_i] - p_[index_j]) * dW_ij;
+            pair_index++;
+        });
+}
+//=================================================================================================//
+template <class RiemannSolverType, class KernelCorrectionType, typename... Parameters>
+void AcousticStep1stHalf<Inner<OneLevel, Symmetric, RiemannSolverType, KernelCorrectionType, Parameters...>>::
+    InteractKernel::interact(size_t index_i, Real dt)
+{
+    Vecd force = Vecd::Zero();
+    Real rho_dissipation(0);
+    for (UnsignedInt n = this->FirstHalfNeighbor(index_i); n != this->LastHalfNeighbor(index_i); ++n)
+    {
+        force += pair_force_[n];
+        rho_dissipation += pair_dissipation_[n] * Vol_[this->half_neighbor_index_[n]];
+    }
+    for (UnsignedInt m = this->FirstReversePair(index_i); m != this->LastReversePair(index_i); ++m)
+    {
+        UnsignedInt pair_index = this->reverse_pair_index_[m];
+        force -= pair_force_[pair_index];
+        rho_dissipation -= pair_dissipation_[pair_index] * Vol_[this->reverse_neighbor_index_[m]];
+    }
+    force_[index_i] += force;
+    drho_dt_[index_i] = rho_dissipation * rho_[index_i];
+}
+//=================================================================================================//
+template <class RiemannSolverType, class KernelCorrectionType, typename... Parameters>
 AcousticStep1stHalf<Contact<Wall, RiemannSolverType, KernelCorrectionType, Parameters...>>::
     AcousticStep1stHalf(Relation<Contact<Parameters...>> &wall_contact_relation)
     : AcousticStep<Interaction<Contact<Wall, Parameters...>>>(wall_contact_relation),
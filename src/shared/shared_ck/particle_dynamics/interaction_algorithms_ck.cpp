@@ -29,6 +29,15 @@ void InteractionDynamicsCK<WithInitialization>::runAllSteps(Real dt)
 void InteractionDynamicsCK<OneLevel>::runAllSteps(Real dt)
 {
     runInitializationStep(dt);
+    if (is_fused_ && this->post_processes_.empty())
+    {
+        for (size_t k = 0; k < this->pre_processes_.size(); ++k)
+            this->pre_processes_[k]->exec(dt);
+
+        runFusedInteractionAndUpdate(dt);
+        return;
+    }
+
     InteractionDynamicsCK<Base>::runAllSteps(dt);
     runUpdateStep(dt);
 }
@@ -35,6 +35,27 @@
 
 namespace SPH
 {
+template <class T, class = void>
+struct has_interact_pair : std::false_type
+{
+};
+
+template <class T>
+struct has_interact_pair<T, std::void_t<decltype(&T::interactPair)>> : std::true_type
+{
+};
+
+template <class T, class = void>
+struct allows_fused_update : std::false_type
+{
+};
+
+template <class T>
+struct allows_fused_update<T, std::void_t<decltype(T::allows_fused_update_)>>
+    : std::integral_constant<bool, T::allows_fused_update_>
+{
+};
+
 template <typename...>
 class InteractionDynamicsCK;
 
@@ -55,6 +76,10 @@ class InteractionDynamicsCK<Base>
     virtual void runInteractionStep(Real dt) = 0;
     /** run all interactions step. */
     virtual void runAllSteps(Real dt);
+    /** get the interaction kernels ready before running the interaction step block by block on host */
+    virtual void prepareInteractionBlocks() = 0;
+    /** run the interaction step for a block of particles */
+    virtual void runInteractionBlock(const UnsignedInt *particle_indices, size_t number_of_particles, Real dt) = 0;
 };
 
 template <>
@@ -79,16 +104,27 @@ class InteractionDynamicsCK<WithInitialization> : public InteractionDynamicsCK<B
     virtual void runInitializationStep(Real dt) = 0;
 };
 
+/**
+ * With fused execution, the interactions and the update are carried out block by block
+ * in one sweep on host, while the particle data of a block are still in cache.
+ * This is valid only if the update of a particle does not change data used
+ * by the interactions of other particles. Therefore, a local dynamics allowing fused execution
+ * declares `static constexpr bool allows_fused_update_ = true;`, such as PlasticAcousticStep2ndHalf,
+ * and fused execution is then enabled explicitly by enableFusedUpdate() of the dynamics.
+ * Fused execution is not applied if there are post processes or on device.
+ */
 template <>
 class InteractionDynamicsCK<OneLevel> : public InteractionDynamicsCK<Base>
 {
   public:
-    InteractionDynamicsCK() : InteractionDynamicsCK<Base>(){};
+    InteractionDynamicsCK() : InteractionDynamicsCK<Base>(), is_fused_(false){};
     virtual void runAllSteps(Real dt) override;
 
   protected:
+    bool is_fused_;
     virtual void runInitializationStep(Real dt) = 0;
     virtual void runUpdateStep(Real dt) = 0;
+    virtual void runFusedInteractionAndUpdate(Real dt) = 0;
 };
 
 template <class ExecutionPolicy, template <typename...> class InteractionType, typename... Parameters>
@@ -101,6 +137,8 @@ class InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<Inner<Paramet
     using KernelImplementation = Implementation<ExecutionPolicy, LocalDynamicsType, InteractKernel>;
     KernelImplementation kernel_implementation_;
 
+    InteractKernel *block_interact_kernel_;
+
   public:
     template <typename... Args>
     InteractionDynamicsCK(Args &&...args);
@@ -108,6 +146,11 @@ class InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<Inner<Paramet
 
   protected:
     void runInteraction(Real dt);
+    void prepareInteraction();
+    void runInteraction(const UnsignedInt *particle_indices, size_t number_of_particles, Real dt);
+    /** For symmetric interactions, the pair values are computed for all particles of the body
+     *  before those of a particle are collected, also when running block by block or on a body part. */
+    void runPairInteraction(InteractKernel *interact_kernel);
 };
 
 template <class ExecutionPolicy, template <typename...> class InteractionType, typename... Parameters>
@@ -120,6 +163,7 @@ class InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<Contact<Param
     using KernelImplementation = Implementation<ExecutionPolicy, LocalDynamicsType, InteractKernel>;
     UniquePtrsKeeper<KernelImplementation> contact_kernel_implementation_ptrs_;
     StdVec<KernelImplementation *> contact_kernel_implementation_;
+    StdVec<InteractKernel *> block_interact_kernels_;
 
   public:
     template <typename... Args>
@@ -128,6 +172,8 @@ class InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<Contact<Param
 
   protected:
     void runInteraction(Real dt);
+    void prepareInteraction();
+    void runInteraction(const UnsignedInt *particle_indices, size_t number_of_particles, Real dt);
 };
 
 template <class ExecutionPolicy, template <typename...> class InteractionType,
@@ -145,6 +191,8 @@ class InteractionDynamicsCK<ExecutionPolicy, InteractionType<RelationType<Parame
 
     virtual void exec(Real dt = 0.0) override;
     virtual void runInteractionStep(Real dt = 0.0) override;
+    virtual void prepareInteractionBlocks() override;
+    virtual void runInteractionBlock(const UnsignedInt *particle_indices, size_t number_of_particles, Real dt) override;
 };
 
 template <class ExecutionPolicy, template <typename...> class InteractionType,
@@ -168,6 +216,8 @@ class InteractionDynamicsCK<
     InteractionDynamicsCK(Args &&...args);
     virtual ~InteractionDynamicsCK(){};
     virtual void exec(Real dt = 0.0) override;
+    virtual void prepareInteractionBlocks() override;
+    virtual void runInteractionBlock(const UnsignedInt *particle_indices, size_t number_of_particles, Real dt) override;
 
   protected:
     virtual void runInteractionStep(Real dt = 0.0) override;
@@ -194,17 +244,34 @@ class InteractionDynamicsCK<
 
     InitializeKernelImplementation initialize_kernel_implementation_;
     UpdateKernelImplementation update_kernel_implementation_;
+    static constexpr UnsignedInt fused_block_size_ = 1024;
 
   public:
     template <typename... Args>
     InteractionDynamicsCK(Args &&...args);
     virtual ~InteractionDynamicsCK(){};
     virtual void exec(Real dt = 0.0) override;
+    virtual void prepareInteractionBlocks() override;
+    virtual void runInteractionBlock(const UnsignedInt *particle_indices, size_t number_of_particles, Real dt) override;
+    void enableFusedUpdate()
+    {
+        static_assert(allows_fused_update<LocalDynamicsType>::value,
+                      "The local dynamics does not allow fused interaction and update.");
+        this->is_fused_ = true;
+    };
 
   protected:
     virtual void runInitializationStep(Real dt) override;
     virtual void runInteractionStep(Real dt = 0.0) override;
     virtual void runUpdateStep(Real dt) override;
+    virtual void runFusedInteractionAndUpdate(Real dt) override;
+
+    template <class PolicyType>
+    void runFusedSweep(const PolicyType &ex_policy, Real dt);
+    void runFusedSweep(const SequencedPolicy &seq, Real dt) { runSweepByBlocks(seq, dt); };
+    void runFusedSweep(const ParallelPolicy &par, Real dt) { runSweepByBlocks(par, dt); };
+    template <class HostPolicy>
+    void runSweepByBlocks(const HostPolicy &host_policy, Real dt);
 };
 
 template <class ExecutionPolicy, template <typename...> class InteractionType>
@@ -213,6 +280,8 @@ class InteractionDynamicsCK<ExecutionPolicy, InteractionType<>>
   public:
     InteractionDynamicsCK(){};
     void runInteractionStep(Real dt = 0.0){};
+    void prepareInteractionBlocks(){};
+    void runInteractionBlock(const UnsignedInt *particle_indices, size_t number_of_particles, Real dt){};
 };
 
 template <class ExecutionPolicy, template <typename...> class InteractionType,
@@ -228,6 +297,8 @@ class InteractionDynamicsCK<ExecutionPolicy, InteractionType<FirstInteraction, O
     explicit InteractionDynamicsCK(
         FirstParameterSet &&first_parameter_set, OtherParameterSets &&...other_parameter_sets);
     virtual void runInteractionStep(Real dt = 0.0) override;
+    virtual void prepareInteractionBlocks() override;
+    virtual void runInteractionBlock(const UnsignedInt *particle_indices, size_t number_of_particles, Real dt) override;
 };
 } // namespace SPH
 #endif // INTERACTION_ALGORITHMS_CK_H
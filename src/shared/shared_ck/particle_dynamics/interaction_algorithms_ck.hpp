@@ -11,7 +11,7 @@ template <typename... Args>
 InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<Inner<Parameters...>>>::
     InteractionDynamicsCK(Args &&...args)
     : InteractionType<Inner<Parameters...>>(std::forward<Args>(args)...),
-      kernel_implementation_(*this)
+      kernel_implementation_(*this), block_interact_kernel_(nullptr)
 {
     this->registerComputingKernel(&kernel_implementation_);
 }
@@ -21,12 +21,45 @@ void InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<Inner<Paramete
     runInteraction(Real dt)
 {
     InteractKernel *interact_kernel = kernel_implementation_.getComputingKernel();
+    runPairInteraction(interact_kernel);
     particle_for(LoopRangeCK<ExecutionPolicy, Identifier>(this->identifier_),
                  [=](size_t i)
                  { interact_kernel->interact(i, dt); });
 }
 //=================================================================================================//
 template <class ExecutionPolicy, template <typename...> class InteractionType, typename... Parameters>
+void InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<Inner<Parameters...>>>::
+    prepareInteraction()
+{
+    block_interact_kernel_ = kernel_implementation_.getComputingKernel();
+    runPairInteraction(block_interact_kernel_);
+}
+//=================================================================================================//
+template <class ExecutionPolicy, template <typename...> class InteractionType, typename... Parameters>
+void InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<Inner<Parameters...>>>::
+    runPairInteraction(InteractKernel *interact_kernel)
+{
+    if constexpr (has_interact_pair<InteractKernel>::value)
+    {
+        // The pair values are computed for the whole body, as the particles of a body part
+        // also collect the values of pairs whose first particle is outside of the part.
+        particle_for(LoopRangeCK<ExecutionPolicy, SPHBody>(this->sph_body_),
+                     [=](size_t i)
+                     { interact_kernel->interactPair(i); });
+    }
+}
+//=================================================================================================//
+template <class ExecutionPolicy, template <typename...> class InteractionType, typename... Parameters>
+void InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<Inner<Parameters...>>>::
+    runInteraction(const UnsignedInt *particle_indices, size_t number_of_particles, Real dt)
+{
+    for (size_t n = 0; n != number_of_particles; ++n)
+    {
+        block_interact_kernel_->interact(particle_indices[n], dt);
+    }
+}
+//=================================================================================================//
+template <class ExecutionPolicy, template <typename...> class InteractionType, typename... Parameters>
 template <typename... Args>
 InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<Contact<Parameters...>>>::
     InteractionDynamicsCK(Args &&...args)
@@ -56,6 +89,31 @@ void InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<Contact<Parame
     }
 }
 //=================================================================================================//
+template <class ExecutionPolicy, template <typename...> class InteractionType, typename... Parameters>
+void InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<Contact<Parameters...>>>::
+    prepareInteraction()
+{
+    block_interact_kernels_.clear();
+    for (size_t k = 0; k != this->contact_bodies_.size(); ++k)
+    {
+        block_interact_kernels_.push_back(contact_kernel_implementation_[k]->getComputingKernel(k));
+    }
+}
+//=================================================================================================//
+template <class ExecutionPolicy, template <typename...> class InteractionType, typename... Parameters>
+void InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<Contact<Parameters...>>>::
+    runInteraction(const UnsignedInt *particle_indices, size_t number_of_particles, Real dt)
+{
+    for (size_t k = 0; k != block_interact_kernels_.size(); ++k)
+    {
+        InteractKernel *interact_kernel = block_interact_kernels_[k];
+        for (size_t n = 0; n != number_of_particles; ++n)
+        {
+            interact_kernel->interact(particle_indices[n], dt);
+        }
+    }
+}
+//=================================================================================================//
 template <class ExecutionPolicy, template <typename...> class InteractionType,
           template <typename...> class RelationType, typename... Parameters>
 template <typename... Args>
@@ -71,6 +129,7 @@ template <class ExecutionPolicy, template <typename...> class InteractionType,
 void InteractionDynamicsCK<ExecutionPolicy, InteractionType<RelationType<Parameters...>>>::
     exec(Real dt)
 {
+    ProfilingScope profiling_scope(ExecutionPolicy{}, this->profilingRecord(this->getSPHBody()), this->identifier_.SizeOfLoopRange());
     this->setUpdated(this->identifier_.getSPHBody());
     this->setupDynamics(dt);
     InteractionDynamicsCK<Base>::runAllSteps(dt);
@@ -84,6 +143,22 @@ void InteractionDynamicsCK<ExecutionPolicy, InteractionType<RelationType<Paramet
     this->runInteraction(dt);
 }
 //=================================================================================================//
+template <class ExecutionPolicy, template <typename...> class InteractionType,
+          template <typename...> class RelationType, typename... Parameters>
+void InteractionDynamicsCK<ExecutionPolicy, InteractionType<RelationType<Parameters...>>>::
+    prepareInteractionBlocks()
+{
+    this->prepareInteraction();
+}
+//=================================================================================================//
+template <class ExecutionPolicy, template <typename...> class InteractionType,
+          template <typename...> class RelationType, typename... Parameters>
+void InteractionDynamicsCK<ExecutionPolicy, InteractionType<RelationType<Parameters...>>>::
+    runInteractionBlock(const UnsignedInt *particle_indices, size_t number_of_particles, Real dt)
+{
+    this->runInteraction(particle_indices, number_of_particles, dt);
+}
+//=================================================================================================//
 template <class ExecutionPolicy, template <typename...> class InteractionType,
           template <typename...> class RelationType, typename... OtherParameters>
 template <typename... Args>
@@ -101,6 +176,7 @@ template <class ExecutionPolicy, template <typename...> class InteractionType,
 void InteractionDynamicsCK<ExecutionPolicy, InteractionType<RelationType<WithUpdate, OtherParameters...>>>::
     exec(Real dt)
 {
+    ProfilingScope profiling_scope(ExecutionPolicy{}, this->profilingRecord(this->getSPHBody()), this->identifier_.SizeOfLoopRange());
     this->setUpdated(this->identifier_.getSPHBody());
     this->setupDynamics(dt);
     InteractionDynamicsCK<WithUpdate>::runAllSteps(dt);
@@ -114,6 +190,22 @@ void InteractionDynamicsCK<ExecutionPolicy, InteractionType<RelationType<WithUpd
     this->runInteraction(dt);
 }
 //=================================================================================================//
+template <class ExecutionPolicy, template <typename...> class InteractionType,
+          template <typename...> class RelationType, typename... OtherParameters>
+void InteractionDynamicsCK<ExecutionPolicy, InteractionType<RelationType<WithUpdate, OtherParameters...>>>::
+    prepareInteractionBlocks()
+{
+    this->prepareInteraction();
+}
+//=================================================================================================//
+template <class ExecutionPolicy, template <typename...> class InteractionType,
+          template <typename...> class RelationType, typename... OtherParameters>
+void InteractionDynamicsCK<ExecutionPolicy, InteractionType<RelationType<WithUpdate, OtherParameters...>>>::
+    runInteractionBlock(const UnsignedInt *particle_indices, size_t number_of_particles, Real dt)
+{
+    this->runInteraction(particle_indices, number_of_particles, dt);
+}
+//=================================================================================================//
 template <class ExecutionPolicy, template <typename...> class InteractionType,
           template <typename...> class RelationType, typename... OtherParameters>
 void InteractionDynamicsCK<ExecutionPolicy, InteractionType<RelationType<WithUpdate, OtherParameters...>>>::
@@ -140,6 +232,7 @@ template <class ExecutionPolicy, template <typename...> class InteractionType,
 void InteractionDynamicsCK<ExecutionPolicy, InteractionType<RelationType<OneLevel, OtherParameters...>>>::
     exec(Real dt)
 {
+    ProfilingScope profiling_scope(ExecutionPolicy{}, this->profilingRecord(this->getSPHBody()), this->identifier_.SizeOfLoopRange());
     this->setUpdated(this->identifier_.getSPHBody());
     this->setupDynamics(dt);
     InteractionDynamicsCK<OneLevel>::runAllSteps(dt);
@@ -153,6 +246,87 @@ void InteractionDynamicsCK<ExecutionPolicy, InteractionType<RelationType<OneLeve
     this->runInteraction(dt);
 }
 //=================================================================================================//
+template <class ExecutionPolicy, template <typename...> class InteractionType,
+          template <typename...> class RelationType, typename... OtherParameters>
+void InteractionDynamicsCK<ExecutionPolicy, InteractionType<RelationType<OneLevel, OtherParameters...>>>::
+    prepareInteractionBlocks()
+{
+    this->prepareInteraction();
+}
+//=================================================================================================//
+template <class ExecutionPolicy, template <typename...> class InteractionType,
+          template <typename...> class RelationType, typename... OtherParameters>
+void InteractionDynamicsCK<ExecutionPolicy, InteractionType<RelationType<OneLevel, OtherParameters...>>>::
+    runInteractionBlock(const UnsignedInt *particle_indices, size_t number_of_particles, Real dt)
+{
+    this->runInteraction(particle_indices, number_of_particles, dt);
+}
+//=================================================================================================//
+template <class ExecutionPolicy, template <typename...> class InteractionType,
+          template <typename...> class RelationType, typename... OtherParameters>
+void InteractionDynamicsCK<ExecutionPolicy, InteractionType<RelationType<OneLevel, OtherParameters...>>>::
+    runFusedInteractionAndUpdate(Real dt)
+{
+    runFusedSweep(ExecutionPolicy{}, dt);
+}
+//=================================================================================================//
+template <class ExecutionPolicy, template <typename...> class InteractionType,
+          template <typename...> class RelationType, typename... OtherParameters>
+template <class PolicyType>
+void InteractionDynamicsCK<ExecutionPolicy, InteractionType<RelationType<OneLevel, OtherParameters...>>>::
+    runFusedSweep(const PolicyType &ex_policy, Real dt)
+{
+    // no fused sweep on device, the steps are carried out one after another
+    this->runInteractionStep(dt);
+    runUpdateStep(dt);
+}
+//=================================================================================================//
+template <class ExecutionPolicy, template <typename...> class InteractionType,
+          template <typename...> class RelationType, typename... OtherParameters>
+template <class HostPolicy>
+void InteractionDynamicsCK<ExecutionPolicy, InteractionType<RelationType<OneLevel, OtherParameters...>>>::
+    runSweepByBlocks(const HostPolicy &host_policy, Real dt)
+{
+    this->prepareInteractionBlocks();
+    UpdateKernel *update_kernel = update_kernel_implementation_.getComputingKernel();
+    LoopRangeCK<ExecutionPolicy, Identifier> loop_range(this->identifier_);
+    UnsignedInt number_of_units = loop_range.LoopBound();
+    UnsignedInt number_of_blocks = (number_of_units + fused_block_size_ - 1) / fused_block_size_;
+
+    particle_for(host_policy, IndexRange(0, number_of_blocks),
+                 [&](size_t block)
+                 {
+                     // a body part may give several particles per loop unit,
+                     // the buffer is therefore flushed whenever it is full
+                     std::array<UnsignedInt, fused_block_size_> particle_indices;
+                     size_t number_of_particles = 0;
+                     auto run_block = [&]()
+                     {
+                         this->runInteractionBlock(particle_indices.data(), number_of_particles, dt);
+                         for (size_t n = 0; n != number_of_particles; ++n)
+                         {
+                             update_kernel->update(particle_indices[n], dt);
+                         }
+                         number_of_particles = 0;
+                     };
+
+                     UnsignedInt unit_begin = block * fused_block_size_;
+                     UnsignedInt unit_end = SMIN(unit_begin + fused_block_size_, number_of_units);
+                     for (UnsignedInt i = unit_begin; i != unit_end; ++i)
+                     {
+                         loop_range.computeUnit(
+                             [&](size_t index_i)
+                             {
+                                 particle_indices[number_of_particles++] = index_i;
+                                 if (number_of_particles == fused_block_size_)
+                                     run_block();
+                             },
+                             i);
+                     }
+                     run_block();
+                 });
+}
+//=================================================================================================//
 template <class ExecutionPolicy, template <typename...> class InteractionType,
           template <typename...> class RelationType, typename... OtherParameters>
 void InteractionDynamicsCK<ExecutionPolicy, InteractionType<RelationType<OneLevel, OtherParameters...>>>::
@@ -193,5 +367,24 @@ void InteractionDynamicsCK<ExecutionPolicy, InteractionType<FirstInteraction, Ot
     other_interactions_.runInteractionStep(dt);
 }
 //=================================================================================================//
+template <class ExecutionPolicy, template <typename...> class InteractionType,
+          class FirstInteraction, class... Others>
+void InteractionDynamicsCK<ExecutionPolicy, InteractionType<FirstInteraction, Others...>>::
+    prepareInteractionBlocks()
+{
+    InteractionDynamicsCK<ExecutionPolicy, InteractionType<FirstInteraction>>::prepareInteractionBlocks();
+    other_interactions_.prepareInteractionBlocks();
+}
+//=================================================================================================//
+template <class ExecutionPolicy, template <typename...> class InteractionType,
+          class FirstInteraction, class... Others>
+void InteractionDynamicsCK<ExecutionPolicy, InteractionType<FirstInteraction, Others...>>::
+    runInteractionBlock(const UnsignedInt *particle_indices, size_t number_of_particles, Real dt)
+{
+    InteractionDynamicsCK<ExecutionPolicy, InteractionType<FirstInteraction>>::runInteractionBlock(
+        particle_indices, number_of_particles, dt);
+    other_interactions_.runInteractionBlock(particle_indices, number_of_particles, dt);
+}
+//=================================================================================================//
 } // namespace SPH
 #endif // INTERACTION_ALGORITHMS_CK_HPP
@@ -40,6 +40,7 @@ class WithUpdate;
 class WithInitialization;
 class OneLevel;
 class InteractionOnly;
+class Symmetric; /**< Interaction evaluating each pair once with the half neighbor list */
 
 template <typename... T>
 class Interaction;
@@ -60,6 +61,16 @@ class Interaction<Inner<Parameters...>> : public LocalDynamics
                        Interaction<Inner<Parameters...>> &encloser);
     };
 
+    /** Interaction kernel with the half neighbor list, for which the pair values
+     *  are computed in interactPair and collected for each particle in interact. */
+    class SymmetricInteractKernel : public InteractKernel, public HalfNeighborList
+    {
+      public:
+        template <class ExecutionPolicy>
+        SymmetricInteractKernel(const ExecutionPolicy &ex_policy,
+                                Interaction<Inner<Parameters...>> &encloser);
+    };
+
     void registerComputingKernel(Implementation<Base> *implementation);
     void resetComputingKernelUpdated();
 
@@ -37,6 +37,18 @@ Interaction<Inner<Parameters...>>::InteractKernel::
     : NeighborList(ex_policy, encloser.dv_neighbor_index_, encloser.dv_particle_offset_),
       Neighbor<Parameters...>(ex_policy, encloser.sph_adaptation_, encloser.dv_pos_) {}
 //=================================================================================================//
+template <typename... Parameters>
+template <class ExecutionPolicy>
+Interaction<Inner<Parameters...>>::SymmetricInteractKernel::
+    SymmetricInteractKernel(const ExecutionPolicy &ex_policy,
+                            Interaction<Inner<Parameters...>> &encloser)
+    : InteractKernel(ex_policy, encloser),
+      HalfNeighborList(ex_policy, encloser.inner_relation_.getHalfNeighborIndex(),
+                       encloser.inner_relation_.getHalfParticleOffset(),
+                       encloser.inner_relation_.getReverseNeighborIndex(),
+                       encloser.inner_relation_.getReversePairIndex(),
+                       encloser.inner_relation_.getReversePairOffset()) {}
+//=================================================================================================//
 template <class SourceIdentifier, class TargetIdentifier, typename... Parameters>
 Interaction<Contact<SourceIdentifier, TargetIdentifier, Parameters...>>::
     Interaction(Relation<Contact<SourceIdentifier, TargetIdentifier, Parameters...>> &contact_relation)
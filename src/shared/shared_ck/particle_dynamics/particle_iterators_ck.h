@@ -62,6 +62,34 @@ void particle_for(const LoopRangeCK<ParallelPolicy, DynamicsIdentifier> &loop_ra
         ap);
 };
 
+template <class DynamicsIdentifier, class UnaryFunc>
+void particle_for(const LoopRangeCK<UnsequencedPolicy, DynamicsIdentifier> &loop_range,
+                  const UnaryFunc &unary_func)
+{
+    UnsignedInt loop_bound = loop_range.LoopBound();
+    SPH_SIMD_LOOP
+    for (UnsignedInt i = 0; i < loop_bound; ++i)
+        loop_range.computeUnit(unary_func, i);
+};
+
+template <class DynamicsIdentifier, class UnaryFunc>
+void particle_for(const LoopRangeCK<ParallelUnsequencedPolicy, DynamicsIdentifier> &loop_range,
+                  const UnaryFunc &unary_func)
+{
+    parallel_for(
+        IndexRange(0, loop_range.LoopBound()),
+        [&](const IndexRange &r)
+        {
+            UnsignedInt end = r.end();
+            SPH_SIMD_LOOP
+            for (UnsignedInt i = r.begin(); i < end; ++i)
+            {
+                loop_range.computeUnit(unary_func, i);
+            }
+        },
+        ap);
+};
+
 template <typename Operation, class DynamicsIdentifier, class ReturnType, class UnaryFunc>
 ReturnType particle_reduce(const LoopRangeCK<SequencedPolicy, DynamicsIdentifier> &loop_range,
                            ReturnType temp, const UnaryFunc &unary_func)
@@ -94,6 +122,41 @@ ReturnType particle_reduce(const LoopRangeCK<ParallelPolicy, DynamicsIdentifier>
         });
 };
 
+template <typename Operation, class DynamicsIdentifier, class ReturnType, class UnaryFunc>
+ReturnType particle_reduce(const LoopRangeCK<UnsequencedPolicy, DynamicsIdentifier> &loop_range,
+                           ReturnType temp, const UnaryFunc &unary_func)
+{
+    // the reduction is left to the compiler, as the operation is not known to be a simd reduction
+    Operation operation;
+    UnsignedInt loop_bound = loop_range.LoopBound();
+    for (UnsignedInt i = 0; i < loop_bound; ++i)
+    {
+        temp = operation(temp, loop_range.template computeUnit<ReturnType>(operation, unary_func, i));
+    }
+    return temp;
+}
+
+template <typename Operation, class DynamicsIdentifier, class ReturnType, class UnaryFunc>
+ReturnType particle_reduce(const LoopRangeCK<ParallelUnsequencedPolicy, DynamicsIdentifier> &loop_range,
+                           ReturnType temp, const UnaryFunc &unary_func)
+{
+    Operation operation;
+    return parallel_reduce(
+        IndexRange(0, loop_range.LoopBound()),
+        temp, [&](const IndexRange &r, ReturnType temp0) -> ReturnType
+        {
+            UnsignedInt end = r.end();
+            for (UnsignedInt i = r.begin(); i < end; ++i)
+            {
+                temp0 = operation(temp0, loop_range.template computeUnit<ReturnType>(operation, unary_func, i));
+            }
+            return temp0; },
+        [&](const ReturnType &x, const ReturnType &y) -> ReturnType
+        {
+            return operation(x, y);
+        });
+};
+
 template <typename T, typename Op>
 T exclusive_scan(const SequencedPolicy &seq_policy, T *first, T *d_first, UnsignedInt d_size, Op op)
 {
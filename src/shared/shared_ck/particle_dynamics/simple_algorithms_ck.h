@@ -56,6 +56,7 @@ class StateDynamics : public UpdateType, public BaseDynamics<void>
 
     virtual void exec(Real dt = 0.0) override
     {
+        ProfilingScope profiling_scope(ExecutionPolicy{}, this->profilingRecord(this->getSPHBody()), this->identifier_.SizeOfLoopRange());
         this->setUpdated(this->identifier_.getSPHBody());
         this->setupDynamics(dt);
         UpdateKernel *update_kernel = kernel_implementation_.getComputingKernel();
@@ -92,6 +93,7 @@ class ReduceDynamicsCK : public ReduceType,
 
     virtual OutputType exec(Real dt = 0.0) override
     {
+        ProfilingScope profiling_scope(ExecutionPolicy{}, this->profilingRecord(this->getSPHBody()), this->identifier_.SizeOfLoopRange());
         this->setupDynamics(dt);
         ReduceKernel *reduce_kernel = kernel_implementation_.getComputingKernel();
         ReduceReturnType temp = particle_reduce<Operation>(
@@ -102,5 +104,80 @@ class ReduceDynamicsCK : public ReduceType,
         return finish_dynamics_.Result(temp);
     };
 };
+
+/**
+ * @class FusedReduceDynamicsCK
+ * @brief Evaluate several reduce dynamics on the same loop range in one sweep.
+ * @details The partial results are reduced together as a tuple,
+ * so that the particle data used by several reductions are streamed only once.
+ * The reduce dynamics keep their own parameters and their results are given
+ * by their own finish dynamics, in the order of the template arguments.
+ * Only host execution policies are supported, as the tuple of partial results
+ * is not a type for which device reductions are available.
+ */
+template <class ExecutionPolicy, class FirstReduceType, class... OtherReduceTypes>
+class FusedReduceDynamicsCK
+    : public BaseDynamics<std::tuple<typename FirstReduceType::FinishDynamics::OutputType,
+                                     typename OtherReduceTypes::FinishDynamics::OutputType...>>
+{
+    static_assert(!std::is_base_of<execution::DeviceExecution<>, ExecutionPolicy>::value,
+                  "FusedReduceDynamicsCK is not available for device execution policies.");
+    using Identifier = typename FirstReduceType::Identifier;
+    using Operation = ReduceTuple<typename FirstReduceType::OperationType,
+                                  typename OtherReduceTypes::OperationType...>;
+    using ReduceReturnType = typename Operation::ReturnType;
+    using OutputType = std::tuple<typename FirstReduceType::FinishDynamics::OutputType,
+                                  typename OtherReduceTypes::FinishDynamics::OutputType...>;
+    using ReduceKernels = std::tuple<typename FirstReduceType::ReduceKernel *,
+                                     typename OtherReduceTypes::ReduceKernel *...>;
+    template <class ReduceType>
+    using KernelImplementation = Implementation<ExecutionPolicy, ReduceType, typename ReduceType::ReduceKernel>;
+    static constexpr std::size_t number_of_reductions_ = 1 + sizeof...(OtherReduceTypes);
+
+    FirstReduceType &first_reduce_type_;
+    std::tuple<FirstReduceType &, OtherReduceTypes &...> reduce_types_;
+    std::tuple<KernelImplementation<FirstReduceType>, KernelImplementation<OtherReduceTypes>...> kernel_implementations_;
+    std::tuple<typename FirstReduceType::FinishDynamics, typename OtherReduceTypes::FinishDynamics...> finish_dynamics_;
+
+  public:
+    FusedReduceDynamicsCK(FirstReduceType &first_reduce_type, OtherReduceTypes &...other_reduce_types)
+        : BaseDynamics<OutputType>(), first_reduce_type_(first_reduce_type),
+          reduce_types_(first_reduce_type, other_reduce_types...),
+          kernel_implementations_(first_reduce_type, other_reduce_types...),
+          finish_dynamics_(first_reduce_type, other_reduce_types...)
+    {
+        bool is_same_range = ((static_cast<void *>(&other_reduce_types.getDynamicsIdentifier()) ==
+                               static_cast<void *>(&first_reduce_type.getDynamicsIdentifier())) &&
+                              ...);
+        if (!is_same_range)
+        {
+            std::cout << "\n Error: the fused reduce dynamics are not defined on the same body or body part!" << std::endl;
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            exit(1);
+        }
+    };
+    virtual ~FusedReduceDynamicsCK() {};
+
+    virtual OutputType exec(Real dt = 0.0) override
+    {
+        return execInSequence(dt, std::make_index_sequence<number_of_reductions_>{});
+    };
+
+  protected:
+    template <std::size_t... Is>
+    OutputType execInSequence(Real dt, std::index_sequence<Is...>)
+    {
+        Identifier &identifier = first_reduce_type_.getDynamicsIdentifier();
+        ProfilingScope profiling_scope(ExecutionPolicy{}, this->profilingRecord(first_reduce_type_.getSPHBody()), identifier.SizeOfLoopRange());
+        (std::get<Is>(reduce_types_).setupDynamics(dt), ...);
+        ReduceKernels reduce_kernels(std::get<Is>(kernel_implementations_).getComputingKernel()...);
+        ReduceReturnType temp = particle_reduce<Operation>(
+            LoopRangeCK<ExecutionPolicy, Identifier>(identifier),
+            ReduceReference<Operation>::value,
+            [=](size_t i)
+            { return ReduceReturnType(std::get<Is>(reduce_kernels)->reduce(i, dt)...); });
+        return OutputType(std::get<Is>(finish_dynamics_).Result(std::get<Is>(temp))...);
+    };
+};
 } // namespace SPH
 #endif // SIMPLE_ALGORITHMS_CK_H
@@ -0,0 +1,124 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	base_kernel_ck.h
+ * @brief 	This is the class template for the kernels used in computing kernels,
+ *          which are given by the dimensionless kernel functions.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef BASE_KERNEL_CK_H
+#define BASE_KERNEL_CK_H
+
+#include "base_kernel.h"
+#include "execution_policy.h"
+
+namespace SPH
+{
+/**
+ * @class KernelCK
+ * @brief The kernel constructed from a kernel of the same original name.
+ * The kernel function provides the original kernel name
+ * and the dimensionless kernel W_1D and its derivative dW_1D,
+ * which are scaled by the factors of the original kernel.
+ */
+template <class KernelFunction>
+class KernelCK : public KernelFunction
+{
+  public:
+    explicit KernelCK(Kernel &kernel)
+    {
+        inv_h_ = 1.0 / kernel.SmoothingLength();
+        factor_W_1D_ = kernel.FactorW1D();
+        factor_W_2D_ = kernel.FactorW2D();
+        factor_W_3D_ = kernel.FactorW3D();
+        factor_dW_1D_ = inv_h_ * factor_W_1D_;
+        factor_dW_2D_ = inv_h_ * factor_W_2D_;
+        factor_dW_3D_ = inv_h_ * factor_W_3D_;
+        rc_ref_ = kernel.CutOffRadius();
+        rc_ref_sqr_ = kernel.CutOffRadiusSqr();
+    };
+
+    Real W(const Real &displacement) const
+    {
+        Real q = displacement * inv_h_;
+        return factor_W_1D_ * KernelFunction::W_1D(q);
+    };
+
+    Real W(const Vec2d &displacement) const
+    {
+        Real q = displacement.norm() * inv_h_;
+        return factor_W_2D_ * KernelFunction::W_1D(q);
+    };
+
+    Real W(const Vec3d &displacement) const
+    {
+        Real q = displacement.norm() * inv_h_;
+        return factor_W_3D_ * KernelFunction::W_1D(q);
+    };
+
+    Real dW(const Real &displacement) const
+    {
+        Real q = displacement * inv_h_;
+        return factor_dW_1D_ * KernelFunction::dW_1D(q);
+    };
+    Real dW(const Vec2d &displacement) const
+    {
+        Real q = displacement.norm() * inv_h_;
+        return factor_dW_2D_ * KernelFunction::dW_1D(q);
+    };
+    Real dW(const Vec3d &displacement) const
+    {
+        Real q = displacement.norm() * inv_h_;
+        return factor_dW_3D_ * KernelFunction::dW_1D(q);
+    };
+
+    Vec2d e(const Real &distance, const Vec2d &displacement) const
+    {
+        return displacement / (distance + TinyReal);
+    };
+    Vec3d e(const Real &distance, const Vec3d &displacement) const
+    {
+        return displacement / (distance + TinyReal);
+    };
+
+    bool checkIfWithinCutOffRadius(const Vec2d &displacement) const
+    {
+        return displacement.squaredNorm() < CutOffRadiusSqr();
+    };
+
+    bool checkIfWithinCutOffRadius(const Vec3d &displacement) const
+    {
+        return displacement.squaredNorm() < CutOffRadiusSqr();
+    };
+
+    inline Real CutOffRadius() const { return rc_ref_; };
+    inline Real CutOffRadiusSqr() const { return rc_ref_sqr_; };
+
+  private:
+    Real inv_h_, rc_ref_, rc_ref_sqr_,
+        factor_W_1D_, factor_W_2D_, factor_W_3D_,
+        factor_dW_1D_, factor_dW_2D_, factor_dW_3D_;
+};
+} // namespace SPH
+#endif // BASE_KERNEL_CK_H
@@ -0,0 +1,56 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	kernel_cubic_B_spline_ck.h
+ * @brief 	This is the cubic B-spline kernel used in computing kernels.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef KERNEL_CUBIC_B_SPLINE_CK_H
+#define KERNEL_CUBIC_B_SPLINE_CK_H
+
+#include "base_kernel_ck.h"
+
+namespace SPH
+{
+struct CubicBSplineFunction
+{
+    /** name of the kernel from which this one is constructed */
+    static std::string OriginalKernelName() { return "CubicBSpline"; };
+
+    static Real W_1D(Real q)
+    {
+        return q < 1.0 ? 1.0 - 1.5 * q * q * (1.0 - 0.5 * q)
+               : (q < 2.0 ? 0.25 * pow(2.0 - q, 3) : 0.0);
+    };
+
+    static Real dW_1D(Real q)
+    {
+        return q < 1.0 ? 2.25 * q * q - 3.0 * q
+               : (q < 2.0 ? -0.75 * pow(2.0 - q, 2) : 0.0);
+    };
+};
+
+using KernelCubicBSplineCK = KernelCK<CubicBSplineFunction>;
+} // namespace SPH
+#endif // KERNEL_CUBIC_B_SPLINE_CK_H
@@ -0,0 +1,54 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	kernel_laguerre_gauss_ck.h
+ * @brief 	This is the Laguerre-Gauss kernel used in computing kernels.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef KERNEL_LAGUERRE_GAUSS_CK_H
+#define KERNEL_LAGUERRE_GAUSS_CK_H
+
+#include "base_kernel_ck.h"
+
+namespace SPH
+{
+struct LaguerreGaussFunction
+{
+    /** name of the kernel from which this one is constructed */
+    static std::string OriginalKernelName() { return "LaguerreGauss"; };
+
+    static Real W_1D(Real q)
+    {
+        return q < 2.0 ? (1.0 - q * q + pow(q, 4) / 6.0) * exp(-q * q) : 0.0;
+    };
+
+    static Real dW_1D(Real q)
+    {
+        return q < 2.0 ? (-pow(q, 5) / 3.0 + 8.0 * pow(q, 3) / 3.0 - 4.0 * q) * exp(-q * q) : 0.0;
+    };
+};
+
+using KernelLaguerreGaussCK = KernelCK<LaguerreGaussFunction>;
+} // namespace SPH
+#endif // KERNEL_LAGUERRE_GAUSS_CK_H
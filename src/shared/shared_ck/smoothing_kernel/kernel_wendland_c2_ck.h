@@ -30,6 +30,7 @@
 #define KERNEL_WENDLAND_C2_CK_H
 
 #include "base_kernel.h"
+#include "execution_policy.h"
 
 namespace SPH
 {
@@ -48,6 +49,8 @@ class KernelWendlandC2CK
         rc_ref_ = kernel.CutOffRadius();
         rc_ref_sqr_ = kernel.CutOffRadiusSqr();
     };
+    /** name of the kernel from which this one is constructed */
+    static std::string OriginalKernelName() { return "Wendland2CKernel"; };
 
     Real W(const Real &displacement) const
     {
@@ -115,6 +118,46 @@ class KernelWendlandC2CK
     };
     ;
 
+    /** number of neighbors evaluated together by the batched functions */
+    static constexpr UnsignedInt BatchSize = 8;
+
+    /** W for a batch of displacements stored by components, so that the loop is vectorized. */
+    void W(const Real (&displacement)[Dimensions][BatchSize], Real (&W_batch)[BatchSize]) const
+    {
+        Real factor_W = Dimensions == 2 ? factor_W_2D_ : factor_W_3D_;
+        SPH_SIMD_LOOP
+        for (UnsignedInt k = 0; k < BatchSize; ++k)
+        {
+            Real distance_sqr(0);
+            for (int d = 0; d != Dimensions; ++d)
+                distance_sqr += displacement[d][k] * displacement[d][k];
+            Real q = sqrt(distance_sqr) * inv_h_;
+            Real s = SMAX(Real(1.0 - 0.5 * q), Real(0)); // branchless cut-off
+            W_batch[k] = factor_W * s * s * s * s * (1.0 + 2.0 * q);
+        }
+    };
+
+    /** dW and unit vector e for a batch of displacements stored by components, so that the loop is vectorized. */
+    void dW_e(const Real (&displacement)[Dimensions][BatchSize],
+              Real (&dW_batch)[BatchSize], Real (&e_batch)[Dimensions][BatchSize]) const
+    {
+        Real factor_dW = Dimensions == 2 ? factor_dW_2D_ : factor_dW_3D_;
+        SPH_SIMD_LOOP
+        for (UnsignedInt k = 0; k < BatchSize; ++k)
+        {
+            Real distance_sqr(0);
+            for (int d = 0; d != Dimensions; ++d)
+                distance_sqr += displacement[d][k] * displacement[d][k];
+            Real distance = sqrt(distance_sqr);
+            Real q = distance * inv_h_;
+            Real s = SMIN(Real(q - 2.0), Real(0)); // branchless cut-off
+            dW_batch[k] = factor_dW * 0.625 * s * s * s * q;
+            Real inv_distance = 1.0 / (distance + TinyReal);
+            for (int d = 0; d != Dimensions; ++d)
+                e_batch[d][k] = displacement[d][k] * inv_distance;
+        }
+    };
+
     inline Real CutOffRadius() const { return rc_ref_; };
     inline Real CutOffRadiusSqr() const { return rc_ref_sqr_; };
 
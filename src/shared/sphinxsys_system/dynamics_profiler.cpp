@@ -0,0 +1,157 @@
+#include "dynamics_profiler.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+
+#ifdef __GNUG__
+#include <cxxabi.h>
+#endif
+
+#if SPHINXSYS_USE_SYCL
+#include "implementation_sycl.h"
+#endif
+
+namespace SPH
+{
+//=================================================================================================//
+ProfilingScope::ProfilingScope(ProfilingRecord *record, size_t number_of_particles)
+    : record_(record), number_of_particles_(number_of_particles), is_device_(false)
+{
+    start();
+}
+//=================================================================================================//
+void ProfilingScope::start()
+{
+    if (record_ != nullptr)
+    {
+        if (record_->is_running_)
+        {
+            record_ = nullptr;
+            return;
+        }
+        record_->is_running_ = true;
+        waitForDevice();
+        start_ = TickCount::now();
+    }
+}
+//=================================================================================================//
+void ProfilingScope::waitForDevice()
+{
+#if SPHINXSYS_USE_SYCL
+    if (is_device_)
+    {
+        execution::execution_instance.getQueue().wait_and_throw();
+    }
+#endif
+}
+//=================================================================================================//
+ProfilingScope::~ProfilingScope()
+{
+    if (record_ != nullptr)
+    {
+        waitForDevice();
+        Real time = (TickCount::now() - start_).seconds();
+        record_->calls_++;
+        record_->total_time_ += time;
+        record_->max_time_ = SMAX(record_->max_time_, time);
+        record_->total_particles_ += number_of_particles_;
+        record_->is_running_ = false;
+    }
+}
+//=================================================================================================//
+ProfilingRecord *DynamicsProfiler::getRecord(const std::string &name)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (ProfilingRecord *record : records_)
+    {
+        if (record->name_ == name)
+            return record;
+    }
+    records_.push_back(record_ptrs_.createPtr<ProfilingRecord>(name));
+    return records_.back();
+}
+//=================================================================================================//
+StdVec<ProfilingRecord *> DynamicsProfiler::sortedRecords()
+{
+    StdVec<ProfilingRecord *> sorted_records = records_;
+    std::stable_sort(sorted_records.begin(), sorted_records.end(),
+                     [](ProfilingRecord *a, ProfilingRecord *b)
+                     { return a->total_time_ > b->total_time_; });
+    return sorted_records;
+}
+//=================================================================================================//
+void DynamicsProfiler::writeReport(std::ostream &output_stream)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::ios_base::fmtflags flags = output_stream.flags();
+    std::streamsize precision = output_stream.precision();
+    output_stream << "\n Profiling of dynamics (inclusive times in seconds):\n";
+    output_stream << std::setw(12) << "total" << std::setw(12) << "max" << std::setw(10) << "calls"
+                  << std::setw(16) << "particles/s" << "   name\n";
+    for (ProfilingRecord *record : sortedRecords())
+    {
+        Real throughput = record->total_time_ > 0.0 ? Real(record->total_particles_) / record->total_time_ : 0.0;
+        output_stream << std::fixed << std::setprecision(4)
+                      << std::setw(12) << record->total_time_ << std::setw(12) << record->max_time_
+                      << std::setw(10) << record->calls_
+                      << std::scientific << std::setprecision(3) << std::setw(16) << throughput
+                      << "   " << record->name_ << "\n";
+    }
+    output_stream.flags(flags);
+    output_stream.precision(precision);
+}
+//=================================================================================================//
+void DynamicsProfiler::writeJsonReport(const std::string &filefullpath)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto escaped = [](const std::string &input)
+    {
+        std::string output;
+        for (char c : input)
+        {
+            if (c == '"' || c == '\\')
+                output += '\\';
+            output += c;
+        }
+        return output;
+    };
+
+    std::ofstream out_file(filefullpath.c_str(), std::ios::trunc);
+    out_file << "[\n";
+    StdVec<ProfilingRecord *> sorted_records = sortedRecords();
+    for (size_t i = 0; i != sorted_records.size(); ++i)
+    {
+        ProfilingRecord *record = sorted_records[i];
+        out_file << std::setprecision(9)
+                 << "  {\"name\": \"" << escaped(record->name_) << "\", "
+                 << "\"calls\": " << record->calls_ << ", "
+                 << "\"total_time\": " << record->total_time_ << ", "
+                 << "\"max_time\": " << record->max_time_ << ", "
+                 << "\"particles\": " << record->total_particles_ << "}"
+                 << (i + 1 != sorted_records.size() ? ",\n" : "\n");
+    }
+    out_file << "]\n";
+    out_file.close();
+}
+//=================================================================================================//
+std::string DynamicsProfiler::getTypeName(const std::type_info &type_info)
+{
+    std::string type_name = type_info.name();
+#ifdef __GNUG__
+    int status = 0;
+    char *demangled = abi::__cxa_demangle(type_info.name(), nullptr, nullptr, &status);
+    if (status == 0 && demangled != nullptr)
+        type_name = demangled;
+    std::free(demangled);
+#endif
+    const std::string library_namespace = "SPH::";
+    for (size_t position = type_name.find(library_namespace); position != std::string::npos;
+         position = type_name.find(library_namespace, position))
+    {
+        type_name.erase(position, library_namespace.size());
+    }
+    return type_name;
+}
+//=================================================================================================//
+} // namespace SPH
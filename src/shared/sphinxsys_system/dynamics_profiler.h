@@ -0,0 +1,119 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file dynamics_profiler.h
+ * @brief Opt-in timing of the executions of particle dynamics.
+ * @details The records are identified by names, by default the body name and the type of the dynamics.
+ * The time of a record includes that of the dynamics executed within it, e.g. pre and post processes.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef DYNAMICS_PROFILER_H
+#define DYNAMICS_PROFILER_H
+
+#include "base_data_package.h"
+#include "execution_policy.h"
+#include "sphinxsys_containers.h"
+
+#include <mutex>
+#include <type_traits>
+#include <typeinfo>
+
+namespace SPH
+{
+/**
+ * @struct ProfilingRecord
+ * @brief Accumulated timing of the executions of a named dynamics.
+ */
+struct ProfilingRecord
+{
+    explicit ProfilingRecord(const std::string &name)
+        : name_(name), calls_(0), total_time_(0.0), max_time_(0.0),
+          total_particles_(0), is_running_(false) {};
+
+    std::string name_;
+    size_t calls_;
+    Real total_time_; /**< in seconds */
+    Real max_time_;
+    size_t total_particles_;
+    bool is_running_; /**< avoids counting again when executed within itself */
+};
+
+/**
+ * @class ProfilingScope
+ * @brief Time the execution from construction to destruction, nothing is done if the record is nullptr.
+ * With a device execution policy, the kernels submitted before and within the scope
+ * are waited for, so that the time is not that of the submission only.
+ */
+class ProfilingScope
+{
+  public:
+    ProfilingScope(ProfilingRecord *record, size_t number_of_particles);
+    template <class ExecutionPolicy>
+    ProfilingScope(const ExecutionPolicy &ex_policy, ProfilingRecord *record, size_t number_of_particles)
+        : record_(record), number_of_particles_(number_of_particles),
+          is_device_(std::is_base_of<execution::DeviceExecution<>, ExecutionPolicy>::value)
+    {
+        start();
+    };
+    ~ProfilingScope();
+
+  protected:
+    ProfilingRecord *record_;
+    size_t number_of_particles_;
+    bool is_device_;
+    TickCount start_;
+
+    void start();
+    void waitForDevice();
+};
+
+/**
+ * @class DynamicsProfiler
+ * @brief Registry of the profiling records of the dynamics in a SPH system.
+ */
+class DynamicsProfiler
+{
+    UniquePtrsKeeper<ProfilingRecord> record_ptrs_;
+
+  public:
+    DynamicsProfiler() : is_enabled_(false) {};
+    ~DynamicsProfiler() {};
+    void setEnabled(bool is_enabled) { is_enabled_ = is_enabled; };
+    bool isEnabled() { return is_enabled_; };
+    /** returns the record with the name, which is created if not registered yet */
+    ProfilingRecord *getRecord(const std::string &name);
+    /** table sorted by total time */
+    void writeReport(std::ostream &output_stream);
+    void writeJsonReport(const std::string &filefullpath);
+    /** readable type name of a dynamics without the namespace of the library */
+    static std::string getTypeName(const std::type_info &type_info);
+
+  protected:
+    bool is_enabled_;
+    std::mutex mutex_;
+    StdVec<ProfilingRecord *> records_;
+    StdVec<ProfilingRecord *> sortedRecords();
+};
+} // namespace SPH
+#endif // DYNAMICS_PROFILER_H
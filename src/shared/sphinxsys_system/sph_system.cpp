@@ -12,11 +12,24 @@ SPHSystem::SPHSystem(BoundingBox system_domain_bounds, Real resolution_ref, size
       resolution_ref_(resolution_ref),
       tbb_global_control_(tbb::global_control::max_allowed_parallelism, number_of_threads),
       io_environment_(nullptr), run_particle_relaxation_(false), reload_particles_(false),
-      restart_step_(0), generate_regression_data_(false), state_recording_(true)
+      restart_step_(0), generate_regression_data_(false), state_recording_(true),
+      level_set_caching_(false), level_set_cache_refreshing_(false), relaxed_particle_caching_(false)
 {
     registerSystemVariable<Real>("PhysicalTime", 0.0);
 }
 //=================================================================================================//
+SPHSystem::~SPHSystem()
+{
+    if (dynamics_profiler_.isEnabled())
+    {
+        dynamics_profiler_.writeReport(std::cout);
+        if (io_environment_ != nullptr)
+        {
+            dynamics_profiler_.writeJsonReport(io_environment_->output_folder_ + "/dynamics_profiling.json");
+        }
+    }
+}
+//=================================================================================================//
 IOEnvironment &SPHSystem::getIOEnvironment()
 {
     if (io_environment_ == nullptr)
@@ -75,6 +88,10 @@ SPHSystem *SPHSystem::handleCommandlineOptions(int ac, char *av[])
         desc.add_options()("regression", po::value<bool>(), "Regression test.");
         desc.add_options()("state_recording", po::value<bool>(), "State recording in output folder.");
         desc.add_options()("restart_step", po::value<int>(), "Run form a restart file.");
+        desc.add_options()("profiling", po::value<bool>(), "Timing report of the particle dynamics.");
+        desc.add_options()("level_set_cache", po::value<bool>(), "Reuse level sets cached by former runs.");
+        desc.add_options()("level_set_cache_refresh", po::value<bool>(), "Regenerate and overwrite cached level sets.");
+        desc.add_options()("relaxed_particle_cache", po::value<bool>(), "Reuse particles relaxed by former runs.");
 
         po::variables_map vm;
         po::store(po::parse_command_line(ac, av, desc), vm);
@@ -145,6 +162,34 @@ SPHSystem *SPHSystem::handleCommandlineOptions(int ac, char *av[])
             std::cout << "Restart inactivated, i.e. restart_step ("
                       << restart_step_ << ").\n";
         }
+
+        if (vm.count("profiling"))
+        {
+            dynamics_profiler_.setEnabled(vm["profiling"].as<bool>());
+            std::cout << "Profiling was set to "
+                      << vm["profiling"].as<bool>() << ".\n";
+        }
+
+        if (vm.count("level_set_cache"))
+        {
+            level_set_caching_ = vm["level_set_cache"].as<bool>();
+            std::cout << "Level set caching was set to "
+                      << vm["level_set_cache"].as<bool>() << ".\n";
+        }
+
+        if (vm.count("level_set_cache_refresh"))
+        {
+            level_set_cache_refreshing_ = vm["level_set_cache_refresh"].as<bool>();
+            std::cout << "Level set cache refreshing was set to "
+                      << vm["level_set_cache_refresh"].as<bool>() << ".\n";
+        }
+
+        if (vm.count("relaxed_particle_cache"))
+        {
+            relaxed_particle_caching_ = vm["relaxed_particle_cache"].as<bool>();
+            std::cout << "Relaxed particle caching was set to "
+                      << vm["relaxed_particle_cache"].as<bool>() << ".\n";
+        }
     }
     catch (std::exception &e)
     {
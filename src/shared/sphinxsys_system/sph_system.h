@@ -38,6 +38,7 @@ namespace po = boost::program_options;
 #endif
 
 #include "base_data_package.h"
+#include "dynamics_profiler.h"
 #include "execution_policy.h"
 #include "io_environment.h"
 #include "sphinxsys_containers.h"
@@ -73,7 +74,8 @@ class SPHSystem
 
     SPHSystem(BoundingBox system_domain_bounds, Real resolution_ref,
               size_t number_of_threads = std::thread::hardware_concurrency());
-    virtual ~SPHSystem() {};
+    /** writes the profiling report if profiling is enabled */
+    virtual ~SPHSystem();
 
 #ifdef BOOST_AVAILABLE
     SPHSystem *handleCommandlineOptions(int ac, char *av[]);
@@ -90,6 +92,16 @@ class SPHSystem
     void setStateRecording(bool state_recording) { state_recording_ = state_recording; };
     void setRestartStep(size_t restart_step) { restart_step_ = restart_step; };
     size_t RestartStep() { return restart_step_; };
+    /** to be set before the dynamics are executed, as each dynamics checks it at the first execution */
+    void setProfiling(bool profiling) { dynamics_profiler_.setEnabled(profiling); };
+    DynamicsProfiler &getDynamicsProfiler() { return dynamics_profiler_; };
+    void setLevelSetCaching(bool level_set_caching) { level_set_caching_ = level_set_caching; };
+    bool LevelSetCaching() { return level_set_caching_; };
+    /** regenerate the cached level sets and overwrite the cache files, e.g. after the geometry source files changed */
+    void setLevelSetCacheRefreshing(bool level_set_cache_refreshing) { level_set_cache_refreshing_ = level_set_cache_refreshing; };
+    bool LevelSetCacheRefreshing() { return level_set_cache_refreshing_; };
+    void setRelaxedParticleCaching(bool relaxed_particle_caching) { relaxed_particle_caching_ = relaxed_particle_caching; };
+    bool RelaxedParticleCaching() { return relaxed_particle_caching_; };
     /** Initialize cell linked list for the SPH system. */
     void initializeSystemCellLinkedLists();
     /** Initialize particle configuration for the SPH system. */
@@ -118,6 +130,10 @@ class SPHSystem
     size_t restart_step_;           /**< restart step */
     bool generate_regression_data_; /**< run and generate or enhance the regression test data set. */
     bool state_recording_;          /**< Record state in output folder. */
+    bool level_set_caching_;        /**< reuse level sets saved in the cache folder by former runs. */
+    bool level_set_cache_refreshing_; /**< regenerate and overwrite the cached level sets. */
+    bool relaxed_particle_caching_; /**< reuse particles relaxed to convergence by former runs. */
+    DynamicsProfiler dynamics_profiler_;
     SingularVariables all_system_variables_;
 };
 } // namespace SPH
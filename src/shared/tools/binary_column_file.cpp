@@ -0,0 +1,229 @@
+#include "binary_column_file.h"
+
+#include <cstring>
+#include <fstream>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <filesystem>
+namespace fs = std::filesystem;
+
+namespace SPH
+{
+//=================================================================================================//
+MemoryMappedFile::MemoryMappedFile(const std::string &filefullpath)
+    : is_open_(false), data_(nullptr), size_(0)
+{
+#ifdef _WIN32
+    std::ifstream in_file(filefullpath.c_str(), std::ios::binary | std::ios::ate);
+    if (!in_file.is_open())
+    {
+        return;
+    }
+    size_ = size_t(in_file.tellg());
+    buffer_.resize(size_);
+    in_file.seekg(0);
+    in_file.read(buffer_.data(), size_);
+    data_ = buffer_.data();
+    is_open_ = !in_file.fail();
+#else
+    int file_descriptor = open(filefullpath.c_str(), O_RDONLY);
+    struct stat file_status;
+    if (file_descriptor < 0)
+    {
+        return;
+    }
+    if (fstat(file_descriptor, &file_status) == 0)
+    {
+        size_ = size_t(file_status.st_size);
+        is_open_ = true;
+        if (size_ != 0)
+        {
+            void *mapped = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+            if (mapped == MAP_FAILED)
+            {
+                is_open_ = false;
+                size_ = 0;
+            }
+            else
+            {
+                madvise(mapped, size_, MADV_SEQUENTIAL);
+                data_ = static_cast<const char *>(mapped);
+            }
+        }
+    }
+    close(file_descriptor); // the mapping stays valid after closing
+#endif
+}
+//=================================================================================================//
+MemoryMappedFile::~MemoryMappedFile()
+{
+#ifndef _WIN32
+    if (data_ != nullptr)
+    {
+        munmap(const_cast<char *>(data_), size_);
+    }
+#endif
+}
+//=================================================================================================//
+void BinaryColumnFile::writeToFile(const std::string &filefullpath)
+{
+    if (!tryWriteToFile(filefullpath))
+    {
+        std::cout << "\n Error: " << error_message_ << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+}
+//=================================================================================================//
+bool BinaryColumnFile::tryWriteToFile(const std::string &filefullpath)
+{
+    size_t header_size = sizeof(file_tag_) + sizeof(uint64_t);
+    for (const Column &column : columns_)
+    {
+        header_size += 5 * sizeof(uint64_t) + column.name_.size();
+    }
+
+    auto aligned = [&](uint64_t offset)
+    { return (offset + alignment_ - 1) / alignment_ * alignment_; };
+
+    StdVec<uint64_t> data_offsets;
+    uint64_t offset = aligned(header_size);
+    for (const Column &column : columns_)
+    {
+        data_offsets.push_back(offset);
+        offset = aligned(offset + column.type_size_ * column.number_of_values_);
+    }
+
+    std::string temporary_filefullpath = filefullpath + ".tmp";
+    std::ofstream out_file(temporary_filefullpath.c_str(), std::ios::trunc | std::ios::binary);
+    if (!out_file.is_open())
+    {
+        error_message_ = "the output file:" + temporary_filefullpath + " can not be opened";
+        return false;
+    }
+    auto write_value = [&](uint64_t value)
+    { out_file.write(reinterpret_cast<const char *>(&value), sizeof(uint64_t)); };
+
+    out_file.write(file_tag_, sizeof(file_tag_));
+    write_value(columns_.size());
+    for (size_t i = 0; i != columns_.size(); ++i)
+    {
+        const Column &column = columns_[i];
+        write_value(column.name_.size());
+        out_file.write(column.name_.data(), column.name_.size());
+        write_value(column.type_index_);
+        write_value(column.type_size_);
+        write_value(column.number_of_values_);
+        write_value(data_offsets[i]);
+    }
+
+    const char padding[alignment_] = {};
+    uint64_t position = header_size;
+    for (size_t i = 0; i != columns_.size(); ++i)
+    {
+        out_file.write(padding, data_offsets[i] - position);
+        uint64_t data_size = columns_[i].type_size_ * columns_[i].number_of_values_;
+        out_file.write(columns_[i].data_, data_size);
+        position = data_offsets[i] + data_size;
+    }
+    out_file.close();
+
+    std::error_code error_code;
+    if (!out_file.fail())
+    {
+        fs::rename(temporary_filefullpath, filefullpath, error_code);
+        if (!error_code)
+        {
+            return true;
+        }
+    }
+    fs::remove(temporary_filefullpath, error_code);
+    error_message_ = "the output file:" + filefullpath + " can not be written";
+    return false;
+}
+//=================================================================================================//
+void BinaryColumnFile::loadFile(const std::string &filefullpath)
+{
+    if (!tryLoadFile(filefullpath))
+    {
+        std::cout << "\n Error: " << error_message_ << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+}
+//=================================================================================================//
+bool BinaryColumnFile::tryLoadFile(const std::string &filefullpath)
+{
+    mapped_file_ = makeUnique<MemoryMappedFile>(filefullpath);
+    columns_.clear();
+    if (!mapped_file_->isOpen())
+    {
+        error_message_ = "the input file:" + filefullpath + " can not be opened";
+        return false;
+    }
+
+    const char *data = mapped_file_->Data();
+    size_t size = mapped_file_->Size();
+    size_t position = 0;
+    auto has_size = [&](size_t required_size)
+    { return position + required_size <= size; };
+    auto read_value = [&](uint64_t &value) -> bool
+    {
+        if (!has_size(sizeof(uint64_t)))
+            return false;
+        std::memcpy(&value, data + position, sizeof(uint64_t));
+        position += sizeof(uint64_t);
+        return true;
+    };
+    auto corrupted = [&]() -> bool
+    {
+        columns_.clear();
+        error_message_ = "the binary file:" + filefullpath + " is truncated or corrupted";
+        return false;
+    };
+
+    if (!has_size(sizeof(file_tag_)) || std::memcmp(data, file_tag_, sizeof(file_tag_)) != 0)
+    {
+        error_message_ = "the file:" + filefullpath + " is not a binary column file";
+        return false;
+    }
+    position += sizeof(file_tag_);
+
+    uint64_t number_of_columns;
+    if (!read_value(number_of_columns))
+        return corrupted();
+    for (uint64_t i = 0; i != number_of_columns; ++i)
+    {
+        Column column;
+        uint64_t name_size, data_offset;
+        if (!read_value(name_size) || !has_size(name_size))
+            return corrupted();
+        column.name_ = std::string(data + position, name_size);
+        position += name_size;
+        if (!read_value(column.type_index_) || !read_value(column.type_size_) ||
+            !read_value(column.number_of_values_) || !read_value(data_offset) ||
+            data_offset + column.type_size_ * column.number_of_values_ > size)
+            return corrupted();
+        column.data_ = data + data_offset;
+        columns_.push_back(column);
+    }
+    return true;
+}
+//=================================================================================================//
+BinaryColumnFile::Column *BinaryColumnFile::findColumn(const std::string &name)
+{
+    for (Column &column : columns_)
+    {
+        if (column.name_ == name)
+            return &column;
+    }
+    return nullptr;
+}
+//=================================================================================================//
+} // namespace SPH
@@ -0,0 +1,172 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file    binary_column_file.h
+ * @brief   Binary file of named data columns which is read through memory mapping.
+ * @details The file starts with a header listing the name, the type index, the type size
+ *          and the number of values of each column, followed by the raw column data.
+ *          Each column is aligned to 64 bytes in the file.
+ * @author	Xiangyu Hu
+ */
+#pragma once
+
+#include "base_data_type.h"
+#include "ownership.h"
+#include "sphinxsys_containers.h"
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+namespace SPH
+{
+/**
+ * @struct is_bitwise_serializable
+ * @brief Whether a type can be written and read back as raw bytes.
+ * Eigen fixed-size types are not trivially copyable by the standard,
+ * but they are accepted if they hold their coefficients only.
+ */
+template <typename DataType>
+struct is_bitwise_serializable : std::is_trivially_copyable<DataType>
+{
+};
+
+template <typename DataType, size_t N>
+struct is_bitwise_serializable<std::array<DataType, N>> : is_bitwise_serializable<DataType>
+{
+};
+
+template <typename Scalar, int Rows, int Cols, int Options, int MaxRows, int MaxCols>
+struct is_bitwise_serializable<Eigen::Matrix<Scalar, Rows, Cols, Options, MaxRows, MaxCols>>
+    : std::integral_constant<bool, (Rows > 0 && Cols > 0 && std::is_trivially_copyable<Scalar>::value &&
+                                    sizeof(Eigen::Matrix<Scalar, Rows, Cols, Options, MaxRows, MaxCols>) ==
+                                        Rows * Cols * sizeof(Scalar))>
+{
+};
+
+template <typename Scalar, int Rows, int Cols, int Options, int MaxRows, int MaxCols>
+struct is_bitwise_serializable<Eigen::Array<Scalar, Rows, Cols, Options, MaxRows, MaxCols>>
+    : is_bitwise_serializable<Eigen::Matrix<Scalar, Rows, Cols, Options, MaxRows, MaxCols>>
+{
+};
+
+/**
+ * @class MemoryMappedFile
+ * @brief Read-only mapping of a whole file into memory.
+ * Without POSIX memory mapping, the file is read into a buffer.
+ * The data are nullptr if the file can not be opened or mapped.
+ */
+class MemoryMappedFile
+{
+  public:
+    explicit MemoryMappedFile(const std::string &filefullpath);
+    ~MemoryMappedFile();
+    bool isOpen() { return is_open_; };
+    const char *Data() { return data_; };
+    size_t Size() { return size_; };
+
+  protected:
+    bool is_open_;
+    const char *data_;
+    size_t size_;
+#ifdef _WIN32
+    StdVec<char> buffer_;
+#endif
+};
+
+/**
+ * @class BinaryColumnFile
+ * @brief Write columns of raw data with a header, or load them from a memory-mapped file.
+ * For writing, the columns only refer to the data, which is required to be alive until written.
+ * For reading, the columns refer to the mapped file, which is alive with this object.
+ * The file is written to a temporary file first and then renamed,
+ * so that an interrupted writing does not leave an incomplete file.
+ * The try functions report failures by return values for files which can be regenerated, such as caches.
+ */
+class BinaryColumnFile
+{
+  public:
+    struct Column
+    {
+        std::string name_;
+        uint64_t type_index_;
+        uint64_t type_size_;
+        uint64_t number_of_values_;
+        const char *data_;
+    };
+
+    BinaryColumnFile(){};
+    ~BinaryColumnFile(){};
+
+    template <typename DataType>
+    void addColumn(const std::string &name, const DataType *data, size_t number_of_values)
+    {
+        static_assert(is_bitwise_serializable<DataType>::value, "The column data are not bitwise serializable!");
+        columns_.push_back({name, uint64_t(DataTypeIndex<DataType>::value), uint64_t(sizeof(DataType)),
+                            uint64_t(number_of_values), reinterpret_cast<const char *>(data)});
+    };
+    void writeToFile(const std::string &filefullpath);
+    void loadFile(const std::string &filefullpath);
+    /** returns false if the file can not be written */
+    bool tryWriteToFile(const std::string &filefullpath);
+    /** returns false if the file can not be loaded or is not a valid binary column file */
+    bool tryLoadFile(const std::string &filefullpath);
+    std::string ErrorMessage() { return error_message_; };
+    /** returns nullptr if no column with the name exists */
+    Column *findColumn(const std::string &name);
+    /** returns nullptr if no column with the name, the type index and size, and the number of values exists */
+    template <typename DataType>
+    const DataType *findColumnData(const std::string &name, size_t number_of_values)
+    {
+        static_assert(is_bitwise_serializable<DataType>::value, "The column data are not bitwise serializable!");
+        Column *column = findColumn(name);
+        if (column == nullptr || column->type_index_ != uint64_t(DataTypeIndex<DataType>::value) ||
+            column->type_size_ != sizeof(DataType) || column->number_of_values_ != number_of_values)
+        {
+            return nullptr;
+        }
+        return reinterpret_cast<const DataType *>(column->data_);
+    };
+    /** returns the data of a column which is required to exist with the given type and number of values */
+    template <typename DataType>
+    const DataType *getColumnData(const std::string &name, size_t number_of_values)
+    {
+        const DataType *data = findColumnData<DataType>(name, number_of_values);
+        if (data == nullptr)
+        {
+            std::cout << "\n Error: the column " << name << " is missing or not matching in the binary file!" << std::endl;
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            exit(1);
+        }
+        return data;
+    };
+
+  protected:
+    static constexpr char file_tag_[8] = {'S', 'P', 'H', 'C', 'O', 'L', '0', '1'};
+    static constexpr uint64_t alignment_ = 64;
+    StdVec<Column> columns_;
+    UniquePtr<MemoryMappedFile> mapped_file_;
+    std::string error_message_;
+};
+} // namespace SPH
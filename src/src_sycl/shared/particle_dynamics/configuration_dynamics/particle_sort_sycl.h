@@ -33,22 +33,5 @@
 #include "implementation_sycl.h"
 #include "particle_sort_ck.h"
 
-namespace SPH
-{
-using namespace execution;
-
-class RadixSort
-{
-  public:
-    template <class ExecutionPolicy>
-    explicit RadixSort(const ExecutionPolicy &ex_policy,
-                       DiscreteVariable<UnsignedInt> *dv_sequence,
-                       DiscreteVariable<UnsignedInt> *dv_index_permutation);
-    void sort(const ParallelDevicePolicy &ex_policy, BaseParticles *particles);
-
-  protected:
-    DiscreteVariable<UnsignedInt> *dv_sequence_;
-    DiscreteVariable<UnsignedInt> *dv_index_permutation_;
-};
-} // namespace SPH
+/** RadixSort is declared in particle_sorting.h, the device sorting is given in the source here. */
 #endif // PARTICLE_SORT_SYCL_H
@@ -3,14 +3,5 @@
 
 #include "particle_sort_sycl.h"
 
-namespace SPH
-{
-//=================================================================================================//
-template <class ExecutionPolicy>
-RadixSort::RadixSort(const ExecutionPolicy &ex_policy,
-                     DiscreteVariable<UnsignedInt> *dv_sequence,
-                     DiscreteVariable<UnsignedInt> *dv_index_permutation)
-    : dv_sequence_(dv_sequence), dv_index_permutation_(dv_index_permutation) {}
-//=================================================================================================//
-} // namespace SPH
+#include "particle_sorting.hpp"
 #endif // PARTICLE_SORT_SYCL_HPP
@@ -33,7 +33,7 @@ int main(int ac, char *av[])
 #endif
     IOEnvironment io_environment(sph_system);
 
-    Heart triangle_mesh_heart_model("HeartModel");
+    SharedPtr<Heart> triangle_mesh_heart_model = makeShared<Heart>("HeartModel");
     SharedPtr<LevelSetShape> level_set_heart_model =
         makeShared<LevelSetShape>(triangle_mesh_heart_model, makeShared<SPHAdaptation>(dp_0));
     level_set_heart_model->correctLevelSetSign()->writeLevelSet(sph_system);
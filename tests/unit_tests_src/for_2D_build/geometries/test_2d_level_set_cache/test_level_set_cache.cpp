@@ -0,0 +1,155 @@
+/**
+ * @file 	test_level_set_cache.cpp
+ * @brief 	test that a cached level set is reloaded with the same values as a generated one
+ *          and that different shapes or operation chains are cached separately,
+ *          and that the level set shape of a missing sub-shape is reported as an error.
+ */
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+using namespace SPH;
+//----------------------------------------------------------------------
+//	Basic geometry parameters and numerical setup.
+//----------------------------------------------------------------------
+Real particle_spacing = 0.05;
+BoundingBox system_domain_bounds(Vec2d(-1.0, -1.0), Vec2d(2.0, 2.0));
+Vec2d cylinder_center(0.5, 0.5);
+//----------------------------------------------------------------------
+//	Helper functions.
+//----------------------------------------------------------------------
+SharedPtr<MultiPolygonShape> createCylinder(Real radius)
+{
+    MultiPolygon cylinder;
+    cylinder.addACircle(cylinder_center, radius, 100, ShapeBooleanOps::add);
+    return makeShared<MultiPolygonShape>(cylinder, "Cylinder");
+}
+
+size_t numberOfCacheFiles(const std::string &cache_folder)
+{
+    size_t number_of_files = 0;
+    if (fs::exists(cache_folder))
+    {
+        for (const auto &entry : fs::directory_iterator(cache_folder))
+        {
+            if (entry.is_regular_file())
+                number_of_files++;
+        }
+    }
+    return number_of_files;
+}
+
+StdVec<Real> probeSignedDistances(LevelSetShape &level_set_shape)
+{
+    StdVec<Real> signed_distances;
+    size_t number_of_probes = 40;
+    for (size_t i = 0; i != number_of_probes; ++i)
+        for (size_t j = 0; j != number_of_probes; ++j)
+        {
+            Vecd probe_point = cylinder_center +
+                               0.6 * Vecd(2.0 * Real(i) / Real(number_of_probes) - 1.0,
+                                          2.0 * Real(j) / Real(number_of_probes) - 1.0);
+            signed_distances.push_back(level_set_shape.getLevelSet().probeSignedDistance(probe_point));
+        }
+    return signed_distances;
+}
+//----------------------------------------------------------------------
+//	Tests.
+//----------------------------------------------------------------------
+TEST(LevelSetCache, CachedAndGeneratedLevelSets)
+{
+    SPHSystem sph_system(system_domain_bounds, particle_spacing);
+    sph_system.setIOEnvironment();
+    std::string cache_folder = sph_system.getIOEnvironment().level_set_cache_folder_;
+    if (fs::exists(cache_folder))
+    {
+        fs::remove_all(cache_folder);
+    }
+
+    SolidBody generated_cylinder(sph_system, createCylinder(0.3));
+    StdVec<Real> generated = probeSignedDistances(*generated_cylinder.defineBodyLevelSetShape()->cleanLevelSet());
+    EXPECT_EQ(numberOfCacheFiles(cache_folder), 0);
+
+    sph_system.setLevelSetCaching(true);
+    SolidBody written_cylinder(sph_system, createCylinder(0.3));
+    StdVec<Real> written = probeSignedDistances(*written_cylinder.defineBodyLevelSetShape()->cleanLevelSet());
+    EXPECT_EQ(numberOfCacheFiles(cache_folder), 1);
+
+    SolidBody reloaded_cylinder(sph_system, createCylinder(0.3));
+    StdVec<Real> reloaded = probeSignedDistances(*reloaded_cylinder.defineBodyLevelSetShape()->cleanLevelSet());
+    EXPECT_EQ(numberOfCacheFiles(cache_folder), 1);
+
+    for (size_t k = 0; k != generated.size(); ++k)
+    {
+        EXPECT_NEAR(generated[k], written[k], 1.0e-6 * particle_spacing);
+        EXPECT_EQ(written[k], reloaded[k]);
+    }
+
+    /** the cache key covers the whole chain of operations and the source shape. */
+    SolidBody uncleaned_cylinder(sph_system, createCylinder(0.3));
+    uncleaned_cylinder.defineBodyLevelSetShape()->getLevelSet();
+    EXPECT_EQ(numberOfCacheFiles(cache_folder), 2);
+
+    SolidBody larger_cylinder(sph_system, createCylinder(0.35));
+    larger_cylinder.defineBodyLevelSetShape()->cleanLevelSet()->getLevelSet();
+    EXPECT_EQ(numberOfCacheFiles(cache_folder), 3);
+
+    /** refreshing regenerates and overwrites the cache file. */
+    sph_system.setLevelSetCacheRefreshing(true);
+    SolidBody refreshed_cylinder(sph_system, createCylinder(0.3));
+    StdVec<Real> refreshed = probeSignedDistances(*refreshed_cylinder.defineBodyLevelSetShape()->cleanLevelSet());
+    EXPECT_EQ(numberOfCacheFiles(cache_folder), 3);
+    for (size_t k = 0; k != generated.size(); ++k)
+    {
+        EXPECT_NEAR(generated[k], refreshed[k], 1.0e-6 * particle_spacing);
+    }
+}
+
+TEST(LevelSetCache, ConcurrentFirstUse)
+{
+    SPHSystem sph_system(system_domain_bounds, particle_spacing);
+    sph_system.setIOEnvironment();
+    sph_system.setLevelSetCaching(true);
+    sph_system.setLevelSetCacheRefreshing(true);
+
+    SolidBody generated_cylinder(sph_system, createCylinder(0.3));
+    StdVec<Real> generated = probeSignedDistances(*generated_cylinder.defineBodyLevelSetShape()->cleanLevelSet());
+
+    /** the deferred level set is generated once even if first used by concurrent probes. */
+    SolidBody concurrent_cylinder(sph_system, createCylinder(0.3));
+    LevelSetShape *level_set_shape = concurrent_cylinder.defineBodyLevelSetShape()->cleanLevelSet();
+    StdVec<MultilevelLevelSet *> used_level_sets(64, nullptr);
+    parallel_for(IndexRange(0, used_level_sets.size()),
+                 [&](const IndexRange &r)
+                 {
+                     for (size_t i = r.begin(); i != r.end(); ++i)
+                     {
+                         level_set_shape->checkContain(cylinder_center);
+                         used_level_sets[i] = &level_set_shape->getLevelSet();
+                     }
+                 });
+    for (size_t i = 0; i != used_level_sets.size(); ++i)
+    {
+        EXPECT_EQ(used_level_sets[i], used_level_sets[0]);
+    }
+    StdVec<Real> concurrent = probeSignedDistances(*level_set_shape);
+    for (size_t k = 0; k != generated.size(); ++k)
+    {
+        EXPECT_NEAR(generated[k], concurrent[k], 1.0e-6 * particle_spacing);
+    }
+}
+
+TEST(LevelSetCacheDeathTest, MissingSubShape)
+{
+    SPHSystem sph_system(system_domain_bounds, particle_spacing);
+    SharedPtr<ComplexShape> complex_shape = makeShared<ComplexShape>("ComplexShape");
+    MultiPolygon cylinder;
+    cylinder.addACircle(cylinder_center, 0.3, 100, ShapeBooleanOps::add);
+    complex_shape->add<MultiPolygonShape>(cylinder, "Cylinder");
+    SolidBody complex_body(sph_system, complex_shape);
+    EXPECT_EXIT(complex_shape->defineLevelSetShape(complex_body, "MissingShape"), testing::ExitedWithCode(1), "");
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
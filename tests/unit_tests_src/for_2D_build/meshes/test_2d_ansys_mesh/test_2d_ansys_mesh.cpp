@@ -0,0 +1,214 @@
+/**
+ * @file 	test_2d_ansys_mesh.cpp
+ * @brief 	test that the binary cache reproduces the parsed ANSYS mesh,
+ *          that a damaged or unwritable cache falls back to parsing the mesh,
+ *          that the face neighbors stay consistent after reordering the elements,
+ *          and that the elements follow the space-filling curve after reordering.
+ */
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <set>
+using namespace SPH;
+namespace fs = std::filesystem;
+
+std::string ansys_mesh_file_path = "./input/double_mach_reflection_0.05.msh";
+std::string ansys_mesh_cache_path = ansys_mesh_file_path + ".bin";
+//----------------------------------------------------------------------
+//	Compare all the data of two meshes, which should be identical bitwise.
+//----------------------------------------------------------------------
+void expectSameMesh(ANSYSMesh &expected, ANSYSMesh &actual)
+{
+    EXPECT_EQ(expected.types_of_boundary_condition_, actual.types_of_boundary_condition_);
+    EXPECT_EQ(expected.elements_volumes_, actual.elements_volumes_);
+    EXPECT_EQ(expected.elements_nodes_connection_, actual.elements_nodes_connection_);
+    EXPECT_EQ(expected.mesh_topology_, actual.mesh_topology_);
+    EXPECT_EQ(expected.MinMeshEdge(), actual.MinMeshEdge());
+
+    ASSERT_EQ(expected.node_coordinates_.size(), actual.node_coordinates_.size());
+    for (size_t i = 0; i != expected.node_coordinates_.size(); ++i)
+    {
+        EXPECT_EQ(expected.node_coordinates_[i], actual.node_coordinates_[i]);
+    }
+    ASSERT_EQ(expected.elements_centroids_.size(), actual.elements_centroids_.size());
+    for (size_t i = 0; i != expected.elements_centroids_.size(); ++i)
+    {
+        EXPECT_EQ(expected.elements_centroids_[i], actual.elements_centroids_[i]);
+    }
+}
+//----------------------------------------------------------------------
+//	Check that the reordered mesh is a renumbering of the original one
+//	whose face neighbors are symmetric and sorted.
+//----------------------------------------------------------------------
+void expectConsistentReordering(ANSYSMesh &original, ANSYSMesh &reordered)
+{
+    size_t number_of_elements = original.elements_centroids_.size();
+    ASSERT_EQ(number_of_elements, reordered.elements_centroids_.size());
+    ASSERT_EQ(number_of_elements, reordered.mesh_topology_.size());
+    ASSERT_EQ(number_of_elements, reordered.elements_nodes_connection_.size());
+
+    /** each new element is found among the original ones by its nodes */
+    std::map<StdVec<size_t>, size_t> original_index;
+    auto sorted_nodes = [](const StdVec<size_t> &nodes)
+    {
+        StdVec<size_t> sorted(nodes);
+        std::sort(sorted.begin(), sorted.end());
+        return sorted;
+    };
+    for (size_t i = 0; i != number_of_elements; ++i)
+    {
+        original_index[sorted_nodes(original.elements_nodes_connection_[i])] = i;
+    }
+    StdVec<bool> is_found(number_of_elements, false);
+    for (size_t k = 0; k != number_of_elements; ++k)
+    {
+        auto found = original_index.find(sorted_nodes(reordered.elements_nodes_connection_[k]));
+        ASSERT_NE(found, original_index.end());
+        size_t i = found->second;
+        EXPECT_FALSE(is_found[i]);
+        is_found[i] = true;
+        EXPECT_EQ(original.elements_centroids_[i], reordered.elements_centroids_[k]);
+        EXPECT_EQ(original.elements_volumes_[i], reordered.elements_volumes_[k]);
+        EXPECT_EQ(original.mesh_topology_[i].size(), reordered.mesh_topology_[k].size());
+    }
+
+    auto is_element = [&](size_t neighbor)
+    { return neighbor != 0 && neighbor <= number_of_elements; };
+    auto same_face_nodes = [](const StdVec<size_t> &a, const StdVec<size_t> &b)
+    { return StdVec<size_t>(a.begin() + 2, a.end()) == StdVec<size_t>(b.begin() + 2, b.end()) ||
+             StdVec<size_t>(a.begin() + 2, a.end()) == StdVec<size_t>(b.rbegin(), b.rend() - 2); };
+    for (size_t k = 0; k != number_of_elements; ++k)
+    {
+        StdVec<StdVec<size_t>> &faces = reordered.mesh_topology_[k];
+        for (size_t n = 0; n != faces.size(); ++n)
+        {
+            if (n != 0)
+            {
+                EXPECT_LE(faces[n - 1][0], faces[n][0]);
+            }
+            if (!is_element(faces[n][0]))
+                continue;
+
+            /** the neighbor has the reverse face with the same nodes */
+            size_t l = faces[n][0] - 1;
+            size_t number_of_reverse_faces = 0;
+            for (auto &reverse_face : reordered.mesh_topology_[l])
+            {
+                if (reverse_face[0] == k + 1)
+                {
+                    ++number_of_reverse_faces;
+                    EXPECT_EQ(reverse_face[1], faces[n][1]);
+                    EXPECT_TRUE(same_face_nodes(reverse_face, faces[n]));
+                }
+            }
+            EXPECT_EQ(number_of_reverse_faces, 1);
+        }
+    }
+}
+
+//----------------------------------------------------------------------
+//	Check that the sequence keys of consecutive elements are non-decreasing
+//	and that the background mesh of the keys distinguishes the elements.
+//----------------------------------------------------------------------
+template <class SequenceOrderType>
+void expectSequenceOrdered(ANSYSMesh &reordered, const SequenceOrderType &sequence_order)
+{
+    size_t number_of_elements = reordered.elements_centroids_.size();
+    Vecd lower_bound = MaxReal * Vecd::Ones();
+    Vecd upper_bound = MinReal * Vecd::Ones();
+    for (size_t i = 0; i != number_of_elements; ++i)
+    {
+        lower_bound = lower_bound.cwiseMin(reordered.elements_centroids_[i]);
+        upper_bound = upper_bound.cwiseMax(reordered.elements_centroids_[i]);
+    }
+    int resolution = Mesh::SequenceCellsPerAxis();
+    ASSERT_GT(resolution, 2);
+    Real grid_spacing = SMAX((upper_bound - lower_bound).maxCoeff() / Real(resolution - 2), Eps);
+    Mesh background_mesh(lower_bound, grid_spacing, resolution * Arrayi::Ones());
+
+    StdVec<size_t> sequence(number_of_elements);
+    for (size_t i = 0; i != number_of_elements; ++i)
+    {
+        sequence[i] = background_mesh.transferMeshIndexToSequence(
+            sequence_order, background_mesh.CellIndexFromPosition(reordered.elements_centroids_[i]));
+    }
+    for (size_t k = 1; k < number_of_elements; ++k)
+    {
+        EXPECT_LE(sequence[k - 1], sequence[k]);
+    }
+    std::set<size_t> distinct_keys(sequence.begin(), sequence.end());
+    EXPECT_GT(distinct_keys.size(), number_of_elements / 2);
+}
+
+TEST(ANSYSMesh, BinaryCache)
+{
+    fs::remove(ansys_mesh_cache_path);
+    ANSYSMesh parsed_mesh(ansys_mesh_file_path);
+    EXPECT_FALSE(fs::exists(ansys_mesh_cache_path));
+
+    ANSYSMesh written_mesh(ansys_mesh_file_path, true);
+    EXPECT_TRUE(fs::exists(ansys_mesh_cache_path));
+    expectSameMesh(parsed_mesh, written_mesh);
+
+    ANSYSMesh cached_mesh(ansys_mesh_file_path, true);
+    expectSameMesh(parsed_mesh, cached_mesh);
+    fs::remove(ansys_mesh_cache_path);
+}
+
+TEST(ANSYSMesh, DamagedOrUnwritableCache)
+{
+    fs::remove(ansys_mesh_cache_path);
+    ANSYSMesh parsed_mesh(ansys_mesh_file_path);
+    {
+        ANSYSMesh written_mesh(ansys_mesh_file_path, true);
+    }
+    /** a cache truncated, e.g. by an interrupted run, is parsed again and rewritten */
+    fs::resize_file(ansys_mesh_cache_path, fs::file_size(ansys_mesh_cache_path) / 2);
+    ANSYSMesh truncated_cache_mesh(ansys_mesh_file_path, true);
+    expectSameMesh(parsed_mesh, truncated_cache_mesh);
+    ANSYSMesh rewritten_cache_mesh(ansys_mesh_file_path, true);
+    expectSameMesh(parsed_mesh, rewritten_cache_mesh);
+
+    /** a file which is not a binary column file */
+    {
+        std::ofstream out_file(ansys_mesh_cache_path, std::ios::trunc);
+        out_file << "not a cache";
+    }
+    ANSYSMesh invalid_cache_mesh(ansys_mesh_file_path, true);
+    expectSameMesh(parsed_mesh, invalid_cache_mesh);
+    fs::remove(ansys_mesh_cache_path);
+
+    /** the cache can not be renamed to a directory, so that it is skipped */
+    fs::create_directory(ansys_mesh_cache_path);
+    ANSYSMesh unwritable_cache_mesh(ansys_mesh_file_path, true);
+    expectSameMesh(parsed_mesh, unwritable_cache_mesh);
+    EXPECT_TRUE(fs::is_directory(ansys_mesh_cache_path));
+    EXPECT_FALSE(fs::exists(ansys_mesh_cache_path + ".tmp"));
+    fs::remove(ansys_mesh_cache_path);
+}
+
+TEST(ANSYSMesh, ReorderElements)
+{
+    ANSYSMesh original_mesh(ansys_mesh_file_path);
+
+    ANSYSMesh reverse_cuthill_mckee_mesh(ansys_mesh_file_path);
+    reverse_cuthill_mckee_mesh.reorderElements(ReverseCuthillMcKeeOrder());
+    expectConsistentReordering(original_mesh, reverse_cuthill_mckee_mesh);
+
+    ANSYSMesh morton_mesh(ansys_mesh_file_path);
+    morton_mesh.reorderElements(MortonOrder());
+    expectConsistentReordering(original_mesh, morton_mesh);
+    expectSequenceOrdered(morton_mesh, MortonOrder());
+
+    ANSYSMesh hilbert_mesh(ansys_mesh_file_path);
+    hilbert_mesh.reorderElements(HilbertOrder());
+    expectConsistentReordering(original_mesh, hilbert_mesh);
+    expectSequenceOrdered(hilbert_mesh, HilbertOrder());
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,130 @@
+/**
+ * @file 	test_space_filling_curves.cpp
+ * @brief 	test the Morton and Hilbert orders of mesh indices with known values,
+ *          and that consecutive cells along the Hilbert curve are face neighbors.
+ */
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+using namespace SPH;
+//----------------------------------------------------------------------
+//	Helper functions.
+//----------------------------------------------------------------------
+Mesh createMesh()
+{
+    return Mesh(BoundingBox(Vecd::Zero(), Vecd::Ones()), 0.1, 0);
+}
+
+/** all indices of a block with 2^level cells along each axis */
+template <int N>
+StdVec<Eigen::Array<int, N, 1>> blockIndices(int level)
+{
+    using IndexType = Eigen::Array<int, N, 1>;
+    int cells_per_axis = 1 << level;
+    StdVec<IndexType> indices;
+    IndexType index = IndexType::Zero();
+    size_t number_of_cells = size_t(1) << (level * N);
+    for (size_t k = 0; k != number_of_cells; ++k)
+    {
+        size_t remainder = k;
+        for (int i = 0; i != N; ++i)
+        {
+            index[i] = int(remainder % cells_per_axis);
+            remainder /= cells_per_axis;
+        }
+        indices.push_back(index);
+    }
+    return indices;
+}
+
+template <int N>
+void checkHilbertCurve(Mesh &mesh, int level)
+{
+    using IndexType = Eigen::Array<int, N, 1>;
+    StdVec<IndexType> indices = blockIndices<N>(level);
+    size_t number_of_cells = indices.size();
+    StdVec<IndexType> curve(number_of_cells, IndexType::Constant(-1));
+    for (const IndexType &index : indices)
+    {
+        // the curve fills the block at the origin before leaving it
+        size_t key = mesh.transferMeshIndexToHilbertOrder(index);
+        ASSERT_LT(key, number_of_cells);
+        EXPECT_TRUE((curve[key] == -1).all());
+        curve[key] = index;
+    }
+
+    EXPECT_TRUE((curve.front() == 0).all());
+    // the curve ends at a corner next to the origin
+    EXPECT_EQ(curve.back().sum(), (1 << level) - 1);
+    EXPECT_EQ((curve.back() == 0).count(), N - 1);
+    for (size_t k = 1; k != number_of_cells; ++k)
+    {
+        EXPECT_EQ((curve[k] - curve[k - 1]).abs().sum(), 1)
+            << "cells " << curve[k - 1].transpose() << " and " << curve[k].transpose()
+            << " are not face neighbors at level " << level;
+    }
+}
+//----------------------------------------------------------------------
+//	Tests.
+//----------------------------------------------------------------------
+TEST(SpaceFillingCurves, MortonOrderKnownValues)
+{
+    Mesh mesh = createMesh();
+    EXPECT_EQ(mesh.transferMeshIndexToMortonOrder(Array2i(0, 0)), size_t(0));
+    EXPECT_EQ(mesh.transferMeshIndexToMortonOrder(Array2i(1, 0)), size_t(1));
+    EXPECT_EQ(mesh.transferMeshIndexToMortonOrder(Array2i(0, 1)), size_t(2));
+    EXPECT_EQ(mesh.transferMeshIndexToMortonOrder(Array2i(1, 1)), size_t(3));
+    EXPECT_EQ(mesh.transferMeshIndexToMortonOrder(Array2i(2, 0)), size_t(4));
+    EXPECT_EQ(mesh.transferMeshIndexToMortonOrder(Array2i(3, 5)), size_t(39));
+
+    EXPECT_EQ(mesh.transferMeshIndexToMortonOrder(Array3i(1, 0, 0)), size_t(1));
+    EXPECT_EQ(mesh.transferMeshIndexToMortonOrder(Array3i(0, 1, 0)), size_t(2));
+    EXPECT_EQ(mesh.transferMeshIndexToMortonOrder(Array3i(0, 0, 1)), size_t(4));
+    EXPECT_EQ(mesh.transferMeshIndexToMortonOrder(Array3i(1, 1, 1)), size_t(7));
+    EXPECT_EQ(mesh.transferMeshIndexToMortonOrder(Array3i(2, 0, 0)), size_t(8));
+    EXPECT_EQ(mesh.transferMeshIndexToMortonOrder(Array3i(3, 5, 6)), size_t(0b110101011));
+
+    // the highest bits of the keys are used for large indices
+    int high_bit = 4 * sizeof(UnsignedInt) - 2;
+    EXPECT_EQ(mesh.transferMeshIndexToMortonOrder(Array2i(1 << high_bit, 0)), size_t(1) << (2 * high_bit));
+    EXPECT_EQ(mesh.transferMeshIndexToMortonOrder(Array2i(0, 1 << high_bit)), size_t(1) << (2 * high_bit + 1));
+}
+
+TEST(SpaceFillingCurves, MortonOrderFillsBlocks)
+{
+    Mesh mesh = createMesh();
+    for (int level = 1; level != 5; ++level)
+    {
+        StdVec<size_t> keys;
+        for (const Array2i &index : blockIndices<2>(level))
+            keys.push_back(mesh.transferMeshIndexToMortonOrder(index));
+        std::sort(keys.begin(), keys.end());
+        for (size_t k = 0; k != keys.size(); ++k)
+            EXPECT_EQ(keys[k], k);
+    }
+}
+
+TEST(SpaceFillingCurves, HilbertOrder2d)
+{
+    Mesh mesh = createMesh();
+    for (int level = 1; level != 7; ++level)
+    {
+        checkHilbertCurve<2>(mesh, level);
+    }
+}
+
+TEST(SpaceFillingCurves, HilbertOrder3d)
+{
+    Mesh mesh = createMesh();
+    for (int level = 1; level != 5; ++level)
+    {
+        checkHilbertCurve<3>(mesh, level);
+    }
+}
+//----------------------------------------------------------------------
+//	Main.
+//----------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
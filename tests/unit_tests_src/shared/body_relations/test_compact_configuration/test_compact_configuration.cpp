@@ -0,0 +1,185 @@
+/**
+ * @file 	test_compact_configuration.cpp
+ * @brief 	test that the views of the compact (CSR) configurations in the per-particle
+ *          configurations have the same neighbors as the per-particle configurations,
+ *          and that dynamics give the same results with both.
+ */
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+using namespace SPH;
+//----------------------------------------------------------------------
+//	Basic geometry parameters and numerical setup.
+//----------------------------------------------------------------------
+Real DL = 1.0;
+Real DH = 0.5;
+Real particle_spacing = 0.05;
+Real BW = particle_spacing * 4;
+//----------------------------------------------------------------------
+//	Compare the neighbors of a particle, independent of their order.
+//----------------------------------------------------------------------
+void expectSameNeighbors(const Neighborhood &legacy, const Neighborhood &compact)
+{
+    ASSERT_EQ(legacy.current_size_, compact.current_size_);
+    StdVec<std::pair<size_t, size_t>> legacy_order, compact_order;
+    for (size_t n = 0; n != legacy.current_size_; ++n)
+    {
+        legacy_order.push_back(std::make_pair(legacy.j_[n], n));
+        compact_order.push_back(std::make_pair(compact.j_[n], n));
+    }
+    std::sort(legacy_order.begin(), legacy_order.end());
+    std::sort(compact_order.begin(), compact_order.end());
+    for (size_t k = 0; k != legacy_order.size(); ++k)
+    {
+        size_t n = legacy_order[k].second;
+        size_t m = compact_order[k].second;
+        EXPECT_EQ(legacy_order[k].first, compact_order[k].first);
+        EXPECT_NEAR(legacy.W_ij_[n], compact.W_ij_[m], 1.0e-5 * ABS(legacy.W_ij_[n]) + Eps);
+        EXPECT_NEAR(legacy.dW_ij_[n], compact.dW_ij_[m], 1.0e-5 * ABS(legacy.dW_ij_[n]) + Eps);
+        EXPECT_NEAR(legacy.r_ij_[n], compact.r_ij_[m], 1.0e-5 * particle_spacing);
+        EXPECT_LT((legacy.e_ij_[n] - compact.e_ij_[m]).norm(), 1.0e-5);
+    }
+}
+
+//----------------------------------------------------------------------
+//	The water block on a wall with both legacy and compact relations.
+//----------------------------------------------------------------------
+class CompactConfigurationTest : public testing::Test
+{
+  protected:
+    BoundingBox system_domain_bounds_{Vec2d(-BW, -BW), Vec2d(DL + BW, DH + BW)};
+    SPHSystem sph_system_{system_domain_bounds_, particle_spacing};
+    FluidBody water_block_{sph_system_, makeShared<MultiPolygonShape>(waterShape(), "WaterBody")};
+    SolidBody wall_boundary_{sph_system_, makeShared<MultiPolygonShape>(wallShape(), "WallBoundary")};
+
+    static MultiPolygon waterShape()
+    {
+        MultiPolygon water_shape;
+        water_shape.addABox(Transform(0.5 * Vec2d(DL, DH)), 0.5 * Vec2d(DL, DH), ShapeBooleanOps::add);
+        return water_shape;
+    };
+    static MultiPolygon wallShape()
+    {
+        MultiPolygon wall_shape;
+        wall_shape.addABox(Transform(Vec2d(0.5 * DL, -0.5 * BW)), Vec2d(0.5 * DL + BW, 0.5 * BW), ShapeBooleanOps::add);
+        return wall_shape;
+    };
+
+    void SetUp() override
+    {
+        water_block_.defineMaterial<WeaklyCompressibleFluid>(1.0, 10.0);
+        water_block_.generateParticles<BaseParticles, Lattice>();
+        wall_boundary_.defineMaterial<Solid>();
+        wall_boundary_.generateParticles<BaseParticles, Lattice>();
+
+        /** perturb the lattice so that the neighbor lists are not regular. */
+        BaseParticles &water_particles = water_block_.getBaseParticles();
+        Vecd *pos = water_particles.ParticlePositions();
+        for (size_t i = 0; i != water_particles.TotalRealParticles(); ++i)
+        {
+            pos[i] += 0.2 * particle_spacing * Vecd(rand_uniform(-1.0, 1.0), rand_uniform(-1.0, 1.0));
+        }
+        water_block_.updateCellLinkedList();
+        wall_boundary_.updateCellLinkedList();
+    };
+};
+
+TEST_F(CompactConfigurationTest, NeighborsAndDensitySummation)
+{
+    InnerRelation water_inner(water_block_);
+    ContactRelation water_wall_contact(water_block_, {&wall_boundary_});
+    InnerRelation water_inner_compact(water_block_);
+    ContactRelation water_wall_contact_compact(water_block_, {&wall_boundary_});
+    water_inner_compact.useCompactConfiguration();
+    water_wall_contact_compact.useCompactConfiguration();
+
+    InteractionWithUpdate<fluid_dynamics::DensitySummationComplex> density_summation(water_inner, water_wall_contact);
+    InteractionWithUpdate<fluid_dynamics::DensitySummationComplex>
+        density_summation_compact(water_inner_compact, water_wall_contact_compact);
+
+    water_inner.updateConfiguration();
+    water_wall_contact.updateConfiguration();
+    water_inner_compact.updateConfiguration();
+    water_wall_contact_compact.updateConfiguration();
+
+    BaseParticles &water_particles = water_block_.getBaseParticles();
+    size_t total_real_particles = water_particles.TotalRealParticles();
+    EXPECT_GT(water_inner_compact.compact_inner_configuration_.TotalNeighbors(), 0);
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        /** the per-particle configurations of the compact relations view the compact storage,
+         *  in which the neighbors of consecutive particles are contiguous */
+        Neighborhood &inner_view = water_inner_compact.inner_configuration_[i];
+        Neighborhood &contact_view = water_wall_contact_compact.contact_configuration_[0][i];
+        EXPECT_TRUE(inner_view.j_.isView());
+        EXPECT_TRUE(contact_view.W_ij_.isView());
+        if (i + 1 != total_real_particles)
+        {
+            EXPECT_EQ(inner_view.j_.data() + inner_view.current_size_,
+                      water_inner_compact.inner_configuration_[i + 1].j_.data());
+            EXPECT_EQ(contact_view.W_ij_.data() + contact_view.current_size_,
+                      water_wall_contact_compact.contact_configuration_[0][i + 1].W_ij_.data());
+        }
+        expectSameNeighbors(water_inner.inner_configuration_[i], inner_view);
+        expectSameNeighbors(water_wall_contact.contact_configuration_[0][i], contact_view);
+    }
+    /** the neighborhoods beyond the real particles do not view the compact storage */
+    for (size_t i = total_real_particles; i != water_inner_compact.inner_configuration_.size(); ++i)
+    {
+        EXPECT_FALSE(water_inner_compact.inner_configuration_[i].j_.isView());
+        EXPECT_EQ(water_inner_compact.inner_configuration_[i].current_size_, 0);
+    }
+
+    Real *rho = water_particles.getVariableDataByName<Real>("Density");
+    density_summation.exec();
+    StdVec<Real> rho_legacy(rho, rho + total_real_particles);
+    density_summation_compact.exec();
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        EXPECT_NEAR(rho_legacy[i], rho[i], 1.0e-5 * rho_legacy[i]);
+    }
+}
+
+TEST_F(CompactConfigurationTest, UnchangedLegacyDynamics)
+{
+    InnerRelation water_inner(water_block_);
+    ContactRelation water_wall_contact(water_block_, {&wall_boundary_});
+    InnerRelation water_inner_compact(water_block_);
+    ContactRelation water_wall_contact_compact(water_block_, {&wall_boundary_});
+    water_inner_compact.useCompactConfiguration();
+    water_wall_contact_compact.useCompactConfiguration();
+
+    /** the correction matrix reads the per-particle configurations. */
+    InteractionWithUpdate<LinearGradientCorrectionMatrixComplex> correction_matrix(water_inner, water_wall_contact);
+    InteractionWithUpdate<LinearGradientCorrectionMatrixComplex>
+        correction_matrix_compact(water_inner_compact, water_wall_contact_compact);
+
+    water_inner.updateConfiguration();
+    water_wall_contact.updateConfiguration();
+    water_inner_compact.updateConfiguration();
+    water_wall_contact_compact.updateConfiguration();
+
+    BaseParticles &water_particles = water_block_.getBaseParticles();
+    size_t total_real_particles = water_particles.TotalRealParticles();
+    Matd *B = water_particles.getVariableDataByName<Matd>("LinearGradientCorrectionMatrix");
+    correction_matrix.exec();
+    StdVec<Matd> B_legacy(B, B + total_real_particles);
+    correction_matrix_compact.exec();
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        EXPECT_LT((B_legacy[i] - B[i]).norm(), 1.0e-4 * B_legacy[i].norm());
+    }
+}
+
+TEST_F(CompactConfigurationTest, RejectUnsupportedRelation)
+{
+    testing::FLAGS_gtest_death_test_style = "threadsafe";
+    /** the self contact relation does not build the compact configuration. */
+    SelfSurfaceContactRelation water_self_contact(water_block_);
+    EXPECT_EXIT(water_self_contact.useCompactConfiguration(), testing::ExitedWithCode(1), "");
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
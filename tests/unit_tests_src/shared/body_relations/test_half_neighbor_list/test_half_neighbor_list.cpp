@@ -0,0 +1,86 @@
+/**
+ * @file 	test_half_neighbor_list.cpp
+ * @brief 	test that the symmetric interaction with the half neighbor list gives
+ *          the same pressure force and density change rate as the full neighbor list.
+ */
+#include "sphinxsys_ck.h"
+#include <gtest/gtest.h>
+using namespace SPH;
+//----------------------------------------------------------------------
+//	Basic geometry parameters and numerical setup.
+//----------------------------------------------------------------------
+Real DL = 1.0;
+Real DH = 0.5;
+Real particle_spacing = 0.02;
+Real BW = particle_spacing * 4;
+Real rho0_f = 1.0;
+Real c_f = 10.0;
+
+TEST(HalfNeighborList, AcousticStep1stHalf)
+{
+    BoundingBox system_domain_bounds(Vec2d(-BW, -BW), Vec2d(DL + BW, DH + BW));
+    SPHSystem sph_system(system_domain_bounds, particle_spacing);
+
+    TransformShape<GeometricShapeBox> water_shape(Transform(0.5 * Vec2d(DL, DH)), 0.5 * Vec2d(DL, DH), "WaterBody");
+    FluidBody water_block(sph_system, water_shape);
+    water_block.defineMaterial<WeaklyCompressibleFluid>(rho0_f, c_f);
+    water_block.generateParticles<BaseParticles, Lattice>();
+
+    Relation<Inner<>> water_inner(water_block);
+    using MainExecutionPolicy = execution::ParallelPolicy;
+    UpdateCellLinkedList<MainExecutionPolicy, CellLinkedList> water_cell_linked_list(water_block);
+    UpdateRelation<MainExecutionPolicy, Inner<>> water_inner_update(water_inner);
+    StateDynamics<MainExecutionPolicy, fluid_dynamics::AdvectionStepSetup> water_advection_step_setup(water_block);
+    InteractionDynamicsCK<MainExecutionPolicy, fluid_dynamics::AcousticStep1stHalf<
+                                                   Inner<OneLevel, AcousticRiemannSolver, NoKernelCorrectionCK>>>
+        full_pressure_relaxation(water_inner);
+    InteractionDynamicsCK<MainExecutionPolicy, fluid_dynamics::AcousticStep1stHalf<
+                                                   Inner<OneLevel, Symmetric, AcousticRiemannSolver, NoKernelCorrectionCK>>>
+        half_pressure_relaxation(water_inner);
+
+    /** perturb the lattice and the density so that the pair values are not regular. */
+    BaseParticles &water_particles = water_block.getBaseParticles();
+    size_t total_real_particles = water_particles.TotalRealParticles();
+    Vecd *pos = water_particles.ParticlePositions();
+    Real *rho = water_particles.getVariableDataByName<Real>("Density");
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        pos[i] += 0.2 * particle_spacing * Vecd(rand_uniform(-1.0, 1.0), rand_uniform(-1.0, 1.0));
+        rho[i] = rho0_f * (1.0 + 0.01 * rand_uniform(-1.0, 1.0));
+    }
+
+    water_cell_linked_list.exec();
+    water_inner_update.exec();
+    water_advection_step_setup.exec();
+
+    // with zero time step, the density, the position and the velocity are not changed
+    Vecd *force = water_particles.getVariableDataByName<Vecd>("Force");
+    Real *drho_dt = water_particles.getVariableDataByName<Real>("DensityChangeRate");
+    // the force is accumulated by the interaction, therefore, it is reset before each run
+    std::fill(force, force + total_real_particles, Vecd::Zero());
+    full_pressure_relaxation.exec(0.0);
+    StdVec<Vecd> full_force(force, force + total_real_particles);
+    StdVec<Real> full_drho_dt(drho_dt, drho_dt + total_real_particles);
+    std::fill(force, force + total_real_particles, Vecd::Zero());
+    half_pressure_relaxation.exec(0.0);
+
+    Real force_scale(0), drho_dt_scale(0);
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        force_scale = SMAX(force_scale, full_force[i].norm());
+        drho_dt_scale = SMAX(drho_dt_scale, ABS(full_drho_dt[i]));
+    }
+    ASSERT_GT(force_scale, 0.0);
+    ASSERT_GT(drho_dt_scale, 0.0);
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        EXPECT_LT((force[i] - full_force[i]).norm(), 1.0e-10 * force_scale);
+        EXPECT_NEAR(drho_dt[i], full_drho_dt[i], 1.0e-10 * drho_dt_scale);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,110 @@
+/**
+ * @file 	test_neighbor_list_blocks.cpp
+ * @brief 	test that the neighbor lists built by blocks with a single neighbor search
+ *          are the same as those obtained by counting the neighbors and then filling the lists,
+ *          also when the lists are rebuilt with the kept block buffers.
+ */
+#include "sphinxsys_ck.h"
+#include <gtest/gtest.h>
+using namespace SPH;
+//----------------------------------------------------------------------
+//	Basic geometry parameters and numerical setup.
+//----------------------------------------------------------------------
+Real DL = 1.0;
+Real DH = 0.5;
+Real particle_spacing = 0.02;
+Real BW = particle_spacing * 4;
+
+class NeighborListBlocksTest : public testing::Test
+{
+  protected:
+    NeighborListBlocksTest()
+        : sph_system_(BoundingBox(Vec2d(-BW, -BW), Vec2d(DL + BW, DH + BW)), particle_spacing),
+          water_shape_(Transform(0.5 * Vec2d(DL, DH)), 0.5 * Vec2d(DL, DH), "WaterBody"),
+          water_block_(sph_system_, water_shape_)
+    {
+        water_block_.defineMaterial<WeaklyCompressibleFluid>(1.0, 10.0);
+        water_block_.generateParticles<BaseParticles, Lattice>();
+    };
+
+    SPHSystem sph_system_;
+    TransformShape<GeometricShapeBox> water_shape_;
+    FluidBody water_block_;
+};
+/** The neighbor lists obtained by counting all pairs within the cut radius and then filling. */
+void countThenFill(Vecd *pos, size_t total_real_particles, Real cut_radius,
+                   StdVec<UnsignedInt> &particle_offset, StdVec<UnsignedInt> &neighbor_index)
+{
+    Real cut_radius_square = pow(cut_radius, 2);
+    particle_offset.assign(total_real_particles + 1, 0);
+    for (size_t i = 0; i != total_real_particles; ++i)
+        for (size_t j = 0; j != total_real_particles; ++j)
+            if (i != j && (pos[j] - pos[i]).squaredNorm() < cut_radius_square)
+                particle_offset[i + 1]++;
+
+    for (size_t i = 0; i != total_real_particles; ++i)
+        particle_offset[i + 1] += particle_offset[i];
+
+    neighbor_index.resize(particle_offset[total_real_particles]);
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        UnsignedInt n = particle_offset[i];
+        for (size_t j = 0; j != total_real_particles; ++j)
+            if (i != j && (pos[j] - pos[i]).squaredNorm() < cut_radius_square)
+                neighbor_index[n++] = j;
+    }
+}
+
+template <class ExecutionPolicy>
+void testNeighborListBlocks(FluidBody &water_block)
+{
+    Relation<Inner<>> water_inner(water_block);
+    UpdateCellLinkedList<ExecutionPolicy, CellLinkedList> water_cell_linked_list(water_block);
+    UpdateRelation<ExecutionPolicy, Inner<>> water_inner_update(water_inner);
+
+    BaseParticles &water_particles = water_block.getBaseParticles();
+    size_t total_real_particles = water_particles.TotalRealParticles();
+    Vecd *pos = water_particles.ParticlePositions();
+    Real cut_radius = water_block.getSPHAdaptation().getKernel()->CutOffRadius();
+    StdVec<UnsignedInt> reference_offset, reference_index;
+    for (size_t build = 0; build != 3; ++build)
+    {
+        // random moves so that the rebuilt lists differ from the previous ones
+        for (size_t i = 0; i != total_real_particles; ++i)
+            pos[i] += 0.2 * particle_spacing * Vecd(rand_uniform(-1.0, 1.0), rand_uniform(-1.0, 1.0));
+
+        water_cell_linked_list.exec();
+        water_inner_update.exec();
+        countThenFill(pos, total_real_particles, cut_radius, reference_offset, reference_index);
+
+        UnsignedInt *neighbor_index = water_inner.getNeighborIndex()->Data();
+        UnsignedInt *particle_offset = water_inner.getParticleOffset()->Data();
+        ASSERT_EQ(particle_offset[total_real_particles], reference_offset[total_real_particles]);
+        for (size_t i = 0; i != total_real_particles; ++i)
+        {
+            ASSERT_EQ(particle_offset[i], reference_offset[i]) << "particle " << i << " at build " << build;
+            StdVec<UnsignedInt> neighbors(neighbor_index + particle_offset[i],
+                                          neighbor_index + particle_offset[i + 1]);
+            std::sort(neighbors.begin(), neighbors.end());
+            StdVec<UnsignedInt> reference_neighbors(reference_index.begin() + reference_offset[i],
+                                                    reference_index.begin() + reference_offset[i + 1]);
+            EXPECT_EQ(neighbors, reference_neighbors) << "particle " << i << " at build " << build;
+        }
+    }
+}
+
+TEST_F(NeighborListBlocksTest, SequencedSameAsCountThenFill)
+{
+    testNeighborListBlocks<execution::SequencedPolicy>(water_block_);
+}
+
+TEST_F(NeighborListBlocksTest, ParallelSameAsCountThenFill)
+{
+    testNeighborListBlocks<execution::ParallelPolicy>(water_block_);
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,121 @@
+/**
+ * @file 	test_neighbor_skin.cpp
+ * @brief 	test that the neighbor list built with a skin and reused between builds
+ *          gives the same neighbors and neighbor sums as the list rebuilt at each step,
+ *          and that the rebuild is triggered when a displacement reaches half skin.
+ */
+#include "sphinxsys_ck.h"
+#include <gtest/gtest.h>
+using namespace SPH;
+//----------------------------------------------------------------------
+//	Basic geometry parameters and numerical setup.
+//----------------------------------------------------------------------
+Real DL = 1.0;
+Real DH = 0.5;
+Real particle_spacing = 0.02;
+Real BW = particle_spacing * 4;
+Real skin = 0.4 * particle_spacing;
+using MainExecutionPolicy = execution::ParallelPolicy;
+
+class NeighborSkinTest : public testing::Test
+{
+  protected:
+    NeighborSkinTest()
+        : sph_system_(BoundingBox(Vec2d(-BW, -BW), Vec2d(DL + BW, DH + BW)), particle_spacing),
+          water_shape_(Transform(0.5 * Vec2d(DL, DH)), 0.5 * Vec2d(DL, DH), "WaterBody"),
+          water_block_(sph_system_, water_shape_)
+    {
+        water_block_.defineMaterial<WeaklyCompressibleFluid>(1.0, 10.0);
+        water_block_.generateParticles<BaseParticles, Lattice>();
+    };
+
+    SPHSystem sph_system_;
+    TransformShape<GeometricShapeBox> water_shape_;
+    FluidBody water_block_;
+};
+
+StdVec<UnsignedInt> sortedNeighbors(Relation<Inner<>> &inner_relation, size_t index_i)
+{
+    UnsignedInt *neighbor_index = inner_relation.getNeighborIndex()->Data();
+    UnsignedInt *particle_offset = inner_relation.getParticleOffset()->Data();
+    StdVec<UnsignedInt> neighbors(neighbor_index + particle_offset[index_i],
+                                  neighbor_index + particle_offset[index_i + 1]);
+    std::sort(neighbors.begin(), neighbors.end());
+    return neighbors;
+}
+
+TEST_F(NeighborSkinTest, ReusedListSameAsRebuild)
+{
+    Relation<Inner<>> full_inner(water_block_);
+    Relation<Inner<>> skin_inner(water_block_);
+    UpdateCellLinkedList<MainExecutionPolicy, CellLinkedList> water_cell_linked_list(water_block_);
+    UpdateRelation<MainExecutionPolicy, Inner<>> full_inner_update(full_inner);
+    UpdateRelation<MainExecutionPolicy, Inner<>> skin_inner_update(skin_inner);
+    skin_inner_update.setNeighborSkin(skin);
+
+    BaseParticles &water_particles = water_block_.getBaseParticles();
+    size_t total_real_particles = water_particles.TotalRealParticles();
+    Vecd *pos = water_particles.ParticlePositions();
+    KernelWendlandC2CK kernel(*water_block_.getSPHAdaptation().getKernel());
+    for (size_t step = 0; step != 10; ++step)
+    {
+        // small random moves so that the list built with skin is reused for several steps
+        for (size_t i = 0; i != total_real_particles; ++i)
+            pos[i] += 0.05 * particle_spacing * Vecd(rand_uniform(-1.0, 1.0), rand_uniform(-1.0, 1.0));
+
+        water_cell_linked_list.exec();
+        full_inner_update.exec();
+        skin_inner_update.exec();
+
+        for (size_t i = 0; i != total_real_particles; ++i)
+        {
+            StdVec<UnsignedInt> full_neighbors = sortedNeighbors(full_inner, i);
+            StdVec<UnsignedInt> skin_neighbors = sortedNeighbors(skin_inner, i);
+            ASSERT_EQ(full_neighbors, skin_neighbors) << "particle " << i << " at step " << step;
+
+            Real full_sum(0), skin_sum(0);
+            for (size_t n = 0; n != full_neighbors.size(); ++n)
+                full_sum += kernel.W(Vecd(pos[i] - pos[full_neighbors[n]]));
+            UnsignedInt *neighbor_index = skin_inner.getNeighborIndex()->Data();
+            UnsignedInt *particle_offset = skin_inner.getParticleOffset()->Data();
+            for (UnsignedInt n = particle_offset[i]; n != particle_offset[i + 1]; ++n)
+                skin_sum += kernel.W(Vecd(pos[i] - pos[neighbor_index[n]]));
+            EXPECT_NEAR(full_sum, skin_sum, 1.0e-10 * full_sum);
+        }
+    }
+    // the list built with skin is reused for some of the steps
+    EXPECT_LT(skin_inner_update.getNeighborSkin().NumberOfBuilds(), size_t(10));
+}
+
+TEST_F(NeighborSkinTest, RebuildAtHalfSkin)
+{
+    Relation<Inner<>> water_inner(water_block_);
+    UpdateCellLinkedList<MainExecutionPolicy, CellLinkedList> water_cell_linked_list(water_block_);
+    UpdateRelation<MainExecutionPolicy, Inner<>> water_inner_update(water_inner);
+    water_inner_update.setNeighborSkin(skin);
+    NeighborSkin<MainExecutionPolicy> &neighbor_skin = water_inner_update.getNeighborSkin();
+
+    water_cell_linked_list.exec();
+    water_inner_update.exec();
+    ASSERT_EQ(neighbor_skin.NumberOfBuilds(), size_t(1));
+
+    Vecd *pos = water_block_.getBaseParticles().ParticlePositions();
+    size_t moved_particle = water_block_.getBaseParticles().TotalRealParticles() / 2;
+    pos[moved_particle] += 0.45 * skin * Vecd(1.0, 0.0);
+    water_cell_linked_list.exec();
+    water_inner_update.exec();
+    EXPECT_NEAR(neighbor_skin.MaxDisplacement(), 0.45 * skin, 1.0e-10 * skin);
+    EXPECT_EQ(neighbor_skin.NumberOfBuilds(), size_t(1));
+
+    pos[moved_particle] += 0.1 * skin * Vecd(1.0, 0.0);
+    water_cell_linked_list.exec();
+    water_inner_update.exec();
+    EXPECT_EQ(neighbor_skin.NumberOfBuilds(), size_t(2));
+    EXPECT_NEAR(neighbor_skin.MaxDisplacement(), 0.0, 1.0e-10 * skin);
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
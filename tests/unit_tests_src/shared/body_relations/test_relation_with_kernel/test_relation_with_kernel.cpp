@@ -0,0 +1,114 @@
+/**
+ * @file 	test_relation_with_kernel.cpp
+ * @brief 	test that the inner and contact relations built with the concrete kernels
+ *          reproduce the neighbors, W_ij and dW_ij of those built with the virtual kernels.
+ */
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+using namespace SPH;
+//----------------------------------------------------------------------
+//	Basic geometry parameters and numerical setup.
+//----------------------------------------------------------------------
+Real DL = 1.0;
+Real DH = 0.5;
+Real particle_spacing = 0.05;
+Real BW = particle_spacing * 4;
+//----------------------------------------------------------------------
+//	Compare the neighbors of a particle in the same order.
+//----------------------------------------------------------------------
+void expectSameNeighbors(const Neighborhood &virtual_kernel, const Neighborhood &concrete_kernel)
+{
+    ASSERT_EQ(virtual_kernel.current_size_, concrete_kernel.current_size_);
+    for (size_t n = 0; n != virtual_kernel.current_size_; ++n)
+    {
+        EXPECT_EQ(virtual_kernel.j_[n], concrete_kernel.j_[n]);
+        EXPECT_NEAR(virtual_kernel.W_ij_[n], concrete_kernel.W_ij_[n], 1.0e-12 * ABS(virtual_kernel.W_ij_[n]) + Eps);
+        EXPECT_NEAR(virtual_kernel.dW_ij_[n], concrete_kernel.dW_ij_[n], 1.0e-12 * ABS(virtual_kernel.dW_ij_[n]) + Eps);
+        EXPECT_NEAR(virtual_kernel.r_ij_[n], concrete_kernel.r_ij_[n], 1.0e-12 * particle_spacing);
+        EXPECT_LT((virtual_kernel.e_ij_[n] - concrete_kernel.e_ij_[n]).norm(), 1.0e-12);
+    }
+}
+//----------------------------------------------------------------------
+//	The pairs of the virtual kernels and their concrete kernels.
+//----------------------------------------------------------------------
+template <class VirtualKernelType, class ConcreteKernelType>
+struct KernelPair
+{
+    using VirtualKernel = VirtualKernelType;
+    using ConcreteKernel = ConcreteKernelType;
+};
+
+template <class KernelPairType>
+class RelationWithKernelTest : public testing::Test
+{
+  protected:
+    BoundingBox system_domain_bounds_{Vec2d(-BW, -BW), Vec2d(DL + BW, DH + BW)};
+    SPHSystem sph_system_{system_domain_bounds_, particle_spacing};
+    TransformShape<GeometricShapeBox> water_shape_{Transform(0.5 * Vec2d(DL, DH)), 0.5 * Vec2d(DL, DH), "WaterBody"};
+    TransformShape<GeometricShapeBox> wall_shape_{Transform(Vec2d(0.5 * DL, -0.5 * BW)), Vec2d(0.5 * DL + BW, 0.5 * BW), "WallBoundary"};
+    FluidBody water_block_{sph_system_, water_shape_};
+    SolidBody wall_boundary_{sph_system_, wall_shape_};
+
+    RelationWithKernelTest()
+    {
+        water_block_.getSPHAdaptation().resetKernel<typename KernelPairType::VirtualKernel>();
+        wall_boundary_.getSPHAdaptation().resetKernel<typename KernelPairType::VirtualKernel>();
+        water_block_.defineMaterial<WeaklyCompressibleFluid>(1.0, 10.0);
+        water_block_.generateParticles<BaseParticles, Lattice>();
+        wall_boundary_.defineMaterial<Solid>();
+        wall_boundary_.generateParticles<BaseParticles, Lattice>();
+        // perturbed positions so that the distances are not only those on lattice
+        BaseParticles &water_particles = water_block_.getBaseParticles();
+        Vecd *pos = water_particles.ParticlePositions();
+        for (size_t i = 0; i != water_particles.TotalRealParticles(); ++i)
+            pos[i] += 0.2 * particle_spacing * Vecd(rand_uniform(-1.0, 1.0), rand_uniform(-1.0, 1.0));
+        water_block_.updateCellLinkedList();
+        wall_boundary_.updateCellLinkedList();
+    };
+};
+
+using KernelPairs = testing::Types<KernelPair<KernelWendlandC2, KernelWendlandC2CK>,
+                                   KernelPair<KernelCubicBSpline, KernelCubicBSplineCK>,
+                                   KernelPair<KernelHyperbolic, KernelHyperbolicCK>,
+                                   KernelPair<KernelLaguerreGauss, KernelLaguerreGaussCK>>;
+TYPED_TEST_SUITE(RelationWithKernelTest, KernelPairs);
+
+TYPED_TEST(RelationWithKernelTest, InnerRelation)
+{
+    using ConcreteKernel = typename TypeParam::ConcreteKernel;
+    InnerRelation water_inner(this->water_block_);
+    InnerRelationWithKernel<ConcreteKernel> water_inner_with_kernel(this->water_block_);
+    water_inner.updateConfiguration();
+    water_inner_with_kernel.updateConfiguration();
+
+    size_t total_real_particles = this->water_block_.getBaseParticles().TotalRealParticles();
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        expectSameNeighbors(water_inner.inner_configuration_[i], water_inner_with_kernel.inner_configuration_[i]);
+    }
+}
+
+TYPED_TEST(RelationWithKernelTest, ContactRelation)
+{
+    using ConcreteKernel = typename TypeParam::ConcreteKernel;
+    ContactRelation water_contact(this->water_block_, {&this->wall_boundary_});
+    ContactRelationWithKernel<ConcreteKernel> water_contact_with_kernel(this->water_block_, {&this->wall_boundary_});
+    water_contact.updateConfiguration();
+    water_contact_with_kernel.updateConfiguration();
+
+    size_t total_real_particles = this->water_block_.getBaseParticles().TotalRealParticles();
+    size_t total_contact_neighbors = 0;
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        total_contact_neighbors += water_contact.contact_configuration_[0][i].current_size_;
+        expectSameNeighbors(water_contact.contact_configuration_[0][i],
+                            water_contact_with_kernel.contact_configuration_[0][i]);
+    }
+    EXPECT_GT(total_contact_neighbors, size_t(0));
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
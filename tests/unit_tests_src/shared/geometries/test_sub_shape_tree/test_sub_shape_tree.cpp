@@ -0,0 +1,82 @@
+/**
+ * @file 	test_sub_shape_tree.cpp
+ * @brief 	test that the queries through the bounding box tree of the sub-shapes
+ *          give the same results as visiting all sub-shapes in the order of definition.
+ */
+#include "complex_geometry.h"
+#include "geometric_shape.h"
+#include <gtest/gtest.h>
+#include <random>
+
+using namespace SPH;
+
+size_t number_of_balls = 300;
+size_t number_of_probes = 200000;
+
+template <class ShapeType>
+void addRandomBalls(ShapeType &shape, bool with_subtraction)
+{
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<Real> center_distribution(0.0, 1.0);
+    std::uniform_real_distribution<Real> radius_distribution(0.02, 0.1);
+    for (size_t n = 0; n != number_of_balls; ++n)
+    {
+        Vecd center(center_distribution(generator), center_distribution(generator), center_distribution(generator));
+        Real radius = radius_distribution(generator);
+        // every third ball is subtracted
+        if (with_subtraction && n % 3 == 2)
+        {
+            shape.template subtract<GeometricShapeBall>(center, radius);
+        }
+        else
+        {
+            shape.template add<GeometricShapeBall>(center, radius);
+        }
+    }
+}
+
+void compareWithSequentialQueries(bool with_subtraction)
+{
+    ComplexShape sequential_shape("SequentialShape");
+    addRandomBalls(sequential_shape, with_subtraction);
+    ComplexShape tree_shape("TreeShape");
+    addRandomBalls(tree_shape, with_subtraction);
+    tree_shape.buildSubShapeTree();
+
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<Real> probe_distribution(-0.1, 1.1);
+    size_t number_of_contained = 0;
+    for (size_t n = 0; n != number_of_probes; ++n)
+    {
+        Vecd probe_point(probe_distribution(generator), probe_distribution(generator), probe_distribution(generator));
+        bool is_contained = sequential_shape.checkContain(probe_point);
+        EXPECT_EQ(is_contained, tree_shape.checkContain(probe_point));
+        number_of_contained += is_contained ? 1 : 0;
+        // the closest point is compared on a subset as the sequential search is slow
+        if (n % 20 == 0)
+        {
+            Vecd sequential_closest = sequential_shape.findClosestPoint(probe_point);
+            Vecd tree_closest = tree_shape.findClosestPoint(probe_point);
+            EXPECT_LT((sequential_closest - tree_closest).norm(), Eps);
+        }
+    }
+    // the probes are required to hit both inside and outside
+    EXPECT_GT(number_of_contained, 0);
+    EXPECT_LT(number_of_contained, number_of_probes);
+}
+
+TEST(test_SubShapeTree, test_union_of_balls)
+{
+    compareWithSequentialQueries(false);
+}
+
+TEST(test_SubShapeTree, test_balls_with_subtraction)
+{
+    compareWithSequentialQueries(true);
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
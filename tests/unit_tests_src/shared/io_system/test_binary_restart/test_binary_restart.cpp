@@ -0,0 +1,111 @@
+/**
+ * @file 	test_binary_restart.cpp
+ * @brief 	test that the particle variables written to a binary restart file
+ *          are read back with the same values, that a column is only found
+ *          with its own type, and that an output file which can not be opened
+ *          is reported as an error.
+ */
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+using namespace SPH;
+//----------------------------------------------------------------------
+//	Basic geometry parameters and numerical setup.
+//----------------------------------------------------------------------
+Real DL = 1.0;
+Real DH = 0.5;
+Real particle_spacing = 0.05;
+BoundingBox system_domain_bounds(Vec2d(-0.2, -0.2), Vec2d(DL + 0.2, DH + 0.2));
+//----------------------------------------------------------------------
+//	Helper functions.
+//----------------------------------------------------------------------
+class RestartBody : public FluidBody
+{
+  public:
+    RestartBody(SPHSystem &sph_system)
+        : FluidBody(sph_system, makeShared<TransformShape<GeometricShapeBox>>(
+                                    Transform(0.5 * Vec2d(DL, DH)), 0.5 * Vec2d(DL, DH), "RestartBody"))
+    {
+        defineMaterial<WeaklyCompressibleFluid>(1.0, 10.0);
+        generateParticles<BaseParticles, Lattice>();
+        BaseParticles &base_particles = getBaseParticles();
+        base_particles.registerStateVariableOnly<Real>("TestScalar");
+        base_particles.registerStateVariableOnly<Matd>("TestMatrix");
+        base_particles.addEvolvingVariable<Real>("TestScalar");
+        base_particles.addEvolvingVariable<Matd>("TestMatrix");
+    };
+};
+//----------------------------------------------------------------------
+//	Tests.
+//----------------------------------------------------------------------
+TEST(BinaryRestart, RoundTrip)
+{
+    SPHSystem sph_system(system_domain_bounds, particle_spacing);
+    sph_system.setIOEnvironment();
+    std::string filefullpath = sph_system.getIOEnvironment().restart_folder_ + "/RestartBody_binary_restart.bin";
+
+    RestartBody written_body(sph_system);
+    BaseParticles &written_particles = written_body.getBaseParticles();
+    size_t total_real_particles = written_particles.TotalRealParticles();
+    Vecd *written_pos = written_particles.ParticlePositions();
+    Real *written_scalar = written_particles.getVariableDataByName<Real>("TestScalar");
+    Matd *written_matrix = written_particles.getVariableDataByName<Matd>("TestMatrix");
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        written_pos[i] += 0.1 * particle_spacing * Vecd(rand_uniform(-1.0, 1.0), rand_uniform(-1.0, 1.0));
+        written_scalar[i] = rand_uniform(-1.0, 1.0);
+        written_matrix[i] = Matd::Random();
+    }
+    written_particles.writeParticlesToBinaryForRestart(filefullpath);
+
+    RestartBody read_body(sph_system);
+    BaseParticles &read_particles = read_body.getBaseParticles();
+    ASSERT_EQ(size_t(read_particles.TotalRealParticles()), total_real_particles);
+    read_particles.readParticlesFromBinaryForRestart(filefullpath);
+    Vecd *read_pos = read_particles.ParticlePositions();
+    Real *read_scalar = read_particles.getVariableDataByName<Real>("TestScalar");
+    Matd *read_matrix = read_particles.getVariableDataByName<Matd>("TestMatrix");
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        EXPECT_EQ(read_pos[i], written_pos[i]);
+        EXPECT_EQ(read_scalar[i], written_scalar[i]);
+        EXPECT_EQ(read_matrix[i], written_matrix[i]);
+    }
+}
+
+TEST(BinaryColumnFile, MismatchedColumnType)
+{
+    SPHSystem sph_system(system_domain_bounds, particle_spacing);
+    sph_system.setIOEnvironment();
+    std::string filefullpath = sph_system.getIOEnvironment().restart_folder_ + "/binary_column_file.bin";
+
+    StdVec<int> integers = {-1, 0, 1};
+    BinaryColumnFile written_file;
+    written_file.addColumn<int>("Integers", integers.data(), integers.size());
+    written_file.writeToFile(filefullpath);
+
+    BinaryColumnFile read_file;
+    read_file.loadFile(filefullpath);
+    const int *read_integers = read_file.findColumnData<int>("Integers", integers.size());
+    ASSERT_NE(read_integers, nullptr);
+    EXPECT_EQ(StdVec<int>(read_integers, read_integers + integers.size()), integers);
+    /** a column with the same type size but another type is not matching */
+    EXPECT_EQ(read_file.findColumnData<UnsignedInt>("Integers", integers.size()), nullptr);
+    EXPECT_EQ(read_file.findColumnData<int>("Integers", integers.size() + 1), nullptr);
+}
+
+TEST(BinaryRestartDeathTest, UnopenableOutputFile)
+{
+    SPHSystem sph_system(system_domain_bounds, particle_spacing);
+    RestartBody test_body(sph_system);
+    BaseParticles &base_particles = test_body.getBaseParticles();
+    std::string filefullpath = "./not_existing_folder/RestartBody_binary_restart.bin";
+    EXPECT_EXIT(base_particles.writeParticlesToBinaryForRestart(filefullpath), testing::ExitedWithCode(1), "");
+}
+//----------------------------------------------------------------------
+//	Main.
+//----------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,240 @@
+/**
+ * @file 	test_vtp_output.cpp
+ * @brief 	test that the asynchronous vtp output is identical to the synchronous one,
+ *          that the synchronous ascii output keeps its original layout,
+ *          that the binary and compressed data decode to the written values,
+ *          and that the exceptions of background writing are rethrown.
+ */
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+#include <cstring>
+#ifdef ZLIB_AVAILABLE
+#include <zlib.h>
+#endif
+using namespace SPH;
+//----------------------------------------------------------------------
+//	Basic geometry parameters and numerical setup.
+//----------------------------------------------------------------------
+Real DL = 1.0;
+Real DH = 0.5;
+Real particle_spacing = 0.05;
+Real BW = particle_spacing * 4;
+//----------------------------------------------------------------------
+//	Read the whole content of a file.
+//----------------------------------------------------------------------
+std::string readFile(const std::string &filefullpath)
+{
+    std::ifstream in_file(filefullpath, std::ios::binary);
+    std::ostringstream content;
+    content << in_file.rdbuf();
+    return content.str();
+}
+//----------------------------------------------------------------------
+//	Decode a data array from the appended section of a binary or compressed vtp file.
+//----------------------------------------------------------------------
+template <typename DataType>
+StdVec<DataType> readAppendedDataArray(const std::string &content, const std::string &name)
+{
+    size_t header_begin = content.find("<DataArray Name=\"" + name + "\"");
+    size_t offset_begin = content.find("offset=\"", header_begin) + std::string("offset=\"").size();
+    const std::string section_begin = "<AppendedData encoding=\"raw\">\n_";
+    size_t appended_begin = content.find(section_begin);
+    if (header_begin == std::string::npos || appended_begin == std::string::npos)
+    {
+        ADD_FAILURE() << "the appended data array " << name << " is not found!";
+        return StdVec<DataType>();
+    }
+    size_t offset = std::stoull(content.substr(offset_begin, content.find('"', offset_begin) - offset_begin));
+    const char *data = content.data() + appended_begin + section_begin.size() + offset;
+
+    std::string bytes;
+    if (content.find("compressor=\"vtkZLibDataCompressor\"") == std::string::npos)
+    {
+        uint64_t size;
+        std::memcpy(&size, data, sizeof(uint64_t));
+        bytes.assign(data + sizeof(uint64_t), size);
+    }
+    else
+    {
+#ifdef ZLIB_AVAILABLE
+        // header: number of blocks, block size, size of the last partial block and compressed sizes
+        uint64_t header[3];
+        std::memcpy(header, data, 3 * sizeof(uint64_t));
+        StdVec<uint64_t> compressed_sizes(header[0]);
+        std::memcpy(compressed_sizes.data(), data + 3 * sizeof(uint64_t), header[0] * sizeof(uint64_t));
+        const char *block = data + (3 + header[0]) * sizeof(uint64_t);
+        for (size_t k = 0; k != header[0]; ++k)
+        {
+            uLongf block_size = (k + 1 == header[0] && header[2] != 0) ? header[2] : header[1];
+            std::string decompressed(block_size, '\0');
+            EXPECT_EQ(uncompress(reinterpret_cast<Bytef *>(&decompressed[0]), &block_size,
+                                 reinterpret_cast<const Bytef *>(block), compressed_sizes[k]),
+                      Z_OK);
+            bytes.append(decompressed, 0, block_size);
+            block += compressed_sizes[k];
+        }
+#endif
+    }
+    StdVec<DataType> values(bytes.size() / sizeof(DataType));
+    std::memcpy(values.data(), bytes.data(), values.size() * sizeof(DataType));
+    return values;
+}
+//----------------------------------------------------------------------
+//	A water block with scalar, vector, matrix and integer variables to write.
+//----------------------------------------------------------------------
+class VtpOutputTest : public testing::Test
+{
+  protected:
+    BoundingBox system_domain_bounds_{Vec2d(-BW, -BW), Vec2d(DL + BW, DH + BW)};
+    SPHSystem sph_system_{system_domain_bounds_, particle_spacing};
+    TransformShape<GeometricShapeBox> water_shape_{Transform(0.5 * Vec2d(DL, DH)), 0.5 * Vec2d(DL, DH), "WaterBody"};
+    FluidBody water_block_{sph_system_, water_shape_};
+
+    void SetUp() override
+    {
+        sph_system_.setIOEnvironment();
+        water_block_.defineMaterial<WeaklyCompressibleFluid>(1.0, 10.0);
+        water_block_.generateParticles<BaseParticles, Lattice>();
+
+        BaseParticles &particles = water_block_.getBaseParticles();
+        Real *scalar = particles.registerStateVariable<Real>("TestScalar");
+        Vecd *vector = particles.registerStateVariable<Vecd>("TestVector");
+        Matd *matrix = particles.registerStateVariable<Matd>("TestMatrix");
+        int *integer = particles.registerStateVariable<int>("TestInteger");
+        for (size_t i = 0; i != particles.TotalRealParticles(); ++i)
+        {
+            scalar[i] = 1.0 + 0.01 * rand_uniform(-1.0, 1.0);
+            vector[i] = Vecd(rand_uniform(-1.0, 1.0), rand_uniform(-1.0, 1.0));
+            matrix[i] = Matd::Random();
+            integer[i] = int(i % 3);
+        }
+        particles.addVariableToWrite<Real>("TestScalar");
+        particles.addVariableToWrite<Vecd>("TestVector");
+        particles.addVariableToWrite<Matd>("TestMatrix");
+        particles.addVariableToWrite<int>("TestInteger");
+    };
+
+    std::string outputFile(size_t iteration_step)
+    {
+        std::ostringstream sequence;
+        sequence << std::setw(10) << std::setfill('0') << iteration_step;
+        return sph_system_.getIOEnvironment().output_folder_ + "/" +
+               water_block_.getName() + "_" + sequence.str() + ".vtp";
+    };
+};
+
+TEST_F(VtpOutputTest, AsynchronousSameAsSynchronous)
+{
+    StdVec<VtkDataFormat> data_formats = {VtkDataFormat::ascii, VtkDataFormat::binary, VtkDataFormat::compressed};
+    for (size_t k = 0; k != data_formats.size(); ++k)
+    {
+        BodyStatesRecordingToVtp synchronous_recording(water_block_);
+        synchronous_recording.setDataFormat(data_formats[k]);
+        water_block_.setNewlyUpdated();
+        synchronous_recording.writeToFile(2 * k);
+
+        BodyStatesRecordingToVtp asynchronous_recording(water_block_);
+        asynchronous_recording.setDataFormat(data_formats[k]);
+        asynchronous_recording.setAsynchronous();
+        water_block_.setNewlyUpdated();
+        asynchronous_recording.writeToFile(2 * k + 1);
+        asynchronous_recording.flush();
+
+        std::string synchronous_content = readFile(outputFile(2 * k));
+        EXPECT_FALSE(synchronous_content.empty());
+        EXPECT_TRUE(synchronous_content == readFile(outputFile(2 * k + 1)));
+    }
+}
+
+TEST_F(VtpOutputTest, AsciiLayoutUnchanged)
+{
+    BodyStatesRecordingToVtp recording(water_block_);
+    water_block_.setNewlyUpdated();
+    recording.writeToFile(0);
+    std::string content = readFile(outputFile(0));
+
+    EXPECT_NE(content.find("<VTKFile type=\"PolyData\" version=\"0.1\" byte_order=\"LittleEndian\">\n"), std::string::npos);
+    EXPECT_NE(content.find("    <DataArray Name=\"Position\" type=\"Float32\"  NumberOfComponents=\"3\" Format=\"ascii\">\n"),
+              std::string::npos);
+    EXPECT_NE(content.find("    <DataArray Name=\"TestMatrix\" type= \"Float32\"  NumberOfComponents=\"9\" Format=\"ascii\">\n"),
+              std::string::npos);
+    EXPECT_NE(content.find("    <DataArray type=\"Int32\"  Name=\"connectivity\"  Format=\"ascii\">\n"), std::string::npos);
+    EXPECT_EQ(content.find("Float64"), std::string::npos);
+
+    /** the scalars are written in fixed-point notation with 9 digits */
+    Real *scalar = water_block_.getBaseParticles().getVariableDataByName<Real>("TestScalar");
+    std::ostringstream first_scalar;
+    first_scalar << std::fixed << std::setprecision(9) << scalar[0] << " ";
+    size_t scalar_header = content.find("<DataArray Name=\"TestScalar\" type=\"Float32\" Format=\"ascii\">\n    ");
+    ASSERT_NE(scalar_header, std::string::npos);
+    size_t scalar_begin = content.find(">\n    ", scalar_header) + 6;
+    EXPECT_EQ(content.substr(scalar_begin, first_scalar.str().size()), first_scalar.str());
+}
+
+TEST_F(VtpOutputTest, DecodeAppendedData)
+{
+    BaseParticles &particles = water_block_.getBaseParticles();
+    size_t total_real_particles = particles.TotalRealParticles();
+    Vecd *pos = particles.ParticlePositions();
+    Real *scalar = particles.getVariableDataByName<Real>("TestScalar");
+    Vecd *vector = particles.getVariableDataByName<Vecd>("TestVector");
+    Matd *matrix = particles.getVariableDataByName<Matd>("TestMatrix");
+    int *integer = particles.getVariableDataByName<int>("TestInteger");
+
+    StdVec<VtkDataFormat> data_formats = {VtkDataFormat::binary, VtkDataFormat::compressed};
+    for (size_t k = 0; k != data_formats.size(); ++k)
+    {
+        BodyStatesRecordingToVtp recording(water_block_);
+        recording.setDataFormat(data_formats[k]);
+        water_block_.setNewlyUpdated();
+        recording.writeToFile(k);
+        std::string content = readFile(outputFile(k));
+
+        StdVec<float> position_values = readAppendedDataArray<float>(content, "Position");
+        StdVec<float> scalar_values = readAppendedDataArray<float>(content, "TestScalar");
+        StdVec<float> vector_values = readAppendedDataArray<float>(content, "TestVector");
+        StdVec<float> matrix_values = readAppendedDataArray<float>(content, "TestMatrix");
+        StdVec<int32_t> integer_values = readAppendedDataArray<int32_t>(content, "TestInteger");
+        ASSERT_EQ(position_values.size(), 3 * total_real_particles);
+        ASSERT_EQ(scalar_values.size(), total_real_particles);
+        ASSERT_EQ(vector_values.size(), 3 * total_real_particles);
+        ASSERT_EQ(matrix_values.size(), 9 * total_real_particles);
+        ASSERT_EQ(integer_values.size(), total_real_particles);
+        for (size_t i = 0; i != total_real_particles; ++i)
+        {
+            Vec3d position = upgradeToVec3d(pos[i]);
+            Vec3d vector_value = upgradeToVec3d(vector[i]);
+            Mat3d matrix_value = upgradeToMat3d(matrix[i]);
+            for (int m = 0; m != 3; ++m)
+            {
+                EXPECT_EQ(position_values[3 * i + m], float(position[m]));
+                EXPECT_EQ(vector_values[3 * i + m], float(vector_value[m]));
+                for (int n = 0; n != 3; ++n)
+                {
+                    EXPECT_EQ(matrix_values[9 * i + 3 * m + n], float(matrix_value(n, m)));
+                }
+            }
+            EXPECT_EQ(scalar_values[i], float(scalar[i]));
+            EXPECT_EQ(integer_values[i], integer[i]);
+        }
+    }
+}
+
+TEST(BackgroundWriter, RethrowOnFlush)
+{
+    BackgroundWriter background_writer(2);
+    bool is_written = false;
+    background_writer.push([]()
+                           { throw std::runtime_error("failed writing"); });
+    background_writer.push([&]()
+                           { is_written = true; });
+    EXPECT_THROW(background_writer.flush(), std::runtime_error);
+    EXPECT_TRUE(is_written);
+    EXPECT_NO_THROW(background_writer.flush());
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
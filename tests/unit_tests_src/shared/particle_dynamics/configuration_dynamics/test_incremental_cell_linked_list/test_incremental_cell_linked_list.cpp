@@ -0,0 +1,142 @@
+/**
+ * @file 	test_incremental_cell_linked_list.cpp
+ * @brief 	test that the incremental update of the cell linked list gives
+ *          the same particles in each cell as the full rebuild after random moves.
+ */
+#include "sphinxsys_ck.h"
+#include <gtest/gtest.h>
+using namespace SPH;
+//----------------------------------------------------------------------
+//	Basic geometry parameters and numerical setup.
+//----------------------------------------------------------------------
+Real DL = 1.0;
+Real DH = 0.5;
+Real particle_spacing = 0.02;
+Real BW = particle_spacing * 4;
+//----------------------------------------------------------------------
+//	The sorted particles of each cell, independent of their order in the cell.
+//----------------------------------------------------------------------
+StdVec<StdVec<UnsignedInt>> particlesInCells(RealBody &real_body)
+{
+    CellLinkedList &cell_linked_list = DynamicCast<CellLinkedList>(&real_body, real_body.getCellLinkedList());
+    UnsignedInt *particle_index = cell_linked_list.getParticleIndex()->Data();
+    UnsignedInt *cell_offset = cell_linked_list.getCellOffset()->Data();
+    StdVec<StdVec<UnsignedInt>> particles_in_cells(cell_linked_list.getCellOffsetListSize() - 1);
+    for (size_t k = 0; k != particles_in_cells.size(); ++k)
+    {
+        particles_in_cells[k].assign(particle_index + cell_offset[k], particle_index + cell_offset[k + 1]);
+        std::sort(particles_in_cells[k].begin(), particles_in_cells[k].end());
+    }
+    return particles_in_cells;
+}
+//----------------------------------------------------------------------
+//	Random moves applied identically to the particles of both bodies.
+//----------------------------------------------------------------------
+void moveParticles(BaseParticles &incremental_particles, BaseParticles &full_particles,
+                   Real fraction, Real max_displacement)
+{
+    Vecd *incremental_pos = incremental_particles.ParticlePositions();
+    Vecd *full_pos = full_particles.ParticlePositions();
+    for (size_t i = 0; i != incremental_particles.TotalRealParticles(); ++i)
+    {
+        if (rand_uniform(0.0, 1.0) < fraction)
+        {
+            Vecd new_pos = incremental_pos[i] +
+                           max_displacement * Vecd(rand_uniform(-1.0, 1.0), rand_uniform(-1.0, 1.0));
+            new_pos = new_pos.cwiseMax(Vecd::Zero()).cwiseMin(Vecd(DL, DH));
+            incremental_pos[i] = new_pos;
+            full_pos[i] = new_pos;
+        }
+    }
+}
+/** exchange the positions of random particle pairs, so that each cell keeps its size */
+void swapParticles(BaseParticles &incremental_particles, BaseParticles &full_particles, size_t number_of_swaps)
+{
+    Vecd *incremental_pos = incremental_particles.ParticlePositions();
+    Vecd *full_pos = full_particles.ParticlePositions();
+    size_t total_real_particles = incremental_particles.TotalRealParticles();
+    for (size_t n = 0; n != number_of_swaps; ++n)
+    {
+        size_t i = SMIN(size_t(rand_uniform(0.0, 1.0) * Real(total_real_particles)), total_real_particles - 1);
+        size_t j = SMIN(size_t(rand_uniform(0.0, 1.0) * Real(total_real_particles)), total_real_particles - 1);
+        std::swap(incremental_pos[i], incremental_pos[j]);
+        std::swap(full_pos[i], full_pos[j]);
+    }
+}
+
+template <class ExecutionPolicy>
+void testIncrementalUpdate()
+{
+    BoundingBox system_domain_bounds(Vec2d(-BW, -BW), Vec2d(DL + BW, DH + BW));
+    SPHSystem sph_system(system_domain_bounds, particle_spacing);
+
+    TransformShape<GeometricShapeBox> incremental_shape(Transform(0.5 * Vec2d(DL, DH)), 0.5 * Vec2d(DL, DH), "IncrementalBody");
+    FluidBody incremental_body(sph_system, incremental_shape);
+    incremental_body.defineMaterial<WeaklyCompressibleFluid>(1.0, 10.0);
+    incremental_body.generateParticles<BaseParticles, Lattice>();
+
+    TransformShape<GeometricShapeBox> full_shape(Transform(0.5 * Vec2d(DL, DH)), 0.5 * Vec2d(DL, DH), "FullBody");
+    FluidBody full_body(sph_system, full_shape);
+    full_body.defineMaterial<WeaklyCompressibleFluid>(1.0, 10.0);
+    full_body.generateParticles<BaseParticles, Lattice>();
+
+    UpdateCellLinkedListIncrementally<ExecutionPolicy, CellLinkedList> incremental_cell_linked_list(incremental_body);
+    UpdateCellLinkedList<ExecutionPolicy, CellLinkedList> full_cell_linked_list(full_body);
+
+    BaseParticles &incremental_particles = incremental_body.getBaseParticles();
+    BaseParticles &full_particles = full_body.getBaseParticles();
+    ASSERT_EQ(incremental_particles.TotalRealParticles(), full_particles.TotalRealParticles());
+    size_t total_real_particles = incremental_particles.TotalRealParticles();
+
+    auto update_and_compare = [&]()
+    {
+        incremental_cell_linked_list.exec();
+        full_cell_linked_list.exec();
+        EXPECT_EQ(particlesInCells(incremental_body), particlesInCells(full_body));
+    };
+
+    update_and_compare(); // the first update builds the whole list
+    EXPECT_EQ(incremental_cell_linked_list.NumberOfMovedParticles(), UnsignedInt(total_real_particles));
+
+    update_and_compare(); // nothing has moved
+    EXPECT_EQ(incremental_cell_linked_list.NumberOfMovedParticles(), UnsignedInt(0));
+
+    for (size_t step = 0; step != 10; ++step)
+    {
+        moveParticles(incremental_particles, full_particles, 0.05, 2.0 * particle_spacing);
+        update_and_compare();
+        EXPECT_GT(incremental_cell_linked_list.NumberOfMovedParticles(), UnsignedInt(0));
+    }
+
+    for (size_t step = 0; step != 5; ++step)
+    {
+        swapParticles(incremental_particles, full_particles, total_real_particles / 50);
+        update_and_compare();
+    }
+
+    // more moved particles than the rebuild ratio
+    moveParticles(incremental_particles, full_particles, 1.0, 4.0 * particle_spacing);
+    update_and_compare();
+
+    for (size_t step = 0; step != 10; ++step)
+    {
+        moveParticles(incremental_particles, full_particles, 0.05, 2.0 * particle_spacing);
+        update_and_compare();
+    }
+}
+
+TEST(UpdateCellLinkedListIncrementally, SequencedPolicy)
+{
+    testIncrementalUpdate<execution::SequencedPolicy>();
+}
+
+TEST(UpdateCellLinkedListIncrementally, ParallelPolicy)
+{
+    testIncrementalUpdate<execution::ParallelPolicy>();
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,122 @@
+/**
+ * @file 	test_radix_sort.cpp
+ * @brief 	test that the radix sort gives the same keys and index permutation as std::stable_sort
+ *          for random keys, keys with many duplicates and keys using the highest bits only.
+ */
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+#include <random>
+using namespace SPH;
+//----------------------------------------------------------------------
+//	Basic geometry parameters and numerical setup.
+//----------------------------------------------------------------------
+Real DL = 1.2;
+Real DH = 1.0;
+Real particle_spacing = 0.01; // more particles than a block of the radix sort
+BoundingBox system_domain_bounds(Vec2d::Zero(), Vec2d(DL, DH));
+constexpr UnsignedInt key_bits = sizeof(UnsignedInt) * 8;
+//----------------------------------------------------------------------
+//	Test fixture.
+//----------------------------------------------------------------------
+class RadixSortTest : public ::testing::Test
+{
+  protected:
+    SPHSystem sph_system_{system_domain_bounds, particle_spacing};
+    FluidBody body_{sph_system_, makeShared<TransformShape<GeometricShapeBox>>(
+                                     Transform(0.5 * Vec2d(DL, DH)), 0.5 * Vec2d(DL, DH), "Body")};
+    std::mt19937_64 random_engine_{12345};
+
+    void SetUp() override
+    {
+        body_.defineMaterial<WeaklyCompressibleFluid>(1.0, 10.0);
+        body_.generateParticles<BaseParticles, Lattice>();
+    };
+
+    template <typename KeyFunction>
+    StdVec<UnsignedInt> generateKeys(const KeyFunction &key_function)
+    {
+        std::uniform_int_distribution<UnsignedInt> distribution(0, std::numeric_limits<UnsignedInt>::max());
+        StdVec<UnsignedInt> keys(body_.getBaseParticles().TotalRealParticles());
+        for (UnsignedInt &key : keys)
+        {
+            key = key_function(distribution(random_engine_));
+        }
+        return keys;
+    };
+
+    template <class ExecutionPolicy>
+    void compareWithStableSort(const ExecutionPolicy &ex_policy, const StdVec<UnsignedInt> &keys)
+    {
+        BaseParticles &base_particles = body_.getBaseParticles();
+        size_t total_real_particles = base_particles.TotalRealParticles();
+        ASSERT_GT(total_real_particles, size_t(4096));
+
+        DiscreteVariable<UnsignedInt> dv_sequence("Sequence", total_real_particles);
+        DiscreteVariable<UnsignedInt> dv_index_permutation("IndexPermutation", total_real_particles);
+        UnsignedInt *sequence = dv_sequence.Data();
+        UnsignedInt *index_permutation = dv_index_permutation.Data();
+        for (size_t i = 0; i != total_real_particles; ++i)
+        {
+            sequence[i] = keys[i];
+            index_permutation[i] = i;
+        }
+        RadixSort radix_sort(ex_policy, &dv_sequence, &dv_index_permutation);
+        radix_sort.sort(ex_policy, &base_particles);
+
+        StdVec<UnsignedInt> reference_permutation(total_real_particles);
+        std::iota(reference_permutation.begin(), reference_permutation.end(), UnsignedInt(0));
+        std::stable_sort(reference_permutation.begin(), reference_permutation.end(),
+                         [&](UnsignedInt a, UnsignedInt b)
+                         { return keys[a] < keys[b]; });
+
+        for (size_t i = 0; i != total_real_particles; ++i)
+        {
+            EXPECT_EQ(sequence[i], keys[reference_permutation[i]]);
+            EXPECT_EQ(index_permutation[i], reference_permutation[i]);
+        }
+    };
+
+    void compareWithStableSort(const StdVec<UnsignedInt> &keys)
+    {
+        compareWithStableSort(seq, keys);
+        compareWithStableSort(par, keys);
+    };
+};
+//----------------------------------------------------------------------
+//	Tests.
+//----------------------------------------------------------------------
+TEST_F(RadixSortTest, RandomKeys)
+{
+    compareWithStableSort(generateKeys([](UnsignedInt random)
+                                       { return random; }));
+}
+
+TEST_F(RadixSortTest, DuplicatedKeys)
+{
+    compareWithStableSort(generateKeys([](UnsignedInt random)
+                                       { return random % 16; }));
+}
+
+TEST_F(RadixSortTest, HighestBitKeys)
+{
+    compareWithStableSort(generateKeys([](UnsignedInt random)
+                                       { return (random % 4) << (key_bits - 2); }));
+}
+
+TEST_F(RadixSortTest, SortedAndEqualKeys)
+{
+    compareWithStableSort(generateKeys([](UnsignedInt random)
+                                       { return UnsignedInt(0); }));
+    StdVec<UnsignedInt> sorted_keys = generateKeys([](UnsignedInt random)
+                                                   { return random; });
+    std::sort(sorted_keys.begin(), sorted_keys.end());
+    compareWithStableSort(sorted_keys);
+}
+//----------------------------------------------------------------------
+//	Main.
+//----------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,111 @@
+/**
+ * @file 	test_fused_update.cpp
+ * @brief 	test that the fused interaction and update sweep of the plastic acoustic step
+ *          gives the same density, stress and strain as the separate steps.
+ */
+#include "sphinxsys_ck.h"
+#include <gtest/gtest.h>
+using namespace SPH;
+//----------------------------------------------------------------------
+//	Basic geometry parameters and numerical setup.
+//----------------------------------------------------------------------
+Real LL = 0.5;
+Real LH = 0.25;
+Real particle_spacing = 0.005;
+Real BW = particle_spacing * 4;
+Real rho0_s = 2040;
+Real Youngs_modulus = 5.84e6;
+Real poisson = 0.3;
+Real c_s = sqrt(Youngs_modulus / (rho0_s * 3.0 * (1.0 - 2.0 * poisson)));
+Real friction_angle = 21.9 * Pi / 180;
+
+template <typename DataType>
+StdVec<DataType> copyVariable(BaseParticles &particles, const std::string &name)
+{
+    DataType *data = particles.getVariableDataByName<DataType>(name);
+    return StdVec<DataType>(data, data + particles.TotalRealParticles());
+}
+
+template <typename DataType>
+void restoreVariable(BaseParticles &particles, const std::string &name, const StdVec<DataType> &values)
+{
+    std::copy(values.begin(), values.end(), particles.getVariableDataByName<DataType>(name));
+}
+
+TEST(FusedUpdate, PlasticAcousticStep2ndHalf)
+{
+    BoundingBox system_domain_bounds(Vec2d(-BW, -BW), Vec2d(LL + BW, LH + BW));
+    SPHSystem sph_system(system_domain_bounds, particle_spacing);
+
+    TransformShape<GeometricShapeBox> soil_shape(Transform(0.5 * Vec2d(LL, LH)), 0.5 * Vec2d(LL, LH), "GranularBody");
+    RealBody soil_block(sph_system, soil_shape);
+    soil_block.defineMaterial<PlasticContinuum>(rho0_s, c_s, Youngs_modulus, poisson, friction_angle);
+    soil_block.generateParticles<BaseParticles, Lattice>();
+
+    using MainExecutionPolicy = execution::ParallelPolicy;
+    using PlasticAcousticStep2ndHalfInner =
+        continuum_dynamics::PlasticAcousticStep2ndHalf<Inner<OneLevel, AcousticRiemannSolver, NoKernelCorrection>>;
+    Relation<Inner<>> soil_inner(soil_block);
+    UpdateCellLinkedList<MainExecutionPolicy, CellLinkedList> soil_cell_linked_list(soil_block);
+    UpdateRelation<MainExecutionPolicy, Inner<>> soil_inner_update(soil_inner);
+    StateDynamics<MainExecutionPolicy, fluid_dynamics::AdvectionStepSetup> soil_advection_step_setup(soil_block);
+    InteractionDynamicsCK<MainExecutionPolicy, PlasticAcousticStep2ndHalfInner> separate_acoustic_step_2nd_half(soil_inner);
+    InteractionDynamicsCK<MainExecutionPolicy, PlasticAcousticStep2ndHalfInner> fused_acoustic_step_2nd_half(soil_inner);
+    fused_acoustic_step_2nd_half.enableFusedUpdate();
+
+    /** perturb the velocity and the density so that the interactions and the update are not trivial. */
+    BaseParticles &soil_particles = soil_block.getBaseParticles();
+    size_t total_real_particles = soil_particles.TotalRealParticles();
+    ASSERT_GT(total_real_particles, size_t(1024)); // the fused sweep runs over several blocks
+    Vecd *vel = soil_particles.getVariableDataByName<Vecd>("Velocity");
+    Real *rho = soil_particles.getVariableDataByName<Real>("Density");
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        vel[i] = 0.1 * c_s * Vecd(rand_uniform(-1.0, 1.0), rand_uniform(-1.0, 1.0));
+        rho[i] = rho0_s * (1.0 + 0.01 * rand_uniform(-1.0, 1.0));
+    }
+
+    soil_cell_linked_list.exec();
+    soil_inner_update.exec();
+    soil_advection_step_setup.exec();
+
+    StdVec<Real> initial_rho = copyVariable<Real>(soil_particles, "Density");
+    StdVec<Real> initial_drho_dt = copyVariable<Real>(soil_particles, "DensityChangeRate");
+    StdVec<Vecd> initial_dpos = copyVariable<Vecd>(soil_particles, "Displacement");
+    StdVec<Mat3d> initial_stress = copyVariable<Mat3d>(soil_particles, "StressTensor3D");
+    StdVec<Mat3d> initial_strain = copyVariable<Mat3d>(soil_particles, "StrainTensor3D");
+    StdVec<Mat3d> initial_stress_rate = copyVariable<Mat3d>(soil_particles, "StressRate3D");
+
+    Real dt = 0.1 * particle_spacing / c_s;
+    separate_acoustic_step_2nd_half.exec(dt);
+    StdVec<Real> separate_rho = copyVariable<Real>(soil_particles, "Density");
+    StdVec<Mat3d> separate_stress = copyVariable<Mat3d>(soil_particles, "StressTensor3D");
+    StdVec<Mat3d> separate_strain = copyVariable<Mat3d>(soil_particles, "StrainTensor3D");
+
+    restoreVariable(soil_particles, "Density", initial_rho);
+    restoreVariable(soil_particles, "DensityChangeRate", initial_drho_dt);
+    restoreVariable(soil_particles, "Displacement", initial_dpos);
+    restoreVariable(soil_particles, "StressTensor3D", initial_stress);
+    restoreVariable(soil_particles, "StrainTensor3D", initial_strain);
+    restoreVariable(soil_particles, "StressRate3D", initial_stress_rate);
+    fused_acoustic_step_2nd_half.exec(dt);
+
+    Mat3d *stress = soil_particles.getVariableDataByName<Mat3d>("StressTensor3D");
+    Mat3d *strain = soil_particles.getVariableDataByName<Mat3d>("StrainTensor3D");
+    size_t number_of_changed_particles = 0;
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        number_of_changed_particles += separate_rho[i] != initial_rho[i] ? 1 : 0;
+        // the same operations are carried out for each particle, only in a different order
+        EXPECT_EQ(rho[i], separate_rho[i]);
+        EXPECT_EQ(stress[i], separate_stress[i]);
+        EXPECT_EQ(strain[i], separate_strain[i]);
+    }
+    EXPECT_GT(number_of_changed_particles, size_t(0));
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,148 @@
+/**
+ * @file 	test_implicit_diffusion.cpp
+ * @brief 	test the implicit diffusion solvers for the steady heat conduction
+ *          in a strip between two walls, for which the temperature is linear,
+ *          and that the conjugate gradient method gives the same solution
+ *          as BiCGSTAB for non-uniform particle volume.
+ */
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+using namespace SPH;
+//----------------------------------------------------------------------
+//	Basic geometry parameters and numerical setup.
+//----------------------------------------------------------------------
+Real L = 1.0;
+Real H = 0.2;
+Real particle_spacing = 0.02;
+Real BW = particle_spacing * 4;
+BoundingBox system_domain_bounds(Vec2d(-BW, -BW), Vec2d(L + BW, H + BW));
+std::string diffusion_species_name = "Phi";
+Real diffusion_coeff = 1.0;
+Real left_temperature = 0.0;
+Real right_temperature = 1.0;
+//----------------------------------------------------------------------
+//	Linear systems.
+//----------------------------------------------------------------------
+using DiffusionLinearSystemWithWall =
+    ComplexInteraction<DiffusionLinearSystem<Inner<KernelGradientInner>, Dirichlet<KernelGradientContact>>,
+                       IsotropicDiffusion>;
+using DiffusionLinearSystemInner = DiffusionLinearSystem<Inner<KernelGradientInner>, IsotropicDiffusion>;
+//----------------------------------------------------------------------
+//	Solve the steady state and, for uniform particle volume,
+//	compare with the linear temperature.
+//----------------------------------------------------------------------
+template <class SolverType>
+StdVec<Real> solveSteadyHeatConduction(Real volume_perturbation = 0.0, size_t max_iterations = 1000)
+{
+    SPHSystem sph_system(system_domain_bounds, particle_spacing);
+    MultiPolygon strip_shape;
+    strip_shape.addABox(Transform(Vec2d(0.5 * L, 0.5 * H)), Vec2d(0.5 * L, 0.5 * H), ShapeBooleanOps::add);
+    SolidBody diffusion_body(sph_system, makeShared<MultiPolygonShape>(strip_shape, "DiffusionBody"));
+    diffusion_body.defineClosure<Solid, IsotropicDiffusion>(Solid(), ConstructArgs(diffusion_species_name, diffusion_coeff));
+    diffusion_body.generateParticles<BaseParticles, Lattice>();
+
+    MultiPolygon wall_shape;
+    wall_shape.addABox(Transform(Vec2d(-0.5 * BW, 0.5 * H)), Vec2d(0.5 * BW, 0.5 * H), ShapeBooleanOps::add);
+    wall_shape.addABox(Transform(Vec2d(L + 0.5 * BW, 0.5 * H)), Vec2d(0.5 * BW, 0.5 * H), ShapeBooleanOps::add);
+    SolidBody wall_boundary(sph_system, makeShared<MultiPolygonShape>(wall_shape, "WallBoundary"));
+    wall_boundary.defineMaterial<Solid>();
+    wall_boundary.generateParticles<BaseParticles, Lattice>();
+
+    InnerRelation diffusion_body_inner(diffusion_body);
+    ContactRelation diffusion_body_contact(diffusion_body, {&wall_boundary});
+    SolverType steady_solver(diffusion_body_inner, diffusion_body_contact);
+    Real tolerance = 1.0e-8;
+    steady_solver.setTolerance(tolerance);
+    steady_solver.setMaxIterations(max_iterations);
+
+    BaseParticles &wall_particles = wall_boundary.getBaseParticles();
+    Vecd *wall_pos = wall_particles.ParticlePositions();
+    Real *wall_phi = wall_particles.getVariableDataByName<Real>(diffusion_species_name);
+    for (size_t i = 0; i != wall_particles.TotalRealParticles(); ++i)
+    {
+        wall_phi[i] = wall_pos[i][0] < 0.0 ? left_temperature : right_temperature;
+    }
+
+    BaseParticles &particles = diffusion_body.getBaseParticles();
+    Real *Vol = particles.getVariableDataByName<Real>("VolumetricMeasure");
+    for (size_t i = 0; i != particles.TotalRealParticles(); ++i)
+    {
+        Vol[i] *= 1.0 + volume_perturbation * sin(Real(7 * i));
+    }
+
+    sph_system.initializeSystemCellLinkedLists();
+    sph_system.initializeSystemConfigurations();
+    steady_solver.exec();
+    EXPECT_LE(steady_solver.RelativeResidual(), tolerance);
+    EXPECT_LT(steady_solver.NumberOfIterations(), max_iterations);
+
+    Vecd *pos = particles.ParticlePositions();
+    Real *phi = particles.getVariableDataByName<Real>(diffusion_species_name);
+    StdVec<Real> solution(phi, phi + particles.TotalRealParticles());
+    if (volume_perturbation != 0.0)
+    {
+        return solution;
+    }
+
+    /** the wall values are taken at the wall surface, so the error is of the order of the particle spacing. */
+    Real max_error(0);
+    for (size_t i = 0; i != particles.TotalRealParticles(); ++i)
+    {
+        Real analytical = left_temperature + (right_temperature - left_temperature) * pos[i][0] / L;
+        max_error = SMAX(max_error, ABS(phi[i] - analytical));
+    }
+    EXPECT_LT(max_error, 0.1 * particle_spacing / L * (right_temperature - left_temperature));
+    return solution;
+}
+
+TEST(ImplicitDiffusion, ConjugateGradient)
+{
+    solveSteadyHeatConduction<DiffusionConjugateGradient<DiffusionLinearSystemWithWall>>();
+}
+
+TEST(ImplicitDiffusion, BiCGSTAB)
+{
+    solveSteadyHeatConduction<DiffusionBiCGSTAB<DiffusionLinearSystemWithWall>>();
+}
+
+TEST(ImplicitDiffusion, NonUniformVolume)
+{
+    /** the conjugate gradient method solves the system scaled by the particle volume, which is symmetric,
+     *  so that it converges as fast as for uniform volume, but takes about twice as many iterations otherwise. */
+    Real volume_perturbation = 0.3;
+    StdVec<Real> conjugate_gradient =
+        solveSteadyHeatConduction<DiffusionConjugateGradient<DiffusionLinearSystemWithWall>>(volume_perturbation, 150);
+    StdVec<Real> bicgstab =
+        solveSteadyHeatConduction<DiffusionBiCGSTAB<DiffusionLinearSystemWithWall>>(volume_perturbation);
+    ASSERT_EQ(conjugate_gradient.size(), bicgstab.size());
+    for (size_t i = 0; i != bicgstab.size(); ++i)
+    {
+        EXPECT_NEAR(conjugate_gradient[i], bicgstab[i], 1.0e-5 * (right_temperature - left_temperature));
+    }
+}
+
+TEST(ImplicitDiffusion, RejectSingularSteadyState)
+{
+    testing::FLAGS_gtest_death_test_style = "threadsafe";
+    SPHSystem sph_system(system_domain_bounds, particle_spacing);
+    MultiPolygon strip_shape;
+    strip_shape.addABox(Transform(Vec2d(0.5 * L, 0.5 * H)), Vec2d(0.5 * L, 0.5 * H), ShapeBooleanOps::add);
+    SolidBody diffusion_body(sph_system, makeShared<MultiPolygonShape>(strip_shape, "DiffusionBody"));
+    diffusion_body.defineClosure<Solid, IsotropicDiffusion>(Solid(), ConstructArgs(diffusion_species_name, diffusion_coeff));
+    diffusion_body.generateParticles<BaseParticles, Lattice>();
+
+    InnerRelation diffusion_body_inner(diffusion_body);
+    DiffusionConjugateGradient<DiffusionLinearSystemInner> steady_solver(diffusion_body_inner);
+    sph_system.initializeSystemCellLinkedLists();
+    sph_system.initializeSystemConfigurations();
+    /** without boundary conditions, only the implicit step with a positive time step is solvable */
+    steady_solver.exec(0.01);
+    EXPECT_LE(steady_solver.RelativeResidual(), 1.0e-6);
+    EXPECT_EXIT(steady_solver.exec(), testing::ExitedWithCode(1), "");
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
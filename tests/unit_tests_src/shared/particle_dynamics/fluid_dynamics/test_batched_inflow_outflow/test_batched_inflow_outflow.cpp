@@ -0,0 +1,165 @@
+/**
+ * @file 	test_batched_inflow_outflow.cpp
+ * @brief 	test that the batched particle injection and deletion give the same real particles
+ *          as the injection and deletion with mutex exclusion.
+ */
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+using namespace SPH;
+//----------------------------------------------------------------------
+//	Basic geometry parameters and numerical setup.
+//----------------------------------------------------------------------
+Real DL = 2.0;
+Real DH = 0.4;
+Real particle_spacing = 0.02;
+Real BW = particle_spacing * 4;
+BoundingBox system_domain_bounds(Vec2d(-BW, -BW), Vec2d(DL + BW, DH + BW));
+//----------------------------------------------------------------------
+//	A channel of water with an emitter at the inlet and a disposer at the outlet.
+//----------------------------------------------------------------------
+class WaterBlock : public FluidBody
+{
+  public:
+    WaterBlock(SPHSystem &sph_system, ParticleBuffer<ReserveSizeFactor> &particle_buffer)
+        : FluidBody(sph_system, makeShared<TransformShape<GeometricShapeBox>>(
+                                    Transform(0.5 * Vec2d(DL, DH)), 0.5 * Vec2d(DL, DH), "WaterBody"))
+    {
+        defineMaterial<WeaklyCompressibleFluid>(1.0, 10.0);
+        generateParticlesWithReserve<BaseParticles, Lattice>(particle_buffer);
+    };
+};
+
+Vec2d emitter_halfsize = Vec2d(0.5 * BW, 0.5 * DH);
+AlignedBox emitter_box(xAxis, Transform(emitter_halfsize), emitter_halfsize);
+// the particles running out are in the cells tagged near the box
+Vec2d disposer_halfsize = Vec2d(0.5 * BW, 0.5 * DH);
+AlignedBox disposer_box(xAxis, Transform(Vec2d(DL, 0.0) + Vec2d(-0.5 * BW, 0.5 * DH)), disposer_halfsize);
+
+class Channel
+{
+  public:
+    SPHSystem sph_system_;
+    ParticleBuffer<ReserveSizeFactor> inlet_particle_buffer_;
+    WaterBlock water_block_;
+    AlignedBoxPartByParticle emitter_;
+    AlignedBoxPartByCell disposer_;
+
+    Channel(const StdVec<Vecd> &displacements)
+        : sph_system_(system_domain_bounds, particle_spacing), inlet_particle_buffer_(0.5),
+          water_block_(sph_system_, inlet_particle_buffer_),
+          emitter_(water_block_, emitter_box), disposer_(water_block_, disposer_box)
+    {
+        BaseParticles &base_particles = water_block_.getBaseParticles();
+        base_particles.registerStateVariable<Real>("Pressure");
+        Vecd *vel = base_particles.registerStateVariable<Vecd>("Velocity");
+        base_particles.addEvolvingVariable<Vecd>("Velocity");
+
+        // distinct velocities to identify the copied particles
+        Vecd *pos = base_particles.ParticlePositions();
+        for (size_t i = 0; i != base_particles.TotalRealParticles(); ++i)
+        {
+            pos[i] += displacements[i];
+            vel[i] = Vecd(Real(i), -Real(i));
+        }
+        water_block_.updateCellLinkedList();
+    };
+
+    /** the real particles sorted by positions, with the indices not compared as they depend on the scheme */
+    StdVec<std::pair<Vecd, Vecd>> RealParticles()
+    {
+        BaseParticles &base_particles = water_block_.getBaseParticles();
+        Vecd *pos = base_particles.ParticlePositions();
+        Vecd *vel = base_particles.getVariableDataByName<Vecd>("Velocity");
+        StdVec<std::pair<Vecd, Vecd>> real_particles;
+        for (size_t i = 0; i != base_particles.TotalRealParticles(); ++i)
+        {
+            real_particles.emplace_back(pos[i], vel[i]);
+        }
+        std::sort(real_particles.begin(), real_particles.end(),
+                  [](const std::pair<Vecd, Vecd> &a, const std::pair<Vecd, Vecd> &b)
+                  { return std::lexicographical_compare(a.first.data(), a.first.data() + Dimensions,
+                                                        b.first.data(), b.first.data() + Dimensions); });
+        return real_particles;
+    };
+
+    void checkParticleIds()
+    {
+        BaseParticles &base_particles = water_block_.getBaseParticles();
+        UnsignedInt *original_id = base_particles.ParticleOriginalIds();
+        UnsignedInt *sorted_id = base_particles.ParticleSortedIds();
+        for (size_t i = 0; i != base_particles.TotalRealParticles(); ++i)
+        {
+            EXPECT_EQ(size_t(sorted_id[original_id[i]]), i);
+        }
+    };
+};
+
+StdVec<Vecd> randomDisplacements()
+{
+    SPHSystem sph_system(system_domain_bounds, particle_spacing);
+    ParticleBuffer<ReserveSizeFactor> particle_buffer(0.5);
+    WaterBlock water_block(sph_system, particle_buffer);
+    StdVec<Vecd> displacements;
+    for (size_t i = 0; i != water_block.getBaseParticles().TotalRealParticles(); ++i)
+    {
+        displacements.push_back(Vecd(rand_uniform(0.0, 1.5), 0.0) * particle_spacing);
+    }
+    return displacements;
+}
+
+void expectSameRealParticles(Channel &channel, Channel &reference)
+{
+    StdVec<std::pair<Vecd, Vecd>> real_particles = channel.RealParticles();
+    StdVec<std::pair<Vecd, Vecd>> reference_particles = reference.RealParticles();
+    ASSERT_EQ(real_particles.size(), reference_particles.size());
+    for (size_t i = 0; i != real_particles.size(); ++i)
+    {
+        EXPECT_EQ(real_particles[i].first, reference_particles[i].first);
+        EXPECT_EQ(real_particles[i].second, reference_particles[i].second);
+    }
+    channel.checkParticleIds();
+}
+//----------------------------------------------------------------------
+//	Tests.
+//----------------------------------------------------------------------
+TEST(BatchedInflowOutflow, Injection)
+{
+    StdVec<Vecd> displacements = randomDisplacements();
+    Channel batched_channel(displacements);
+    Channel reference_channel(displacements);
+    size_t total_real_particles = reference_channel.water_block_.getBaseParticles().TotalRealParticles();
+
+    SimpleDynamics<fluid_dynamics::BatchedEmitterInflowInjection> batched_injection(
+        batched_channel.emitter_, batched_channel.inlet_particle_buffer_);
+    SimpleDynamics<fluid_dynamics::EmitterInflowInjection> reference_injection(
+        reference_channel.emitter_, reference_channel.inlet_particle_buffer_);
+    batched_injection.exec();
+    reference_injection.exec();
+
+    EXPECT_GT(size_t(reference_channel.water_block_.getBaseParticles().TotalRealParticles()), total_real_particles);
+    expectSameRealParticles(batched_channel, reference_channel);
+}
+
+TEST(BatchedInflowOutflow, Deletion)
+{
+    StdVec<Vecd> displacements = randomDisplacements();
+    Channel batched_channel(displacements);
+    Channel reference_channel(displacements);
+    size_t total_real_particles = reference_channel.water_block_.getBaseParticles().TotalRealParticles();
+
+    SimpleDynamics<fluid_dynamics::BatchedDisposerOutflowDeletion> batched_deletion(batched_channel.disposer_);
+    SimpleDynamics<fluid_dynamics::DisposerOutflowDeletion> reference_deletion(reference_channel.disposer_);
+    batched_deletion.exec();
+    reference_deletion.exec();
+
+    EXPECT_LT(size_t(reference_channel.water_block_.getBaseParticles().TotalRealParticles()), total_real_particles);
+    expectSameRealParticles(batched_channel, reference_channel);
+}
+//----------------------------------------------------------------------
+//	Main.
+//----------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
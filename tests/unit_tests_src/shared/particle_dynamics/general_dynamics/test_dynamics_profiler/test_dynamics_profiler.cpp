@@ -0,0 +1,127 @@
+/**
+ * @file 	test_dynamics_profiler.cpp
+ * @brief 	test that the profiling records count the executions and particles of the dynamics,
+ *          that the profiling flag is cached at the first execution,
+ *          and that the reports list the records.
+ */
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+using namespace SPH;
+//----------------------------------------------------------------------
+//	Basic geometry parameters and numerical setup.
+//----------------------------------------------------------------------
+Real DL = 1.0;
+Real DH = 0.5;
+Real particle_spacing = 0.05;
+BoundingBox system_domain_bounds(Vec2d(-0.2, -0.2), Vec2d(DL + 0.2, DH + 0.2));
+//----------------------------------------------------------------------
+//	Helper classes.
+//----------------------------------------------------------------------
+class IncreaseDensity : public LocalDynamics
+{
+  public:
+    explicit IncreaseDensity(SPHBody &sph_body)
+        : LocalDynamics(sph_body), rho_(particles_->getVariableDataByName<Real>("Density")) {};
+    void update(size_t index_i, Real dt = 0.0) { rho_[index_i] += 1.0; };
+
+  protected:
+    Real *rho_;
+};
+
+class ProfilerTest : public ::testing::Test
+{
+  protected:
+    SPHSystem sph_system_{system_domain_bounds, particle_spacing};
+    FluidBody water_block_{sph_system_, makeShared<TransformShape<GeometricShapeBox>>(
+                                            Transform(0.5 * Vec2d(DL, DH)), 0.5 * Vec2d(DL, DH), "WaterBody")};
+
+    void SetUp() override
+    {
+        water_block_.defineMaterial<WeaklyCompressibleFluid>(1.0, 10.0);
+        water_block_.generateParticles<BaseParticles, Lattice>();
+    };
+};
+//----------------------------------------------------------------------
+//	Tests.
+//----------------------------------------------------------------------
+TEST_F(ProfilerTest, CountsAndReports)
+{
+    sph_system_.setIOEnvironment();
+    sph_system_.setProfiling(true);
+    size_t total_real_particles = water_block_.getBaseParticles().TotalRealParticles();
+
+    SimpleDynamics<IncreaseDensity> named_dynamics(water_block_);
+    named_dynamics.setProfilingName("NamedIncreaseDensity");
+    SimpleDynamics<IncreaseDensity> unnamed_dynamics(water_block_);
+    size_t number_of_executions = 3;
+    for (size_t k = 0; k != number_of_executions; ++k)
+    {
+        named_dynamics.exec();
+        unnamed_dynamics.exec();
+    }
+
+    DynamicsProfiler &dynamics_profiler = sph_system_.getDynamicsProfiler();
+    ProfilingRecord *record = dynamics_profiler.getRecord("WaterBody: NamedIncreaseDensity");
+    EXPECT_EQ(record->calls_, number_of_executions);
+    EXPECT_EQ(record->total_particles_, number_of_executions * total_real_particles);
+    EXPECT_GE(record->total_time_, record->max_time_);
+    EXPECT_GE(record->max_time_, 0.0);
+    EXPECT_FALSE(record->is_running_);
+
+    std::stringstream report;
+    dynamics_profiler.writeReport(report);
+    EXPECT_NE(report.str().find("WaterBody: NamedIncreaseDensity"), std::string::npos);
+    EXPECT_NE(report.str().find("WaterBody: SimpleDynamics<IncreaseDensity"), std::string::npos); // by type name
+
+    std::string json_file = sph_system_.getIOEnvironment().output_folder_ + "/test_dynamics_profiling.json";
+    dynamics_profiler.writeJsonReport(json_file);
+    std::ifstream in_file(json_file);
+    std::stringstream json;
+    json << in_file.rdbuf();
+    EXPECT_NE(json.str().find("\"name\": \"WaterBody: NamedIncreaseDensity\", \"calls\": 3"), std::string::npos);
+}
+
+TEST_F(ProfilerTest, FlagCachedAtFirstExecution)
+{
+    SimpleDynamics<IncreaseDensity> dynamics(water_block_);
+    dynamics.setProfilingName("IncreaseDensity");
+    dynamics.exec();
+
+    // enabled after the first execution, the dynamics is still not profiled
+    sph_system_.setProfiling(true);
+    dynamics.exec();
+    ProfilingRecord *record = sph_system_.getDynamicsProfiler().getRecord("WaterBody: IncreaseDensity");
+    EXPECT_EQ(record->calls_, size_t(0));
+
+    SimpleDynamics<IncreaseDensity> new_dynamics(water_block_);
+    new_dynamics.setProfilingName("IncreaseDensity");
+    new_dynamics.exec();
+    EXPECT_EQ(record->calls_, size_t(1));
+}
+
+TEST(ProfilingScope, NestedAndDeviceScopes)
+{
+    ProfilingRecord record("Record");
+    {
+        ProfilingScope outer_scope(par, &record, 10);
+        ProfilingScope inner_scope(&record, 10); // not counted again within itself
+    }
+    EXPECT_EQ(record.calls_, size_t(1));
+    EXPECT_EQ(record.total_particles_, size_t(10));
+
+    {
+        ProfilingScope device_scope(par_device, &record, 10);
+    }
+    EXPECT_EQ(record.calls_, size_t(2));
+    EXPECT_FALSE(record.is_running_);
+
+    ProfilingScope disabled_scope(par, nullptr, 10);
+}
+//----------------------------------------------------------------------
+//	Main.
+//----------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
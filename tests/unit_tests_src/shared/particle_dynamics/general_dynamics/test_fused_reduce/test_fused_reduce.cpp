@@ -0,0 +1,79 @@
+/**
+ * @file 	test_fused_reduce.cpp
+ * @brief 	test that the reduce dynamics fused in one sweep give
+ *          the same results as those carried out separately.
+ */
+#include "sphinxsys_ck.h"
+#include <gtest/gtest.h>
+using namespace SPH;
+//----------------------------------------------------------------------
+//	Basic geometry parameters and numerical setup.
+//----------------------------------------------------------------------
+Real DL = 1.0;
+Real DH = 0.5;
+Real particle_spacing = 0.01;
+Real BW = particle_spacing * 4;
+
+class FusedReduceTest : public testing::Test
+{
+  protected:
+    FusedReduceTest()
+        : sph_system_(BoundingBox(Vec2d(-BW, -BW), Vec2d(DL + BW, DH + BW)), particle_spacing),
+          water_shape_(Transform(0.5 * Vec2d(DL, DH)), 0.5 * Vec2d(DL, DH), "WaterBody"),
+          water_block_(sph_system_, water_shape_)
+    {
+        water_block_.defineMaterial<WeaklyCompressibleFluid>(1.0, 10.0);
+        water_block_.generateParticles<BaseParticles, Lattice>();
+        BaseParticles &water_particles = water_block_.getBaseParticles();
+        Vecd *vel = water_particles.registerStateVariableOnly<Vecd>("Velocity")->Data();
+        Real *rho = water_particles.getVariableDataByName<Real>("Density");
+        for (size_t i = 0; i != water_particles.TotalRealParticles(); ++i)
+        {
+            vel[i] = Vecd(rand_uniform(-1.0, 1.0), rand_uniform(-1.0, 1.0));
+            rho[i] = 1.0 + 0.01 * rand_uniform(-1.0, 1.0);
+        }
+    };
+
+    SPHSystem sph_system_;
+    TransformShape<GeometricShapeBox> water_shape_;
+    FluidBody water_block_;
+};
+
+template <class ExecutionPolicy>
+void testFusedReduce(FluidBody &water_block, Real tolerance)
+{
+    ReduceDynamicsCK<ExecutionPolicy, TotalKineticEnergyCK> kinetic_energy(water_block);
+    ReduceDynamicsCK<ExecutionPolicy, QuantityAverage<Real>> average_density(water_block, "Density");
+    ReduceDynamicsCK<ExecutionPolicy, UpperFrontInAxisDirectionCK<SPHBody>> upper_front(water_block, "UpperFront", xAxis);
+
+    TotalKineticEnergyCK kinetic_energy_to_fuse(water_block);
+    QuantityAverage<Real> average_density_to_fuse(water_block, "Density");
+    UpperFrontInAxisDirectionCK<SPHBody> upper_front_to_fuse(water_block, "UpperFront", xAxis);
+    FusedReduceDynamicsCK<ExecutionPolicy, TotalKineticEnergyCK, QuantityAverage<Real>, UpperFrontInAxisDirectionCK<SPHBody>>
+        fused_reduce(kinetic_energy_to_fuse, average_density_to_fuse, upper_front_to_fuse);
+
+    auto fused_results = fused_reduce.exec();
+    Real separate_kinetic_energy = kinetic_energy.exec();
+    EXPECT_NEAR(std::get<0>(fused_results), separate_kinetic_energy, tolerance * separate_kinetic_energy);
+    Real separate_average_density = average_density.exec();
+    EXPECT_NEAR(std::get<1>(fused_results), separate_average_density, tolerance * separate_average_density);
+    EXPECT_EQ(std::get<2>(fused_results), upper_front.exec());
+}
+
+TEST_F(FusedReduceTest, SequencedSameAsSeparate)
+{
+    // the partial results are reduced in the same order
+    testFusedReduce<execution::SequencedPolicy>(water_block_, 0.0);
+}
+
+TEST_F(FusedReduceTest, ParallelSameAsSeparate)
+{
+    // the partial results are reduced in an order depending on the task partition
+    testFusedReduce<execution::ParallelPolicy>(water_block_, 1.0e-12);
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
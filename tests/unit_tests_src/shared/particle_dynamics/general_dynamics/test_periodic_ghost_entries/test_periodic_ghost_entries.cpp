@@ -0,0 +1,139 @@
+/**
+ * @file 	test_periodic_ghost_entries.cpp
+ * @brief 	test that the periodic ghost entries inserted into the cell linked list
+ *          without mutex exclusion are the same as those inserted with mutex exclusion,
+ *          and that the insertion order in each cell is deterministic.
+ */
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+using namespace SPH;
+//----------------------------------------------------------------------
+//	Basic geometry parameters and numerical setup.
+//----------------------------------------------------------------------
+Real DL = 1.0;
+Real DH = 0.5;
+Real particle_spacing = 0.02;
+Real BW = particle_spacing * 4;
+
+class PeriodicGhostEntriesTest : public testing::Test
+{
+  protected:
+    PeriodicGhostEntriesTest()
+        : sph_system_(BoundingBox(Vec2d(-BW, -BW), Vec2d(DL + BW, DH + BW)), particle_spacing),
+          water_shape_(Transform(0.5 * Vec2d(DL, DH)), 0.5 * Vec2d(DL, DH), "WaterBody"),
+          water_block_(sph_system_, water_shape_)
+    {
+        water_block_.defineMaterial<WeaklyCompressibleFluid>(1.0, 10.0);
+        water_block_.generateParticles<BaseParticles, Lattice>();
+        // perturbed positions within the periodic bounds
+        BaseParticles &water_particles = water_block_.getBaseParticles();
+        Vecd *pos = water_particles.ParticlePositions();
+        for (size_t i = 0; i != water_particles.TotalRealParticles(); ++i)
+            pos[i] += 0.2 * particle_spacing * Vecd(rand_uniform(-1.0, 1.0), rand_uniform(-1.0, 1.0));
+    };
+
+    SPHSystem sph_system_;
+    TransformShape<GeometricShapeBox> water_shape_;
+    FluidBody water_block_;
+};
+
+using CellDataLists = StdVec<ListDataVector>;
+
+CellDataLists copyCellLists(RealBody &real_body)
+{
+    CellLinkedList &cell_linked_list = DynamicCast<CellLinkedList>(&real_body, real_body.getCellLinkedList());
+    CellDataLists cell_lists(cell_linked_list.getMesh().NumberOfCells());
+    for (size_t k = 0; k != cell_lists.size(); ++k)
+        cell_lists[k] = cell_linked_list.getCellDataList(k);
+    return cell_lists;
+}
+
+void sortCellLists(CellDataLists &cell_lists)
+{
+    for (ListDataVector &cell_list : cell_lists)
+        std::sort(cell_list.begin(), cell_list.end(),
+                  [](const ListData &a, const ListData &b)
+                  {
+                      return a.first < b.first ||
+                             (a.first == b.first && std::lexicographical_compare(
+                                                        a.second.data(), a.second.data() + Dimensions,
+                                                        b.second.data(), b.second.data() + Dimensions));
+                  });
+}
+/** the ghost entries inserted one by one with mutex exclusion */
+void insertGhostEntriesWithMutex(RealBody &real_body, PeriodicAlongAxis &periodic_box)
+{
+    BaseCellLinkedList &cell_linked_list = real_body.getCellLinkedList();
+    BaseParticles &particles = real_body.getBaseParticles();
+    Vecd *pos = particles.ParticlePositions();
+    BoundingBox bounds = periodic_box.getBoundingBox();
+    int axis = periodic_box.getAxis();
+    Vecd translation = periodic_box.getPeriodicTranslation();
+    Real cut_off_radius = real_body.getSPHAdaptation().getKernel()->CutOffRadius();
+    std::mutex mutex_cell_list_entry;
+    particle_for(execution::ParallelPolicy(), IndexRange(0, particles.TotalRealParticles()),
+                 [&](size_t i)
+                 {
+                     bool is_lower = pos[i][axis] > bounds.first_[axis] &&
+                                     pos[i][axis] < bounds.first_[axis] + cut_off_radius;
+                     bool is_upper = pos[i][axis] < bounds.second_[axis] &&
+                                     pos[i][axis] > bounds.second_[axis] - cut_off_radius;
+                     if (is_lower || is_upper)
+                     {
+                         Vecd translated_position = is_lower ? Vecd(pos[i] + translation) : Vecd(pos[i] - translation);
+                         mutex_cell_list_entry.lock();
+                         cell_linked_list.InsertListDataEntry(i, translated_position);
+                         mutex_cell_list_entry.unlock();
+                     }
+                 });
+}
+
+TEST_F(PeriodicGhostEntriesTest, SameAsMutexInsertion)
+{
+    PeriodicAlongAxis periodic_along_x(water_block_.getSPHBodyBounds(), xAxis);
+    PeriodicConditionUsingCellLinkedList periodic_condition(water_block_, periodic_along_x);
+
+    water_block_.updateCellLinkedList();
+    periodic_condition.update_cell_linked_list_.exec();
+    CellDataLists cell_lists = copyCellLists(water_block_);
+
+    water_block_.updateCellLinkedList();
+    periodic_condition.update_cell_linked_list_.exec();
+    CellDataLists repeated_cell_lists = copyCellLists(water_block_);
+
+    water_block_.updateCellLinkedList();
+    insertGhostEntriesWithMutex(water_block_, periodic_along_x);
+    CellDataLists mutex_cell_lists = copyCellLists(water_block_);
+
+    size_t total_entries = 0;
+    for (size_t k = 0; k != cell_lists.size(); ++k)
+    {
+        total_entries += cell_lists[k].size();
+        ASSERT_EQ(cell_lists[k].size(), repeated_cell_lists[k].size()) << "cell " << k;
+        for (size_t n = 0; n != cell_lists[k].size(); ++n)
+        {
+            EXPECT_EQ(cell_lists[k][n].first, repeated_cell_lists[k][n].first) << "cell " << k;
+            EXPECT_EQ(cell_lists[k][n].second, repeated_cell_lists[k][n].second) << "cell " << k;
+        }
+    }
+    // ghost entries are inserted
+    EXPECT_GT(total_entries, water_block_.getBaseParticles().TotalRealParticles());
+
+    sortCellLists(cell_lists);
+    sortCellLists(mutex_cell_lists);
+    for (size_t k = 0; k != cell_lists.size(); ++k)
+    {
+        ASSERT_EQ(cell_lists[k].size(), mutex_cell_lists[k].size()) << "cell " << k;
+        for (size_t n = 0; n != cell_lists[k].size(); ++n)
+        {
+            EXPECT_EQ(cell_lists[k][n].first, mutex_cell_lists[k][n].first) << "cell " << k;
+            EXPECT_EQ(cell_lists[k][n].second, mutex_cell_lists[k][n].second) << "cell " << k;
+        }
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,135 @@
+/**
+ * @file 	test_relaxed_particle_cache.cpp
+ * @brief 	test that the particle relaxation stops when converged,
+ *          that the relaxed particles are cached for each set of relaxation parameters,
+ *          and that the cached particles are read back by a later relaxation or a reload generator.
+ */
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+using namespace SPH;
+//----------------------------------------------------------------------
+//	Basic geometry parameters and numerical setup.
+//----------------------------------------------------------------------
+Real particle_spacing = 0.025;
+BoundingBox system_domain_bounds(Vec2d(-0.5, -0.5), Vec2d(0.5, 0.5));
+Real tolerance = 1.0e-3;
+size_t max_steps = 200;
+//----------------------------------------------------------------------
+//	Helper functions.
+//----------------------------------------------------------------------
+class Cylinder : public SolidBody
+{
+  public:
+    Cylinder(SPHSystem &sph_system)
+        : SolidBody(sph_system, createShape())
+    {
+        defineBodyLevelSetShape();
+        defineMaterial<Solid>();
+    };
+
+  protected:
+    static SharedPtr<MultiPolygonShape> createShape()
+    {
+        MultiPolygon cylinder;
+        cylinder.addACircle(Vec2d::Zero(), 0.3, 100, ShapeBooleanOps::add);
+        return makeShared<MultiPolygonShape>(cylinder, "Cylinder");
+    };
+};
+
+size_t numberOfCacheFiles(const std::string &cache_folder)
+{
+    size_t number_of_files = 0;
+    if (fs::exists(cache_folder))
+    {
+        for (const auto &entry : fs::directory_iterator(cache_folder))
+        {
+            if (entry.path().extension() == ".bin")
+                number_of_files++;
+        }
+    }
+    return number_of_files;
+}
+
+StdVec<Vecd> particlePositions(SPHBody &sph_body)
+{
+    BaseParticles &base_particles = sph_body.getBaseParticles();
+    Vecd *pos = base_particles.ParticlePositions();
+    return StdVec<Vecd>(pos, pos + base_particles.TotalRealParticles());
+}
+
+size_t relaxCylinder(Cylinder &cylinder, Real relaxation_tolerance)
+{
+    using namespace relax_dynamics;
+    InnerRelation cylinder_inner(cylinder);
+    SimpleDynamics<RandomizeParticlePosition> random_particles(cylinder);
+    RelaxationStepInner relaxation_step(cylinder_inner);
+    random_particles.exec(0.25);
+    relaxation_step.SurfaceBounding().exec();
+    size_t steps = relaxation_step.relaxToConvergence(relaxation_tolerance, max_steps);
+    if (steps != 0)
+    {
+        EXPECT_TRUE(relaxation_step.isConverged(relaxation_tolerance) || steps == max_steps);
+    }
+    return steps;
+}
+
+void expectSamePositions(const StdVec<Vecd> &positions, const StdVec<Vecd> &reference)
+{
+    ASSERT_EQ(positions.size(), reference.size());
+    for (size_t i = 0; i != reference.size(); ++i)
+    {
+        EXPECT_EQ(positions[i], reference[i]);
+    }
+}
+//----------------------------------------------------------------------
+//	Tests.
+//----------------------------------------------------------------------
+TEST(RelaxedParticleCache, RelaxAndReload)
+{
+    SPHSystem sph_system(system_domain_bounds, particle_spacing);
+    sph_system.setIOEnvironment();
+    std::string cache_folder = sph_system.getIOEnvironment().reload_folder_;
+    if (fs::exists(cache_folder))
+    {
+        fs::remove_all(cache_folder);
+    }
+    sph_system.setRelaxedParticleCaching(true);
+
+    Cylinder relaxed_cylinder(sph_system);
+    relaxed_cylinder.generateParticles<BaseParticles, Lattice>();
+    EXPECT_GT(relaxCylinder(relaxed_cylinder, tolerance), size_t(0));
+    StdVec<Vecd> relaxed_positions = particlePositions(relaxed_cylinder);
+    EXPECT_EQ(numberOfCacheFiles(cache_folder), size_t(1));
+
+    Cylinder cached_cylinder(sph_system);
+    cached_cylinder.generateParticles<BaseParticles, Lattice>();
+    EXPECT_EQ(relaxCylinder(cached_cylinder, tolerance), size_t(0));
+    expectSamePositions(particlePositions(cached_cylinder), relaxed_positions);
+    EXPECT_EQ(numberOfCacheFiles(cache_folder), size_t(1));
+
+    // a loose tolerance stops after a single step and is cached separately
+    Real loose_tolerance = MaxReal;
+    Cylinder loosely_relaxed_cylinder(sph_system);
+    loosely_relaxed_cylinder.generateParticles<BaseParticles, Lattice>();
+    EXPECT_EQ(relaxCylinder(loosely_relaxed_cylinder, loose_tolerance), size_t(1));
+    StdVec<Vecd> loosely_relaxed_positions = particlePositions(loosely_relaxed_cylinder);
+    EXPECT_EQ(numberOfCacheFiles(cache_folder), size_t(2));
+
+    Cylinder reloaded_cylinder(sph_system);
+    reloaded_cylinder.generateParticles<BaseParticles, Reload>(
+        reloaded_cylinder.getName(), relax_dynamics::RelaxationStepInner::RelaxationKey(tolerance, max_steps));
+    expectSamePositions(particlePositions(reloaded_cylinder), relaxed_positions);
+
+    Cylinder loosely_reloaded_cylinder(sph_system);
+    loosely_reloaded_cylinder.generateParticles<BaseParticles, Reload>(
+        loosely_reloaded_cylinder.getName(), relax_dynamics::RelaxationStepInner::RelaxationKey(loose_tolerance, max_steps));
+    expectSamePositions(particlePositions(loosely_reloaded_cylinder), loosely_relaxed_positions);
+}
+//----------------------------------------------------------------------
+//	Main.
+//----------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
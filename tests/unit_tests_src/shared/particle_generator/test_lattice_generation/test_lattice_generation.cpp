@@ -0,0 +1,81 @@
+/**
+ * @file 	test_lattice_generation.cpp
+ * @brief 	test that the lattice particles generated in parallel are the same
+ *          and in the same order as those found by a sequential loop over the lattice,
+ *          for a plain shape and a level set shape.
+ */
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+using namespace SPH;
+//----------------------------------------------------------------------
+//	Basic geometry parameters and numerical setup.
+//----------------------------------------------------------------------
+Real particle_spacing = 0.02;
+BoundingBox system_domain_bounds(Vec2d(-1.0, -1.0), Vec2d(2.0, 2.0));
+//----------------------------------------------------------------------
+//	Helper functions.
+//----------------------------------------------------------------------
+SharedPtr<MultiPolygonShape> createShape()
+{
+    MultiPolygon multi_polygon;
+    multi_polygon.addACircle(Vec2d(0.5, 0.5), 0.6, 100, ShapeBooleanOps::add);
+    multi_polygon.addABox(Transform(Vec2d(0.0, 0.3)), Vec2d(0.7, 0.2), ShapeBooleanOps::sub);
+    return makeShared<MultiPolygonShape>(multi_polygon, "Shape");
+}
+
+StdVec<Vecd> findContainedPositionsSequentially(SPHBody &sph_body)
+{
+    Mesh mesh(sph_body.getSPHSystemBounds(), sph_body.getSPHAdaptation().ReferenceSpacing(), 0);
+    Shape &initial_shape = sph_body.getInitialShape();
+    StdVec<Vecd> contained_positions;
+    mesh_for(MeshRange(Arrayi::Zero(), mesh.AllCells()),
+             [&](const Arrayi &cell_index)
+             {
+                 Vecd position = mesh.CellPositionFromIndex(cell_index);
+                 if (initial_shape.checkContain(position))
+                 {
+                     contained_positions.push_back(position);
+                 }
+             });
+    return contained_positions;
+}
+
+void compareWithSequentialGeneration(SPHBody &sph_body)
+{
+    BaseParticles &base_particles = sph_body.getBaseParticles();
+    StdVec<Vecd> contained_positions = findContainedPositionsSequentially(sph_body);
+    Vecd *pos = base_particles.ParticlePositions();
+
+    ASSERT_EQ(size_t(base_particles.TotalRealParticles()), contained_positions.size());
+    for (size_t i = 0; i != contained_positions.size(); ++i)
+    {
+        EXPECT_EQ(pos[i], contained_positions[i]);
+    }
+}
+//----------------------------------------------------------------------
+//	Tests.
+//----------------------------------------------------------------------
+TEST(LatticeGeneration, PlainShape)
+{
+    SPHSystem sph_system(system_domain_bounds, particle_spacing);
+    SolidBody body(sph_system, createShape());
+    body.generateParticles<BaseParticles, Lattice>();
+    compareWithSequentialGeneration(body);
+}
+
+TEST(LatticeGeneration, LevelSetShape)
+{
+    SPHSystem sph_system(system_domain_bounds, particle_spacing);
+    SolidBody body(sph_system, createShape());
+    body.defineBodyLevelSetShape();
+    body.generateParticles<BaseParticles, Lattice>();
+    compareWithSequentialGeneration(body);
+}
+//----------------------------------------------------------------------
+//	Main.
+//----------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
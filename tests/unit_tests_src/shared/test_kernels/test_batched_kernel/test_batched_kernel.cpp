@@ -0,0 +1,125 @@
+/**
+ * @file 	test_batched_kernel.cpp
+ * @brief 	test that the batched evaluation of the Wendland C2 kernel and the batched neighbor loop
+ *          give the same kernel values, gradients and unit vectors as the scalar evaluation.
+ */
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+using namespace SPH;
+//----------------------------------------------------------------------
+//	Basic parameters and numerical setup.
+//----------------------------------------------------------------------
+Real resolution_ref = 0.1;
+Real tolerance = 1.0e-12;
+constexpr UnsignedInt BatchSize = KernelWendlandC2CK::BatchSize;
+//----------------------------------------------------------------------
+//	Helper functions.
+//----------------------------------------------------------------------
+/** random displacements within the given radius, with a zero displacement first */
+StdVec<Vecd> randomDisplacements(size_t number_of_displacements, Real radius)
+{
+    StdVec<Vecd> displacements(1, Vecd::Zero());
+    while (displacements.size() != number_of_displacements)
+    {
+        Vecd displacement = Vecd::Zero();
+        for (int d = 0; d != Dimensions; ++d)
+            displacement[d] = rand_uniform(-1.0, 1.0) * radius;
+        if (displacement.norm() < radius)
+            displacements.push_back(displacement);
+    }
+    return displacements;
+}
+//----------------------------------------------------------------------
+//	Tests.
+//----------------------------------------------------------------------
+TEST(BatchedKernel, WendlandC2WithinAndBeyondCutOff)
+{
+    SPHAdaptation sph_adaptation(resolution_ref);
+    KernelWendlandC2CK kernel(*sph_adaptation.getKernel());
+    Real cut_off_radius = kernel.CutOffRadius();
+    Real W_tolerance = tolerance * kernel.W(Vecd(Vecd::Zero()));
+    StdVec<Vecd> displacements = randomDisplacements(10 * BatchSize, 1.5 * cut_off_radius);
+
+    for (size_t n = 0; n < displacements.size(); n += BatchSize)
+    {
+        Real displacement[Dimensions][BatchSize];
+        for (UnsignedInt k = 0; k != BatchSize; ++k)
+            for (int d = 0; d != Dimensions; ++d)
+                displacement[d][k] = displacements[n + k][d];
+
+        Real W_batch[BatchSize];
+        Real dW_batch[BatchSize];
+        Real e_batch[Dimensions][BatchSize];
+        kernel.W(displacement, W_batch);
+        kernel.dW_e(displacement, dW_batch, e_batch);
+
+        for (UnsignedInt k = 0; k != BatchSize; ++k)
+        {
+            const Vecd &r_ij = displacements[n + k];
+            Real distance = r_ij.norm();
+            if (distance < cut_off_radius)
+            {
+                EXPECT_NEAR(W_batch[k], kernel.W(r_ij), W_tolerance);
+                EXPECT_NEAR(dW_batch[k], kernel.dW(r_ij), W_tolerance / resolution_ref);
+            }
+            else
+            {
+                EXPECT_EQ(W_batch[k], 0.0);
+                EXPECT_EQ(dW_batch[k], 0.0);
+            }
+            Vecd e_ij = kernel.e(distance, r_ij);
+            for (int d = 0; d != Dimensions; ++d)
+                EXPECT_NEAR(e_batch[d][k], e_ij[d], tolerance);
+        }
+    }
+}
+
+TEST(BatchedKernel, NeighborLoopInBatches)
+{
+    SPHAdaptation sph_adaptation(resolution_ref);
+    KernelWendlandC2CK kernel(*sph_adaptation.getKernel());
+    Real dW_tolerance = tolerance * kernel.W(Vecd(Vecd::Zero())) / resolution_ref;
+
+    // a particle at the origin with a number of neighbors not divisible by the batch size
+    size_t number_of_neighbors = 3 * BatchSize + 3;
+    StdVec<Vecd> displacements = randomDisplacements(number_of_neighbors, kernel.CutOffRadius());
+    DiscreteVariable<Vecd> dv_pos("Position", number_of_neighbors + 1);
+    Vecd *pos = dv_pos.Data();
+    pos[0] = Vecd::Zero();
+    StdVec<UnsignedInt> neighbor_index;
+    for (size_t n = 0; n != number_of_neighbors; ++n)
+    {
+        pos[n + 1] = -displacements[n];
+        neighbor_index.push_back(number_of_neighbors - n); // not in order of the positions
+    }
+
+    Neighbor<> neighbor(seq, &sph_adaptation, &dv_pos);
+    // neighbor lists of different lengths, including one shorter than a batch
+    for (UnsignedInt first : {UnsignedInt(0), UnsignedInt(BatchSize - 2), UnsignedInt(number_of_neighbors - 3)})
+    {
+        StdVec<std::tuple<UnsignedInt, Real, Vecd>> batched, one_by_one;
+        neighbor.forEachNeighborInBatches(0, neighbor_index.data(), first, number_of_neighbors,
+                                          [&](UnsignedInt j, Real dW_ij, const Vecd &e_ij)
+                                          { batched.emplace_back(j, dW_ij, e_ij); });
+        neighbor.forEachNeighborOneByOne(0, neighbor_index.data(), first, number_of_neighbors,
+                                         [&](UnsignedInt j, Real dW_ij, const Vecd &e_ij)
+                                         { one_by_one.emplace_back(j, dW_ij, e_ij); });
+
+        ASSERT_EQ(batched.size(), size_t(number_of_neighbors - first));
+        ASSERT_EQ(batched.size(), one_by_one.size());
+        for (size_t n = 0; n != batched.size(); ++n)
+        {
+            EXPECT_EQ(std::get<0>(batched[n]), std::get<0>(one_by_one[n]));
+            EXPECT_NEAR(std::get<1>(batched[n]), std::get<1>(one_by_one[n]), dW_tolerance);
+            EXPECT_LT((std::get<2>(batched[n]) - std::get<2>(one_by_one[n])).norm(), tolerance);
+        }
+    }
+}
+//----------------------------------------------------------------------
+//	Main.
+//----------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}